@@ -15,7 +15,7 @@
 #ifndef HT1632C_DISPLAY_H
 #define HT1632C_DISPLAY_H
 
-#include <Arduino.h>
+#include "hal.h"
 
 // ── HT1632C Command Constants ──────────────────────────────────────────
 #define HT1632C_CMD_SYS_DIS  0x00
@@ -37,6 +37,15 @@
 #define HT1632C_WIDTH  24
 #define HT1632C_HEIGHT  8
 
+// ── Scroll strip cache ─────────────────────────────────────────────────
+// scrollText() renders each message once into a strip of columns and 
+// then scrolls by copying a 24-column window out of it. Registered 
+// messages keep their strip in a shared pool; anything else uses one 
+// scratch strip that's re-rendered when the text changes.
+#define HT1632C_SCROLL_SLOTS       10   // Registered messages
+#define HT1632C_SCROLL_POOL_COLS  320   // Shared by all registered strips
+#define HT1632C_SCROLL_SCRATCH_COLS 128 // ~21 characters; longer is cut off
+
 // ── Pin defaults (chosen to avoid conflicts with other nextgasm I/O) ──
 #define HT1632C_DEFAULT_CS   6
 #define HT1632C_DEFAULT_WR   7
@@ -62,7 +71,15 @@ public:
     bool getPixel(uint8_t x, uint8_t y);
     void setColumn(uint8_t col, uint8_t data);
 
-    void flush();
+    // Send the framebuffer to the display. Only the columns that 
+    // changed since the last flush go over the wire; returns false 
+    // (and sends nothing) when nothing did. Cheap to call every tick.
+    bool flush();
+
+    // Forget what the display holds, so the next flush() sends all 
+    // 24 columns. For after anything that may have disturbed its RAM.
+    void invalidate();
+
     void setBrightness(uint8_t level);
 
     void drawBar(int value, int maxValue);
@@ -81,9 +98,17 @@ public:
     // automatically — so mode changes look instant.
     //
     // Returns true if it actually redrew (useful if you want to 
-    // avoid redundant flush() calls elsewhere).
+    // avoid redundant flush() calls elsewhere — though flush() on an 
+    // unchanged buffer costs next to nothing now).
     bool scrollText(const char* text, unsigned long scrollIntervalMs = 50);
 
+    // Pre-render a message that scrollText() will be shown often (the 
+    // mode names), so switching to it is just a pointer lookup. Like 
+    // scrollText(), messages are matched by POINTER, so register the 
+    // same string literal you'll later pass in. Returns false if the 
+    // slots or pool are full (it'll still scroll, just uncached).
+    bool registerScrollText(const char* text);
+
     uint8_t* getBuffer();
 
 private:
@@ -93,6 +118,11 @@ private:
 
     uint8_t _buffer[HT1632C_WIDTH];
 
+    // What the HT1632C's RAM holds right now (see flush()).
+    // _shadowValid is false until the first full flush.
+    uint8_t _shadow[HT1632C_WIDTH];
+    bool _shadowValid;
+
     // --- Scroll state ---
     // These persist between calls to scrollText(), tracking where 
     // we are in the animation. In Python terms, they're like 
@@ -102,12 +132,27 @@ private:
     const char* _lastText;              // Detect when text changes to reset scroll
     int _textPixelWidth;                // Cached total width of current text in pixels
 
-    // --- Private drawing helpers ---
-    // Like drawChar/drawString but using signed int for x position,
-    // allowing characters to be partially off the left edge.
-    // The originals stay untouched with uint8_t for backwards compat.
-    void _drawCharSigned(int x, char c);
-    void _drawStringSigned(int x, const char* str);
+    // --- Scroll strip cache ---
+    // Each strip is the whole message rasterised to columns, once.
+    // _strip points at the one for _lastText (a pool slot or scratch).
+    struct ScrollSlot {
+        const char* text;
+        uint16_t start;                 // First column in _stripPool
+        uint16_t width;                 // Columns used
+    };
+    ScrollSlot _slots[HT1632C_SCROLL_SLOTS];
+    uint8_t _slotCount;
+    uint16_t _poolUsed;
+    uint8_t _stripPool[HT1632C_SCROLL_POOL_COLS];
+    uint8_t _scratch[HT1632C_SCROLL_SCRATCH_COLS];
+    const uint8_t* _strip;
+
+    // Rasterise `text` into `out` (up to maxCols), returning its width
+    uint16_t _renderStrip(const char* text, uint8_t* out, uint16_t maxCols);
+
+    // Fill _buffer from the current strip, with the strip's first 
+    // column at screen column x (which may be off either edge)
+    void _blitStrip(int x);
 
     void _writeBits(uint16_t data, uint8_t numBits);
     void _sendCommand(uint8_t cmd);
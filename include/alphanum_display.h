@@ -42,6 +42,9 @@ constexpr uint8_t ALPHANUM_I2C_ADDR = 0x70;
 bool alphanum_init();
 
 // ── Display functions ──────────────────────────────────────────────────
+//
+// These only build the next frame in memory. Call alphanum_commit()
+// once per tick, after the last of them, to send it.
 
 // Show a 4-character string. If shorter than 4 chars, remaining 
 // positions are blanked. If longer, only first 4 chars are shown.
@@ -68,17 +71,23 @@ void alphanum_show_int(int value);
 //           alphanum_show_labeled('P', 7)    →  displays "P  7"
 void alphanum_show_labeled(char label, int value);
 
-// Clear the display (all segments off).
+// Clear the frame (all segments off).
 void alphanum_clear();
 
 // Set brightness (0 = dimmest, 15 = brightest).
 // Default after init is 8 (mid-range).
 void alphanum_set_brightness(uint8_t level);
 
-// Light the decimal point on a specific digit (0-3) and re-flush.
+// Light the decimal point on a specific digit (0-3).
 // Call AFTER alphanum_show_text/int/labeled — it adds the dot to 
-// whatever's already on screen without clearing the character.
+// the frame being built without clearing the character.
 //
 // This is used for the heartbeat indicator in demo mode: show the 
 // BPM as text, then call this on beat frames to flash a dot.
-void alphanum_set_dot(uint8_t digit);
\ No newline at end of file
+void alphanum_set_dot(uint8_t digit);
+
+// Send the frame built by the calls above — but only if it differs
+// from what the display is already showing, so an unchanged "MENU"
+// costs no I2C traffic at all. If the bus queue is full the frame
+// stays pending and goes out on the next commit.
+void alphanum_commit();
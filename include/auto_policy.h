@@ -0,0 +1,59 @@
+// auto_policy.h — run_auto()'s arithmetic: thresholds and cooldowns
+//
+// What each userMode does comes down to two numbers: where the edge
+// threshold (pressureLimit) sits for a given knob position, and how
+// long the motor stays off after an edge. run_auto() (modes.cpp) reads
+// the encoder, talks to the edge guard and the motor engine and draws
+// the ring; the numbers come from here. Every input is passed in, and
+// nothing here touches the hardware, so it builds on the host (hal.h)
+// and the native tests can pin each mode's behaviour down. In Python:
+//
+//   limit = auto_pressure_limit(user_mode, knob, noise)
+//   if edge:
+//       motor.cut(auto_cooldown_ms(user_mode, settings, state))
+
+#pragma once
+
+#include "hal.h"
+#include "config.h"
+#include "noise_floor.h"
+
+// The knob's range in run_auto(): three turns of the ring
+constexpr int AUTO_KNOB_MAX = 3 * (NUM_LEDS - 1);
+
+// The user's settings a cooldown depends on (the globals of the same
+// names, globals.h)
+struct AutoSettings {
+    int rampUp;            // Seconds from off to full speed
+    int cooldown;          // Modes 3, 5 and 7: fixed cooldown, seconds
+    int maxCooldown;       // Modes 4 and 5 stop stepping past this
+    int cooldownStep;      // Mode 4: seconds added per edge
+    int pressureStep;      // Mode 5: counts taken off the limit per edge
+    int maxMotorSpeed;
+};
+
+// What carries over from one edge to the next
+struct AutoEdgeState {
+    int minimumcooldown;   // Mode 4's growing cooldown, seconds
+    int cooldownFlag;      // 1 once the motor has been off since the last edge
+    int pressureLimit;     // Mode 5 lowers it
+};
+
+// The edge threshold for this knob position (0 to AUTO_KNOB_MAX;
+// higher = more sensitive). Mode 7 sits a few deviations above the
+// top of the recent noise once `noise` is primed, with the knob only
+// biasing it; every other mode maps the knob straight onto
+// MAX_PRESSURE_LIMIT..1.
+int auto_pressure_limit(int userMode, int knob, const NoiseFloor& noise);
+
+// The knob position auto_pressure_limit() would have turned into
+// `limit` for `userMode` and these noise statistics — the reverse of
+// it, mode 7 included. For replaying a recorded limit through
+// run_auto(): the knob is what the user set, the limit is only what
+// the recorded mode made of it.
+int auto_knob_for_limit(int userMode, int limit, const NoiseFloor& noise);
+
+// How long to hold the motor off after an edge, in ms. Modes 4 and 5
+// step `state` on the first edge after the motor has been off (the
+// cooldown creeps up, or the threshold comes down).
+uint32_t auto_cooldown_ms(int userMode, const AutoSettings& settings, AutoEdgeState& state);
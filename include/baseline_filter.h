@@ -0,0 +1,86 @@
+// baseline_filter.h — Constant-time, fixed-point baseline estimator
+//
+// The "baseline" is the slow-moving resting pressure that the edging
+// algorithm compares each sample against (averagePressure). It used
+// to come from the RunningAverage library: 12 samples taken at 6Hz,
+// with a float divide on every read. That meant the baseline only
+// moved in 166ms steps, so the delta right after a clench was measured
+// against a stale value.
+//
+// BaselineFilter runs at the full sample rate instead, with O(1)
+// integer-only updates, in one of two modes:
+//
+//   BASELINE_EMA     Exponential moving average, alpha = 1 / 2^shift.
+//                    One subtract, one shift, one add per sample.
+//                    In Python: avg += (sample - avg) / 2**shift
+//
+//   BASELINE_WINDOW  True box-car average over the window. The window
+//                    is split into 64 blocks; each block's sum goes
+//                    into a small ring and the total is kept running.
+//                    Updates the output once per block (block length
+//                    = window / 64, e.g. 32ms for a 2s window at 1kHz).
+//
+// Either mode can be preceded by a median-of-N prefilter (N = 3, 5 or
+// 7) that throws away single-sample spikes before they reach the
+// average. The median of a handful of values is a fixed number of
+// compares, so it stays constant-time too.
+//
+// The filter is sized by WINDOW LENGTH IN SAMPLES, so the same class
+// serves the 1kHz pressure stream and the 60Hz simulator without any
+// retuning — pass rate × seconds and the shift values are derived.
+
+#pragma once
+
+#include "hal.h"
+#include "config.h"
+
+class BaselineFilter {
+public:
+    // mode:          BASELINE_EMA or BASELINE_WINDOW (config.h)
+    // windowSamples: averaging window length in samples
+    // medianN:       median prefilter length (0 or 1 = off, max 7)
+    BaselineFilter(uint8_t mode, uint32_t windowSamples, uint8_t medianN = 0);
+
+    // Forget history. The next sample seeds the output directly, so
+    // there's no start-up ramp from zero (which used to show up as a
+    // phantom edge right after boot).
+    void reset();
+
+    // Seed the output with a known value instead of the next sample.
+    void reset(uint16_t value);
+
+    // Feed one sample, return the updated baseline. Safe to call from
+    // an ISR — no floats, no division, no allocation.
+    uint16_t update(uint16_t sample);
+
+    // Current baseline without updating it.
+    uint16_t value() const { return _value; }
+
+private:
+    static constexpr uint8_t BLOCKS_LOG2 = 6;
+    static constexpr uint8_t BLOCKS = 1 << BLOCKS_LOG2;   // 64 blocks per window
+    static constexpr uint8_t MEDIAN_MAX = 7;
+
+    uint16_t median_prefilter(uint16_t sample);
+    void seed(uint16_t value);
+
+    uint8_t  _mode;
+    uint8_t  _shift;          // EMA: alpha shift. WINDOW: log2(block length)
+    uint8_t  _medianN;
+    bool     _primed = false;
+    volatile uint16_t _value = 0;
+
+    // EMA state, Q16 fixed point (value << 16)
+    int32_t  _emaAcc = 0;
+
+    // Window state
+    uint32_t _blockSum[BLOCKS] = {};
+    uint32_t _windowSum = 0;
+    uint32_t _partialSum = 0;
+    uint16_t _partialCount = 0;
+    uint8_t  _blockIndex = 0;
+
+    // Median prefilter ring
+    uint16_t _medianBuf[MEDIAN_MAX] = {};
+    uint8_t  _medianIndex = 0;
+};
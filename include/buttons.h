@@ -3,17 +3,22 @@
 #pragma once
 
 #include <Arduino.h>
+#include "input_events.h"
 
 // Initialize the encoder button pin. Called from setup().
 void button_init();
 
-// Poll the encoder button each tick. Returns one of:
+// Feed an INPUT_ENC_BUTTON event from the input queue. The control
+// task calls this while draining input_next_event().
+void button_handle_event(const InputEvent& ev);
+
+// The last completed press, then BTN_NONE until the next one:
 //   BTN_NONE, BTN_SHORT, BTN_LONG, BTN_V_LONG
 // 
-// This is a simple state machine that tracks key-down time.
 // Detection happens on key-up (release), so the press duration 
 // is measured from press to release — similar to how a Python 
-// GUI framework's on_release callback works.
+// GUI framework's on_release callback works. Both ends come from the
+// interrupt timestamps, so the length doesn't depend on the tick rate.
 uint8_t check_button();
 
 // Read the encoder knob, clamped to [minVal, maxVal].
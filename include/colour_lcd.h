@@ -40,13 +40,15 @@
 // IMPORTANT: The pixel buffer passed to lcd_send_frame_async() must
 // remain valid and UNMODIFIED for the entire duration of the DMA
 // transfer (~27ms at 40MHz). DMA reads bytes from it progressively
-// over that time — it's not a snapshot. This is why the fire effect
-// uses double buffering: DMA reads from one buffer while the CPU
-// writes the next frame into the other.
+// over that time — it's not a snapshot.
+//
+// Sources that are cheap to generate should use the strip-streaming 
+// API (lcd_stream_frame_async) instead, which needs no frame buffer 
+// at all — see below.
 
 #pragma once
 
-#include <Arduino.h>
+#include "hal.h"
 
 // ── Pin assignments ────────────────────────────────────────────────────
 constexpr uint8_t LCD_PIN_CS  = 4;   // Software chip select
@@ -106,13 +108,24 @@ constexpr uint32_t LCD_PIXEL_COUNT = (uint32_t)LCD_WIDTH * LCD_HEIGHT;  // 67,20
 
 // ── Public interface ───────────────────────────────────────────────────
 
-void lcd_init();
+// Start the panel's reset and power-up. Returns straight away — the
+// ~200ms of reset and sleep-out waits are stepped through by
+// lcd_init_service(), so other init can overlap them.
+void lcd_init_start();
+
+// Advance the power-up sequence. Call repeatedly (every millisecond or
+// so is plenty) until it returns true; from then on the panel is clear
+// and ready for drawing. Nothing else should touch the LCD before that.
+bool lcd_init_service();
+bool lcd_ready();
+
 void lcd_fill(uint16_t colour);
 void lcd_test_tick();
 
 // ── Synchronous bulk drawing API ───────────────────────────────────────
 // These block until all pixels are sent. Fine for small regions or
-// one-off draws, but NOT for full-frame updates in the main loop.
+// one-off draws, but NOT for anything in the main loop 
+// — use the async rectangle primitives below instead.
 
 void lcd_begin_draw(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
 void lcd_push_pixel(uint16_t colour);
@@ -120,7 +133,9 @@ void lcd_end_draw();
 
 // ── Async DMA frame transfer API ───────────────────────────────────────
 //
-// Usage pattern (called from the fire module or similar):
+// (lcd_send_frame_async is lcd_blit_rect_async for the whole screen.)
+//
+// Usage pattern (for a caller that owns a full-frame buffer):
 //
 //   if (!lcd_frame_busy()) {
 //       // ...render pixels into buffer using RGB565_BE colours...
@@ -137,5 +152,87 @@ void lcd_end_draw();
 // Returns true if transfer started, false if busy.
 bool lcd_send_frame_async(const uint16_t* pixelData, uint32_t pixelCount);
 
-// Check if a DMA transfer is still in progress.
-bool lcd_frame_busy();
\ No newline at end of file
+// Check if a DMA transfer (or strip stream) is still in progress.
+bool lcd_frame_busy();
+
+// ── Strip-streaming API ────────────────────────────────────────────────
+//
+// Most of what we draw is generated from something much smaller than a 
+// full frame (the fire is a 60×70 grid scaled 4×). Rather than render a 
+// whole 134KB frame and then send it, the driver asks for the picture 
+// a strip at a time and sends each strip as soon as it's ready:
+//
+//   strip buffer A ──DMA──→ LCD          (strip N going out)
+//   strip buffer B ← render callback     (strip N+1 being filled)
+//
+// Two small strip buffers (2 × LCD_STRIP_PIXELS) replace the two 
+// full-frame buffers, and the first strip is on the wire while the 
+// rest are still being generated.
+//
+// The render callback fills `out` with `lines` rows of the region, 
+// starting at row `y0` (relative to the region's top), each row 
+// `width` pixels, pre-swapped RGB565 (RGB565_BE). `out` is 4-byte 
+// aligned, so rows of even width can be written as 32-bit words.
+// In Python terms:
+//
+//   def render(out, y0, lines):
+//       for y in range(y0, y0 + lines):
+//           out.extend(pixel_row(y))
+//
+// IMPORTANT: after the first strip, the callback is called from the 
+// DMA completion interrupt. It must be quick (a few µs per strip), 
+// must not touch Serial or block, and whatever it reads from must not 
+// change until lcd_frame_busy() returns false.
+
+constexpr uint16_t LCD_STRIP_LINES  = 16;
+constexpr uint32_t LCD_STRIP_PIXELS = (uint32_t)LCD_WIDTH * LCD_STRIP_LINES;  // 3,840
+
+typedef void (*LcdStripRenderFn)(uint16_t* out, uint16_t y0, uint16_t lines);
+
+// Stream a width × height region at (x, y), strip by strip.
+// Narrower regions get proportionally more lines per strip.
+// Returns false (and does nothing) if a transfer is already running 
+// or the region doesn't fit on screen.
+bool lcd_stream_rect_async(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+                           LcdStripRenderFn render);
+
+// Stream the whole screen (LCD_WIDTH × LCD_HEIGHT).
+bool lcd_stream_frame_async(LcdStripRenderFn render);
+
+// True while a stream using `render` is still going out — i.e. while 
+// `render` may still be called and whatever it reads must stay put.
+bool lcd_streaming(LcdStripRenderFn render);
+
+// ── Async rectangle primitives ─────────────────────────────────────────
+//
+// Non-blocking versions of the everyday drawing jobs — clearing the 
+// screen, clearing a widget, copying a sprite in. All of them share the 
+// one DMA channel with the calls above, so the same rules apply:
+//
+//   - each returns false (and draws nothing) if lcd_frame_busy(), or 
+//     if the rectangle doesn't fit on screen — try again next tick
+//   - completion is reported by lcd_frame_busy() going false
+//
+// A 240×280 clear takes the same ~27ms of wire time as lcd_fill(), but 
+// the CPU spends a few µs on it instead of the whole 27ms.
+
+// Fill a rectangle with one colour. Takes PLAIN RGB565 (like lcd_fill) 
+// — the byte swap is done internally, since nothing is read from RAM.
+bool lcd_fill_rect_async(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+                         uint16_t colour);
+
+// Fill the whole screen. The async replacement for lcd_fill().
+bool lcd_fill_async(uint16_t colour);
+
+// Copy width × height pre-swapped (RGB565_BE) pixels, row after row, 
+// from memory to the rectangle. Sent by DMA straight from `pixels`, so 
+// the buffer must stay untouched until lcd_frame_busy() returns false.
+bool lcd_blit_rect_async(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+                         const uint16_t* pixels);
+
+// Draw the same `width`-pixel line (RGB565_BE) on every row of the 
+// rectangle — gradients that only vary vertically, stripes, bars. 
+// `line` is copied into the strip buffers before this returns, so the 
+// caller can reuse it straight away.
+bool lcd_repeat_line_async(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+                           const uint16_t* line);
@@ -1,7 +1,7 @@
 // config.h — Central configuration for the nextgasm project
 // 
 #pragma once
-#include <Arduino.h>
+#include "hal.h"
 
 // --- Hardware Pins ---
 // These are simple numeric constants. constexpr gives them a 
@@ -16,33 +16,112 @@ constexpr uint8_t ENC_SW = 5;
 constexpr bool ENC_SW_UP = HIGH;
 constexpr bool ENC_SW_DOWN = LOW;
 
+// --- Hardware profile ---
+// Which displays this unit actually has. The LED ring is always fitted
+// (every mode draws on it); the rest are optional. For a display the
+// profile leaves out, main.cpp never calls its driver or registers its
+// render task — every such call sits behind `if constexpr` — so the
+// linker drops the driver code, font tables and buffers entirely, and
+// nothing checks for the display at run time.
+//
+// Pick a profile with a build flag (see the envs in platformio.ini):
+//
+//   -DNEXTGASM_PROFILE=NEXTGASM_PROFILE_RING_OLED
+//
+// In Python terms: Displays = PROFILES[os.environ.get("PROFILE", "full")]
+template <bool Oled, bool Matrix, bool Lcd, bool Alphanum>
+struct DisplaySet {
+    static constexpr bool oled     = Oled;      // SH1106 128×64, I2C
+    static constexpr bool matrix   = Matrix;    // HT1632C 32×8 LED matrix
+    static constexpr bool lcd      = Lcd;       // ST7789V2 240×280 colour LCD
+    static constexpr bool alphanum = Alphanum;  // HT16K33 4-digit, I2C
+    static constexpr bool anyI2c   = Oled || Alphanum;
+};
+
+using ProfileFull     = DisplaySet<true, true,  true,  true>;
+using ProfileRingOled = DisplaySet<true, false, false, false>;
+
+#define NEXTGASM_PROFILE_FULL       1
+#define NEXTGASM_PROFILE_RING_OLED  2
+
+#ifndef NEXTGASM_PROFILE
+#define NEXTGASM_PROFILE NEXTGASM_PROFILE_FULL
+#endif
+
+#if NEXTGASM_PROFILE == NEXTGASM_PROFILE_RING_OLED
+using Displays = ProfileRingOled;
+#else
+using Displays = ProfileFull;
+#endif
+
 constexpr uint8_t MOTPIN = 9;
 constexpr uint8_t BUTTPIN = A0;
 
 // --- ADC / Sampling ---
+// The pressure ADC runs continuously from a hardware timer (see 
+// pressure_sampler.h). OVERSAMPLE is now the ADC's hardware averaging 
+// count, and every ADC_DECIMATION conversions are averaged into one 
+// sample of the PRESSURE_SAMPLE_HZ stream.
 constexpr uint8_t OVERSAMPLE = 4;
 constexpr uint16_t ADC_MAX = 4095;  // Updated for 12-bit Teensy ADC
+constexpr uint32_t ADC_SAMPLE_RATE_HZ = 2000;
+constexpr uint8_t ADC_DECIMATION = 2;
+constexpr uint32_t PRESSURE_SAMPLE_HZ = ADC_SAMPLE_RATE_HZ / ADC_DECIMATION;  // 1kHz
+
+// --- Body sensors (sensor_channels.h) ---
+// ECG and GSR share the second ADC module. A10–A13 are only wired to 
+// that module on the Teensy 4.0, so they can't clash with the pressure 
+// sampler on the first. Every channel rate must divide SENSOR_TICK_HZ.
+constexpr uint8_t  ECG_PIN = A10;
+constexpr uint8_t  GSR_PIN = A11;
+constexpr uint16_t SENSOR_TICK_HZ = 500;
+constexpr uint16_t ECG_SAMPLE_HZ = 500;   // QRS complexes are ~100ms wide
+constexpr uint16_t GSR_SAMPLE_HZ = 10;    // Skin conductance moves over seconds
 
 // --- Timing ---
 constexpr uint8_t FREQUENCY = 60;
 constexpr uint16_t LONG_PRESS_MS = 600;
 constexpr uint16_t V_LONG_PRESS_MS = 2500;
 constexpr unsigned long UPDATE_PERIOD_MS = 1000 / FREQUENCY;
+constexpr uint32_t UPDATE_PERIOD_US = 1000000UL / FREQUENCY;  // Control task period
 
-// --- Pressure averaging ---
-constexpr uint8_t RA_HIST_SECONDS = 2;
-constexpr uint8_t RA_FREQUENCY = 6;
-constexpr uint8_t RA_TICK_PERIOD = FREQUENCY / RA_FREQUENCY;
+// --- Power (power.h) ---
+// Sleep (WFI) between scheduler passes instead of spinning in loop().
+constexpr bool POWER_SLEEP_ENABLED = true;
+// CPU clock on the menu and in STANDBY, where there's little to draw. 
+// Must be a multiple of 150MHz so the peripheral bus clock stays put. 
+// 0 = always run at full speed.
+constexpr uint32_t POWER_IDLE_CPU_HZ = 150000000;
+
+// --- Pressure baseline (averagePressure) ---
+// See baseline_filter.h. The baseline is updated at the full
+// PRESSURE_SAMPLE_HZ rate inside the sampler ISR.
+constexpr uint8_t BASELINE_EMA = 0;     // Exponential moving average
+constexpr uint8_t BASELINE_WINDOW = 1;  // Box-car average over the window
+constexpr uint8_t BASELINE_MODE = BASELINE_EMA;
+constexpr uint8_t BASELINE_WINDOW_SECONDS = 2;
+constexpr uint8_t BASELINE_MEDIAN_N = 5;  // Spike-rejection prefilter (0 = off)
 
 // --- Motor limits ---
 constexpr uint8_t MOT_MAX = 255;
 constexpr uint8_t MOT_MIN = 20;
 constexpr uint16_t MAX_PRESSURE_LIMIT = 600;
 
-// --- EEPROM addresses ---
-constexpr uint8_t BEEP_ADDR = 1;
-constexpr uint8_t MAX_SPEED_ADDR = 2;
-constexpr uint8_t SENSITIVITY_ADDR = 3;
+// --- Edge guard ---
+// Consecutive over-limit samples (at PRESSURE_SAMPLE_HZ) before the 
+// ISR cuts the motor. 1 = cut on the first sample, ~1ms worst case.
+constexpr uint8_t EDGE_GUARD_CONFIRM_SAMPLES = 1;
+
+// --- Adaptive threshold (userMode 7) ---
+// See noise_floor.h. The guard tracks the noise in the pressure delta
+// over NOISE_WINDOW_SECONDS; mode 7 sets pressureLimit to the top of
+// that noise plus ADAPTIVE_DEVIATIONS standard deviations, and the knob
+// adds up to ±ADAPTIVE_BIAS_RANGE counts on top (higher knob = more
+// sensitive, as in the other modes).
+constexpr uint8_t NOISE_WINDOW_SECONDS = 8;
+constexpr uint8_t NOISE_OUTLIER_DEVIATIONS = 8;   // Further out is an edge, not noise
+constexpr float   ADAPTIVE_DEVIATIONS = 3.0f;
+constexpr int     ADAPTIVE_BIAS_RANGE = 100;
 
 // --- State machine modes ---
 constexpr uint8_t STANDBY = 1;
@@ -65,10 +144,14 @@ constexpr bool DEBUG_MODE = true; // Enter general debug mode - don't print roll
 constexpr bool DEBUG_PRESSURE = false; // Print pressure values to serial
 constexpr bool DEBUG_MOTOR = false; // Print motor values to serial
 constexpr bool DEBUG_BUTTONS = true; // Print button actions to serial
+constexpr bool PROFILER_ENABLED = false; // Cycle-count modules (profiler.h), 'p' over serial for a report
 
-// --- FastLED configuration ---
-// These MUST stay as #defines. FastLED uses them as template 
-// parameters, which require the values to be substituted at the 
-// preprocessor level before the compiler sees them. 
-#define LED_TYPE    WS2812B
-#define COLOR_ORDER GRB
\ No newline at end of file
+// --- LED ring output (leds.h) ---
+// The ring is driven by OctoWS2811's DMA engine rather than FastLED's
+// show(), so colour order and correction live here instead of in 
+// FastLED template parameters. The correction is FastLED's 
+// TypicalLEDStrip (0xFFB0F0) — per-channel scale applied on output, 
+// together with BRIGHTNESS.
+constexpr uint8_t LED_CORRECTION_R = 0xFF;
+constexpr uint8_t LED_CORRECTION_G = 0xB0;
+constexpr uint8_t LED_CORRECTION_B = 0xF0;
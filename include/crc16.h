@@ -0,0 +1,14 @@
+// crc16.h — CRC-16/CCITT-FALSE, shared by the firmware's binary formats
+//
+// The telemetry records, the settings slots and the session file's
+// sectors all carry this CRC (poly 0x1021, init 0xFFFF, no reflection,
+// no final XOR). In Python:
+//
+//   import binascii
+//   crc = binascii.crc_hqx(data, 0xFFFF)
+
+#pragma once
+
+#include "hal.h"
+
+uint16_t crc16_ccitt(const uint8_t* data, size_t len);
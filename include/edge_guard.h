@@ -0,0 +1,59 @@
+// edge_guard.h — Hard-real-time edge detection from the ADC interrupt
+//
+// The edge check in run_auto() only runs once per 60Hz frame, after
+// the nav read and the pressure read, so a slow OLED or LCD frame
+// could delay the motor cut by a whole tick or more. The edge guard
+// moves that one comparison into the sampler's interrupt:
+//
+//   every decimated sample (1kHz):
+//       if armed and sample - baseline > limit:
+//           cut the motor PWM right now
+//           raise a flag for run_auto() to pick up
+//
+// The rest of the edging logic (cooldown depth, per-userMode rules)
+// stays in the cooperative main loop. The guard only does the bit
+// that can't wait.
+//
+// In Python terms it's like a signal handler that kills the motor
+// and sets threading.Event(); the main loop later calls event.is_set()
+// and does the bookkeeping.
+
+#pragma once
+
+#include <Arduino.h>
+#include "noise_floor.h"
+
+// Enable the guard with the current threshold. run_auto() calls this
+// every tick with the live pressureLimit. Arming after being disarmed
+// discards any stale trip from before.
+void edge_guard_arm(int limit);
+
+// Disable the guard and release any motor cut it is holding.
+// Called whenever AUTO mode isn't the one running.
+void edge_guard_disarm();
+
+// ISR side: check one decimated sample against the baseline. Called
+// from the sampler ISR, which keeps the baseline at the same rate.
+void edge_guard_feed(uint16_t sample, uint16_t baseline);
+
+// Main-loop side: returns true exactly once per trip. The motor stays
+// latched off — run_auto()'s motor_engine_cut() takes over from the
+// latch once its cooldown hold is in place.
+bool edge_guard_take_event();
+
+// Number of trips since boot (for diagnostics / serial reporting).
+uint32_t edge_guard_trip_count();
+
+// ── Noise floor ────────────────────────────────────────────────────────
+// Running statistics of every delta the guard is fed, armed or not
+// (noise_floor.h). userMode 7 sets its threshold from these.
+const NoiseFloor& edge_guard_noise();
+
+// Put the live statistics aside and start fresh ones for a replay or
+// simulated source running at `sampleHz`; edge_guard_restore_noise()
+// brings the live ones back, as they stood. The live sensor's noise
+// has nothing to do with a recording's, and shouldn't be lost to it.
+// Only call while no source is feeding the guard (pressure_set_source
+// does both between switching one feed off and the next on).
+void edge_guard_stash_noise(uint32_t sampleHz);
+void edge_guard_restore_noise();
@@ -0,0 +1,66 @@
+// event_queue.h — Lock-free single-producer/single-consumer queue
+//
+// SampleRing (sample_ring.h) is for streams where only the latest
+// data matters, so it overwrites the oldest sample when full. Input
+// events are the opposite: every press and release matters, in order,
+// and each one must be handled exactly once. So this queue never
+// overwrites — a push into a full queue is refused and counted.
+//
+// In Python terms it's a queue.Queue(maxsize=N) that never blocks:
+//
+//   q.put_nowait(ev)     # from the interrupt — False if full
+//   ev = q.get_nowait()  # from the main loop — None if empty
+//
+// THREAD SAFETY (single core):
+//   - push() is called from ONE producer context (an interrupt, or
+//     main-loop code with interrupts disabled) and only writes _head
+//   - pop() is called from ONE consumer context and only writes _tail
+//   - each side writes its slot BEFORE moving its index, with a
+//     compiler barrier in between, so neither side ever sees a slot
+//     the other is still filling or emptying
+
+#pragma once
+
+#include <Arduino.h>
+
+template <typename T, uint16_t N>
+class EventQueue {
+    static_assert(N != 0 && (N & (N - 1)) == 0, "EventQueue size must be a power of two");
+
+public:
+    // Producer side. Returns false (and drops the item) if full.
+    bool push(const T& item)
+    {
+        uint32_t h = _head;
+        if (h - _tail >= N) {
+            _dropped = _dropped + 1;
+            return false;
+        }
+        _buf[h & (N - 1)] = item;
+        __asm__ volatile("" ::: "memory");  // Slot must land before head moves
+        _head = h + 1;
+        return true;
+    }
+
+    // Consumer side. Returns false if there's nothing waiting.
+    bool pop(T& out)
+    {
+        uint32_t t = _tail;
+        if (t == _head) return false;
+        out = _buf[t & (N - 1)];
+        __asm__ volatile("" ::: "memory");  // Copy must finish before the slot is freed
+        _tail = t + 1;
+        return true;
+    }
+
+    bool empty() const { return _tail == _head; }
+
+    // Items refused because the queue was full
+    uint32_t dropped() const { return _dropped; }
+
+private:
+    T _buf[N] = {};
+    volatile uint32_t _head = 0;
+    volatile uint32_t _tail = 0;
+    volatile uint32_t _dropped = 0;
+};
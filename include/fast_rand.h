@@ -0,0 +1,42 @@
+// fast_rand.h — Tiny inline xorshift PRNG for effects and simulation
+//
+// Arduino's random(min, max) runs a full 32-bit generator, then a 
+// modulo (a divide) to fit the range, then a function call on top. 
+// Calling it twice per fire cell was most of fire_step()'s cost.
+//
+// xorshift32 (George Marsaglia, 2003) is three shifts and three XORs 
+// per 32 random bits, inlined right into the caller. The trick for 
+// speed is to use ALL 32 bits: one call gives eight 4-bit values 
+// ("nibbles"), or four bytes, enough for several cells at once.
+//
+// In Python terms:
+//
+//   x ^= (x << 13) & 0xFFFFFFFF
+//   x ^= x >> 17
+//   x ^= (x << 5) & 0xFFFFFFFF
+//   return x
+//
+// Not suitable for anything security-related — it's for visuals and 
+// simulated noise, where "looks random" is all we need.
+
+#pragma once
+
+#include "hal.h"
+
+struct FastRand {
+    uint32_t state = 2463534242u;   // Any non-zero seed works
+
+    // Seed must be non-zero (zero is a fixed point: 0 → 0 forever).
+    void seed(uint32_t s) { state = s ? s : 2463534242u; }
+
+    // 32 fresh random bits.
+    inline uint32_t next()
+    {
+        uint32_t x = state;
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        state = x;
+        return x;
+    }
+};
@@ -43,32 +43,27 @@
 // to see clearly, giving the fire a physical, tangible quality.
 //
 // ═══════════════════════════════════════════════════════════════════════
-// DMA DOUBLE-BUFFERING
+// STRIP STREAMING
 // ═══════════════════════════════════════════════════════════════════════
 //
-// The rendering uses two full-frame pixel buffers in a ping-pong
-// arrangement:
+// There's no full-frame pixel buffer. The LCD driver asks for the 
+// picture 16 lines at a time and sends each strip by DMA while the 
+// next one is being expanded from the heat grid:
 //
-//   Buffer A ← CPU renders the next frame here
-//   Buffer B → DMA streams this to the LCD via SPI
+//   strip A → DMA streams this to the LCD via SPI
+//   strip B ← fire_render_strip() fills this from the 60×70 grid
 //
-//   When DMA finishes:
-//     swap A and B
-//     kick off new DMA transfer (now sending what was just rendered)
-//     CPU starts rendering the NEXT frame into the now-free buffer
+//   When DMA finishes strip A:
+//     start sending strip B
+//     render the following strip into A
 //
-// This means the CPU never waits for the display. It's like a
-// restaurant kitchen with two serving plates: the waiter takes one
-// to the table while the chef starts plating the next dish. Neither
-// ever has to wait for the other.
-//
-// The two pixel buffers use DMAMEM to live in the Teensy's secondary
-// RAM (RAM2/OCRAM), keeping the fast tightly-coupled DTCM free for
-// the stack and other time-critical data.
+// It's like a restaurant kitchen plating one course while the waiter 
+// carries out the previous one — except the plates are tiny, so the 
+// kitchen needs almost no counter space (15KB instead of 268KB).
 
 #pragma once
 
-#include <Arduino.h>
+#include "hal.h"
 
 // ── Simulation dimensions ──────────────────────────────────────────────
 // Quarter LCD resolution in each dimension. Each fire pixel becomes
@@ -78,12 +73,12 @@ constexpr uint16_t FIRE_HEIGHT = 70;    // LCD_HEIGHT / 4
 
 // ── Public interface ───────────────────────────────────────────────────
 
-// Set up the fire buffer, pixel buffers, and seed the bottom row.
+// Clear the fire grid and seed the bottom row.
 // Call once before the first fire_tick().
 void fire_init();
 
-// Run one simulation step, render to a pixel buffer, and kick off
-// a DMA transfer if the previous one has finished.
+// Run one simulation step and start streaming it to the LCD if the 
+// previous frame has finished.
 // Non-blocking — safe to call every main loop tick.
 // If DMA is still busy sending the last frame, this returns
 // immediately without doing anything (frame skip).
@@ -127,4 +122,23 @@ void fire_set_cooling(uint8_t maxCooling);
 
 // Read back current values (useful for display/diagnostics).
 uint8_t fire_get_intensity();
-uint8_t fire_get_cooling();
\ No newline at end of file
+uint8_t fire_get_cooling();
+
+// ── Host tests and benchmarks ──────────────────────────────────────────
+// The kernel's pieces on their own, for the native test suite 
+// (test/test_native). fire_tick() is fire_step() plus a stream of 
+// fire_render_strip() calls.
+
+// Restart the random sequence, so a run of fire_step() is repeatable.
+// fire_init() seeds it from the microsecond clock.
+void fire_seed(uint32_t seed);
+
+// One simulation step of the heat grid.
+void fire_step();
+
+// The heat grid, FIRE_WIDTH × FIRE_HEIGHT cells, top row first.
+const uint8_t* fire_heat();
+
+// Fill `lines` LCD rows, starting at row y0, with the scaled 
+// pre-swapped pixels (the LcdStripRenderFn fire_tick() streams).
+void fire_render_strip(uint16_t* out, uint16_t y0, uint16_t lines);
@@ -0,0 +1,75 @@
+// fixed.h — Q16.16 fixed-point numbers for the control maths
+//
+// The Cortex-M7 has a hardware FPU, but float maths in the control
+// step still means int↔float conversions everywhere (the knob, the
+// ADC and the motor PWM are all integers) plus a divide per tick.
+// Fixed point keeps everything in integer registers: a number is an
+// int32_t holding value × 65536, so
+//
+//   1.0   → 0x00010000        0.5 → 0x00008000
+//   255.0 → 0x00FF0000       -2.0 → 0xFFFE0000
+//
+// Adding two is just +. Multiplying two needs one 64-bit product and
+// a shift back down. In Python terms:
+//
+//   to_q16   = lambda x: round(x * 65536)
+//   q16_mul  = lambda a, b: (a * b + 32768) >> 16
+//
+// Range is ±32768 with a resolution of 1/65536 (~0.000015), which is
+// plenty for motor speeds (0–255), pressures (0–4095) and the small
+// per-tick rates. Multiplies round to nearest, so one operation is off
+// by at most half a step — far below anything the motor or the
+// displays can show.
+
+#pragma once
+
+#include "hal.h"
+
+typedef int32_t q16_t;
+
+constexpr int   Q16_SHIFT = 16;
+constexpr q16_t Q16_ONE   = (q16_t)1 << Q16_SHIFT;
+
+// From a float CONSTANT, rounded — for tuning values, evaluated at
+// compile time. In Python: round(x * 65536)
+constexpr q16_t q16(float x)
+{
+    return (q16_t)(x * (float)Q16_ONE + (x >= 0 ? 0.5f : -0.5f));
+}
+
+constexpr q16_t q16_from_int(int32_t x) { return (q16_t)(x * Q16_ONE); }
+
+// Whole part, rounding toward minus infinity (like floor()). For the
+// positive values we hand to the motor this matches (int)float.
+constexpr int32_t q16_to_int(q16_t x) { return x >> Q16_SHIFT; }
+
+inline q16_t q16_from_float(float x) { return (q16_t)(x * (float)Q16_ONE); }
+inline float q16_to_float(q16_t x)   { return (float)x * (1.0f / (float)Q16_ONE); }
+
+inline q16_t q16_mul(q16_t a, q16_t b)
+{
+    return (q16_t)(((int64_t)a * b + (Q16_ONE >> 1)) >> Q16_SHIFT);
+}
+
+inline q16_t q16_mul_int(q16_t a, int32_t b)
+{
+    return (q16_t)((int64_t)a * b);
+}
+
+// a / b for an integer b — one integer divide
+inline q16_t q16_div_int(q16_t a, int32_t b)
+{
+    return b != 0 ? a / b : 0;
+}
+
+// a × num / den with a 64-bit intermediate, for ratios that would
+// overflow as two separate steps
+inline q16_t q16_scale(q16_t a, int32_t num, int32_t den)
+{
+    return den != 0 ? (q16_t)((int64_t)a * num / den) : 0;
+}
+
+inline q16_t q16_clamp(q16_t x, q16_t lo, q16_t hi)
+{
+    return x < lo ? lo : (x > hi ? hi : x);
+}
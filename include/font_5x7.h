@@ -0,0 +1,30 @@
+// font_5x7.h — Basic 5×7 bitmap font, shared by the LED matrix and LCD
+//
+// Each character is 5 bytes wide, each byte is one column with bit 0
+// at the top. ASCII 32 (space) through 90 (Z) — uppercase only, which 
+// is all the displays ever need.
+//
+// In Python terms it's a dict of column lists:
+//   FONT_5X7['A'] == [0x7E, 0x11, 0x11, 0x11, 0x7E]
+
+#pragma once
+
+#include <Arduino.h>
+
+constexpr uint8_t FONT_FIRST_CHAR       = 32;
+constexpr uint8_t FONT_LAST_CHAR        = 90;
+constexpr uint8_t FONT_CHAR_COUNT       = FONT_LAST_CHAR - FONT_FIRST_CHAR + 1;
+constexpr uint8_t FONT_CHAR_WIDTH       = 5;
+constexpr uint8_t FONT_CHAR_HEIGHT      = 7;
+constexpr uint8_t FONT_CHAR_SPACING     = 1;  // 1px gap between characters
+constexpr uint8_t FONT_TOTAL_CHAR_WIDTH = FONT_CHAR_WIDTH + FONT_CHAR_SPACING;  // 6px per char
+
+extern const uint8_t FONT_5X7[FONT_CHAR_COUNT][FONT_CHAR_WIDTH];
+
+// One column of a character. Anything outside the table draws as a 
+// space, the same as the matrix driver has always done.
+inline uint8_t font_5x7_column(char c, uint8_t col)
+{
+    if (c < (char)FONT_FIRST_CHAR || c > (char)FONT_LAST_CHAR) c = ' ';
+    return pgm_read_byte(&FONT_5X7[c - FONT_FIRST_CHAR][col]);
+}
@@ -0,0 +1,69 @@
+// frame_coordinator.h — One render loop for every display
+//
+// Each display used to be its own scheduler task, with its own budget
+// and, before that, its own millis() throttle. Adding a display meant
+// picking yet another period and budget by hand and hoping it fitted.
+//
+// Now every display describes itself the same way, as a Display:
+//
+//   wantsFrame()   is there anything new to show?
+//   isBusy()       is the hardware still taking the last frame?
+//   render(us)     draw/send now; `us` is the time available
+//
+// and a single coordinator task offers each display a slot from
+// whatever time is left before the next control tick. A display that
+// wanted a frame but didn't fit goes to the FRONT of the queue on the
+// next tick, and after FRAMES_FORCE_AFTER missed ticks it renders
+// regardless — slow displays update less often, but never starve.
+//
+// In Python terms:
+//
+//   def frames_run():
+//       for d in sorted(displays, key=lambda d: -d.missed):
+//           if not d.wants_frame() or d.is_busy(): continue
+//           left = time_until_next_control()
+//           if d.cost <= left or d.missed >= FORCE_AFTER:
+//               d.render(left); d.cost = measure(); d.missed = 0
+//           else:
+//               d.missed += 1
+//
+// Nobody tunes the costs: each display starts from a rough estimate
+// and the coordinator tracks what its renders actually take (peak,
+// decaying slowly), so a display that gets slower simply gets
+// scheduled as slower.
+
+#pragma once
+
+#include <Arduino.h>
+
+struct Display {
+    const char* name;
+    bool (*wantsFrame)();              // nullptr = always
+    bool (*isBusy)();                  // nullptr = never
+    void (*render)(uint32_t budgetUs); // A hint — most renders are one fixed-size step
+    uint32_t    initialCostUs;         // First guess, until measured
+};
+
+constexpr uint8_t FRAMES_MAX_DISPLAYS = 8;
+constexpr uint8_t FRAMES_FORCE_AFTER  = 3;    // Missed ticks before a forced render
+
+// Register a display. The Display must outlive the coordinator (make
+// it static). Registration order breaks ties, so add the cheap,
+// important ones first. Returns false if the table is full.
+bool frames_add(const Display* display);
+
+// Offer every display a slot. Register as one render task at the
+// control rate — it fills the time left before the next control tick.
+void frames_run();
+
+// ── Diagnostics ────────────────────────────────────────────────────────
+struct FrameStats {
+    const char* name;
+    uint32_t    frames;       // Renders
+    uint32_t    missed;       // Ticks it wanted a frame and didn't fit
+    uint32_t    forced;       // Renders past the deadline after missing too many
+    uint32_t    costUs;       // Current cost estimate
+};
+
+uint8_t frames_count();
+bool    frames_stats(uint8_t index, FrameStats& out);
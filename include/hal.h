@@ -0,0 +1,85 @@
+// hal.h — The handful of platform calls the control core uses
+//
+// The pure logic — baseline filtering, the simulation, the fire and
+// graph kernels — only needs a clock, a random number generator and a
+// few Arduino helpers. Routing those through here (instead of calling
+// millis()/random() directly) keeps that code free of the Teensy core,
+// so it can be compiled on a desktop machine for profiling or for
+// checking a change against recorded data.
+//
+// On the device (ARDUINO is defined by the toolchain) everything just
+// forwards to the Arduino core and costs nothing. Otherwise the C++
+// standard library stands in. In Python terms:
+//
+//   try:    from arduino import millis, random
+//   except ImportError:
+//           from time import monotonic_ns ...   # host fallback
+
+#pragma once
+
+#if defined(ARDUINO)
+
+#include <Arduino.h>
+
+inline uint32_t hal_millis() { return millis(); }
+inline uint32_t hal_micros() { return micros(); }
+
+// Random integer in [lo, hi), like Arduino's random(lo, hi)
+inline long hal_random(long lo, long hi) { return random(lo, hi); }
+inline void hal_random_seed(uint32_t seed) { randomSeed(seed); }
+
+#else   // Host build
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <chrono>
+#include <random>
+
+// The Arduino constants and helpers config.h and the core modules use
+#ifndef HIGH
+#define HIGH 1
+#define LOW  0
+#endif
+#ifndef A0
+#define A0 14
+#endif
+// The body sensor inputs (ECG_PIN, GSR_PIN in config.h)
+#ifndef A10
+#define A10 24
+#define A11 25
+#endif
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+inline long map(long x, long inMin, long inMax, long outMin, long outMax)
+{
+    return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+inline uint32_t hal_micros()
+{
+    using namespace std::chrono;
+    static const steady_clock::time_point start = steady_clock::now();
+    return (uint32_t)duration_cast<microseconds>(steady_clock::now() - start).count();
+}
+
+inline uint32_t hal_millis() { return hal_micros() / 1000; }
+
+inline std::minstd_rand& hal_rng()
+{
+    static std::minstd_rand rng(1);
+    return rng;
+}
+
+inline long hal_random(long lo, long hi)
+{
+    if (hi <= lo) return lo;
+    return lo + (long)(hal_rng()() % (unsigned long)(hi - lo));
+}
+
+inline void hal_random_seed(uint32_t seed) { hal_rng().seed(seed ? seed : 1); }
+
+#endif
@@ -0,0 +1,61 @@
+// heartbeat.h — Streaming R-peak detector for the ECG channel
+//
+// The demo displays pulse on sim_beat and show sim_bpm, which only the
+// simulator produces. This finds real heartbeats in the ECG channel
+// (sensor_channels.h) with the classic Pan-Tompkins chain, run one
+// sample at a time from the conversion interrupt:
+//
+//   ECG ─→ band-pass (5–15Hz) ─→ derivative ─→ square ─→ moving-window
+//          integrator (150ms) ─→ peak picking against an adaptive
+//          threshold ─→ beat, RR interval, BPM
+//
+// In Python terms:
+//
+//   for x in ecg:                      # every sample, in the ISR
+//       y = integrate(square(diff(bandpass(x))))
+//       if is_peak(y) and y > noise + (signal - noise) / 4:
+//           beat(); signal = 0.875 * signal + 0.125 * y
+//       elif is_peak(y):
+//           noise = 0.875 * noise + 0.125 * y
+//
+// Everything is integer arithmetic on fixed-size history buffers —
+// no floats and no allocation, so it costs the same on every sample.
+// Like the edge guard, it runs in the interrupt that produced the
+// sample, so a beat is published on the very sample that confirms it.
+// The filters themselves put the confirmation a fixed ~150ms behind
+// the R wave; that delay is the algorithm's, not the loop's.
+
+#pragma once
+
+#include "hal.h"
+#include "config.h"
+
+// The filter taps are the published ones for ~200–250Hz, so the 500Hz
+// ECG stream is averaged down in pairs first
+constexpr uint16_t HEARTBEAT_DETECT_HZ = 250;
+
+// Forget everything learned and start the 2s learning phase again.
+void heartbeat_reset();
+
+// ISR side: one ECG sample (0–ADC_MAX) at ECG_SAMPLE_HZ. Called from
+// the sensor channel interrupt.
+void heartbeat_feed(uint16_t sample);
+
+// ── Main-loop side ─────────────────────────────────────────────────────
+// Beats detected since boot. A reader keeps its own cursor, like the
+// sample rings.
+uint32_t heartbeat_count();
+
+// True (once) if there's been at least one beat since `cursor`, and
+// moves the cursor up to date. Call once per tick for a sim_beat-style
+// one-tick pulse.
+bool heartbeat_poll(uint32_t& cursor);
+
+// Heart rate over the last 8 beat intervals, or 0 before the first one.
+uint16_t heartbeat_bpm();
+
+// Eight beats in a row within 20% of the average interval, the latest
+// within the last 2s — the signal looks like a real heart and is still
+// there. A floating input produces plenty of "beats", but not steady
+// ones.
+bool heartbeat_locked();
@@ -0,0 +1,96 @@
+// i2c_bus.h — Interrupt-driven, queued I2C transactions on the Wire bus
+//
+// The OLED and the alphanumeric display share the Wire bus (LPI2C1,
+// pins 18/19), and Wire only does blocking transfers: every byte is
+// clocked out while the CPU waits. Each new I2C device would add its
+// transfer time straight onto whichever task talks to it.
+//
+// This module takes over the bus once the devices have been set up
+// and runs it from the LPI2C interrupt instead. Callers SUBMIT a
+// transaction and return immediately; the interrupt feeds the
+// controller's FIFO, collects any read bytes, and moves on to the next
+// queued transaction by itself.
+//
+// In Python terms:
+//
+//   bus.submit(addr, data)                    # returns at once
+//   bus.submit(addr, reg, read=2, done=cb)    # cb(status) later
+//
+// Write data is copied into the queue, so display writes are
+// fire-and-forget: the caller's buffer can be reused straight away.
+// Read buffers are filled in place and must stay valid until the
+// completion callback (or i2c_busy(id) going false).
+//
+// ── Priority ───────────────────────────────────────────────────────────
+// Each transaction carries a priority. When the bus comes free, the
+// highest-priority waiting transaction goes next (oldest first
+// within a priority), so a sensor read queued behind a whole OLED
+// frame goes out after the current transfer, not after the frame.
+// Nothing is interrupted mid-transaction, so big writers should keep
+// their transactions short (the OLED sends 32-byte chunks).
+//
+// The last I2C_SENSOR_RESERVED queue slots only take sensor-priority
+// transactions, so a screen full of OLED chunks can never lock a
+// sensor read out of the queue.
+//
+// ── Hand-over ──────────────────────────────────────────────────────────
+// The device libraries (U8g2, Adafruit LED Backpack) still use Wire for
+// their init sequences. Call i2c_bus_begin() AFTER those, and don't
+// call Wire (or anything that uses it) afterwards — the two would be
+// fighting over the same controller.
+
+#pragma once
+
+#include <Arduino.h>
+
+enum I2cPriority : uint8_t {
+    I2C_PRIO_DISPLAY = 0,     // Fire-and-forget screen updates
+    I2C_PRIO_SENSOR  = 1      // Reads the control loop is waiting on
+};
+
+enum I2cStatus : uint8_t {
+    I2C_OK = 0,
+    I2C_NACK,                 // Device didn't acknowledge
+    I2C_ERROR                 // Arbitration lost, FIFO error, bus stuck
+};
+
+// Completion callback. Runs in INTERRUPT context — keep it tiny.
+typedef void (*I2cDoneFn)(I2cStatus status, void* ctx);
+
+constexpr uint8_t  I2C_QUEUE_LEN  = 16;   // Transactions waiting at once
+constexpr uint8_t  I2C_MAX_WRITE  = 40;   // Bytes copied per transaction
+constexpr uint16_t I2C_MAX_READ   = 256;  // One LPI2C receive command
+constexpr uint8_t  I2C_SENSOR_RESERVED = 4;
+
+// Take over the Wire bus. Wire.begin() and Wire.setClock() must already
+// have run (they set up the pins and bus timing this reuses).
+void i2c_bus_begin();
+
+// Has i2c_bus_begin() run? Before then, devices still use Wire directly.
+bool i2c_bus_active();
+
+// Queue a transaction: write `txLen` bytes (copied), then — if rxLen
+// is non-zero — a repeated start and read `rxLen` bytes into `rx`.
+// Returns a ticket >= 0, or -1 if the queue is full (for this
+// priority), the sizes are out of range, or the bus hasn't been taken
+// over yet — the transaction is simply not sent.
+int16_t i2c_submit(uint8_t addr, const uint8_t* tx, uint8_t txLen,
+                   uint8_t* rx, uint16_t rxLen, I2cPriority priority,
+                   I2cDoneFn done = nullptr, void* ctx = nullptr);
+
+// Write-only shorthand.
+inline int16_t i2c_write(uint8_t addr, const uint8_t* data, uint8_t len,
+                         I2cPriority priority = I2C_PRIO_DISPLAY)
+{
+    return i2c_submit(addr, data, len, nullptr, 0, priority);
+}
+
+// Is a ticket from i2c_submit() still queued or on the wire?
+bool i2c_busy(int16_t ticket);
+
+// Queue slots currently free (including the sensor-only ones).
+uint8_t i2c_free_slots();
+
+// ── Diagnostics ────────────────────────────────────────────────────────
+uint32_t i2c_completed();
+uint32_t i2c_failures();      // NACKs + errors
@@ -0,0 +1,64 @@
+// input_events.h — Interrupt-driven button input as a stream of events
+//
+// The nav switch and the encoder button used to be POLLED once per
+// 60Hz tick, with the nav switch needing 3 matching polls to accept a
+// change. That's up to ~50ms before a press registers, and a tap
+// shorter than that could be missed entirely.
+//
+// Now every pin fires an interrupt on each edge. The interrupt
+// debounces by TIME — the first edge is accepted at once, and further
+// edges on that pin are ignored for INPUT_DEBOUNCE_US while the
+// contacts settle — and pushes a timestamped press/release event into
+// a queue. The control task drains the queue each tick, so every
+// press arrives exactly once, in order, however short it was.
+//
+// In Python terms:
+//
+//   def on_pin_change(pin):             # interrupt
+//       if now - last_edge[pin] >= DEBOUNCE:
+//           events.put(Event(pin, pressed=pin.low, t=now))
+//
+//   while (ev := events.get_nowait()): handle(ev)   # control tick
+//
+// The rotary encoder itself is already interrupt-driven (the Encoder
+// library counts quadrature edges in its own ISR) — this covers the
+// switches.
+
+#pragma once
+
+#include <Arduino.h>
+#include "nav_switch.h"
+
+// Edges closer together than this on one pin are contact bounce.
+constexpr uint32_t INPUT_DEBOUNCE_US = 5000;
+
+constexpr uint16_t INPUT_QUEUE_LEN = 32;   // Power of two
+
+enum InputSource : uint8_t {
+    INPUT_NAV,             // 5-way switch — see `dir`
+    INPUT_ENC_BUTTON       // Encoder push button
+};
+
+struct InputEvent {
+    uint32_t     timeMs;   // millis() at the accepted edge
+    InputSource  source;
+    NavDirection dir;      // NAV_NONE for the encoder button
+    bool         pressed;  // true = press, false = release
+};
+
+// Attach the pin interrupts. Call once from setup(), after nav_init()
+// and button_init() have configured the pins.
+void input_init();
+
+// Catch up on pins whose last edge fell inside the debounce window
+// (e.g. a release during the bounce of a very quick tap), so the
+// stored state always ends up matching the pin. Call once per control
+// tick, before draining.
+void input_service();
+
+// Take the next event off the queue. Returns false when it's empty.
+// Call from the control task only — it's the queue's one consumer.
+bool input_next_event(InputEvent& ev);
+
+// Events lost because the queue was full (should stay 0)
+uint32_t input_dropped();
@@ -0,0 +1,63 @@
+// lcd_ui.h — Retained-mode widgets with dirty-rectangle updates
+//
+// The fire effect can afford to resend the whole screen because it
+// changes everywhere every frame. A dashboard doesn't: a motor
+// percentage going from 41 to 42 changes one digit, about 12×16
+// pixels out of 67,200. Resending 134KB for that would eat most of
+// the SPI bus at 60Hz.
+//
+// This layer keeps a small list of widgets (text labels and bar
+// gauges), each of which knows its own rectangle and what it last
+// drew. Setting a new value records only the part that CHANGED as a
+// dirty rectangle. lcd_ui_tick() merges nearby dirty rectangles and
+// streams them to the LCD one at a time, rendering straight from the
+// widget state into the strip buffers — no frame buffer anywhere.
+//
+// In Python terms it's like a tiny React:
+//
+//   label.text = "42%"      # just updates the model, marks "2" dirty
+//   ui.tick()               # redraws only the dirty rectangles
+//
+// Setters can be called at any time, even mid-transfer. New values
+// are held as "pending" and only become visible (and get diffed) in
+// lcd_ui_tick() when the LCD is idle, because the DMA interrupt reads
+// the visible state while a rectangle is going out.
+//
+// Colours are plain RGB565 (like lcd_fill), swapped internally.
+
+#pragma once
+
+#include <Arduino.h>
+
+constexpr uint8_t LCD_UI_MAX_WIDGETS = 12;
+constexpr uint8_t LCD_UI_MAX_TEXT    = 16;   // Characters per label
+constexpr uint8_t LCD_UI_MAX_DIRTY   = 8;    // Rectangles queued at once
+
+// Remove every widget and queue a full-screen redraw in `background`.
+// Call when entering a screen, then add that screen's widgets.
+void lcd_ui_reset(uint16_t background);
+
+// Add a text label at (x, y). Each character is 6×8 pixels times
+// `scale` (1 = the matrix font at native size). The label is sized
+// for `maxChars` characters. Returns the widget id, or -1 if full or
+// off-screen.
+int8_t lcd_ui_add_label(uint16_t x, uint16_t y, uint8_t maxChars, uint8_t scale,
+                        uint16_t fg, uint16_t bg);
+
+// Add a horizontal bar gauge filling left-to-right as its value rises.
+// Returns the widget id, or -1 if full or off-screen.
+int8_t lcd_ui_add_bar(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+                      uint16_t fg, uint16_t bg);
+
+// Update a label's text (copied; truncated to the label's maxChars).
+void lcd_ui_set_text(int8_t id, const char* text);
+
+// Update a bar to value / maxValue (clamped to 0..1).
+void lcd_ui_set_value(int8_t id, int32_t value, int32_t maxValue);
+
+// Apply pending changes and send the next dirty rectangle if the LCD
+// is free. Cheap when there's nothing to do — call every render tick.
+void lcd_ui_tick();
+
+// True while any change is still waiting to reach the screen.
+bool lcd_ui_pending();
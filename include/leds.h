@@ -1,4 +1,8 @@
-// leds.h — LED drawing functions interface
+// leds.h — LED ring drawing functions and output
+//
+// Drawing (draw_bars_3 and friends) only writes into leds[]. Getting
+// the frame onto the ring is leds_show()'s job, which hands it to a
+// DMA engine instead of bit-banging it like FastLED.show() does.
 
 #pragma once
 
@@ -13,4 +17,22 @@ extern CRGB leds[];
 
 void draw_cursor(int pos, CRGB C1);
 void draw_cursor_3(int pos, CRGB C1, CRGB C2, CRGB C3);
-void draw_bars_3(int pos, CRGB C1, CRGB C2, CRGB C3);
\ No newline at end of file
+void draw_bars_3(int pos, CRGB C1, CRGB C2, CRGB C3);
+
+// ── Output ─────────────────────────────────────────────────────────────
+
+// Set up the DMA output on LED_PIN. Call once from setup().
+void leds_init();
+
+// Send leds[] to the ring if it changed since the last send. Copies the
+// frame and returns straight away — the ~0.7ms transfer runs from DMA
+// with interrupts left on. Returns true if a transfer was started.
+bool leds_show();
+
+// True while the last frame is still going out by DMA.
+bool leds_busy();
+
+// Overall ring brightness (0–255), on top of the colour correction.
+// Starts at BRIGHTNESS; the saved setting replaces it at boot.
+void    leds_set_brightness(uint8_t brightness);
+uint8_t leds_brightness();
@@ -15,23 +15,37 @@
 // In Python terms, the data flow is:
 //
 //   history = deque(maxlen=24)     # one value per column
-//   every 500ms:
+//   every 90ms:
 //       history.append(current_arousal)
-//   every frame:
 //       for col, value in enumerate(history):
 //           age = 23 - col
-//           draw_column(col, value, dim_factor=age)
+//           draw_column(col, LUT[value][age])
+//   any other frame:
+//       redraw the newest column, if its height changed
 
 #pragma once
 
-#include <Arduino.h>
+#include "hal.h"
 #include "HT1632C_Display.h"
 
-// Clear the history buffer. Call once from setup().
+// Clear the history buffer and build the column lookup table.
+// Call once from setup().
 void matrix_graph_init();
 
+// The screen byte for a bar of `height` (0–8) rows, `age` columns in
+// from the right edge — the table entry a redraw uses. For the host
+// tests (test/test_native), which check it against a golden copy.
+uint8_t matrix_graph_column(uint8_t height, uint8_t age);
+
+// Redraw every column on the next tick. Call when taking the matrix 
+// back from something else (scrolling text) — the graph otherwise 
+// only redraws what it changed itself.
+void matrix_graph_invalidate();
+
 // Call every main loop tick (~60Hz). Manages its own scroll timing 
 // internally — safe to call every frame without flooding the display.
+// Between shifts it does nothing beyond the input smoothing unless 
+// the newest bar's height changes.
 //
 // arousalDelta:  pressure - averagePressure (the signal the edging 
 //                algorithm watches). Can be negative; clamped to 0.
@@ -0,0 +1,59 @@
+// memory_diag.h — Where the RAM went, and how deep the stack has been
+//
+// The Teensy 4.0's 1MB of RAM is two very different halves:
+//
+//   RAM1  512K of "tightly coupled" memory, single-cycle, split at link
+//         time into 32K banks of code (ITCM: .text and FASTRUN) and data
+//         (DTCM: globals, statics and the stack). Whatever code doesn't
+//         use is data's, and the stack is whatever's left after that.
+//   RAM2  512K OCRAM on the bus, cached. DMAMEM buffers sit at the
+//         bottom, malloc's heap takes the rest.
+//
+// So every static buffer added to RAM1 comes straight out of stack
+// headroom, and an overflowing stack doesn't crash — it quietly tramples
+// the top of .bss. This module reads the linker's section boundaries
+// and measures the stack by "painting": at boot the unused part of the
+// stack is filled with a known word, and later the lowest word that's
+// been overwritten shows how deep the stack has ever gone.
+//
+// In Python terms the painting is:
+//
+//   stack[:] = [0xC0FFEE] * len(stack)            # at boot
+//   ...
+//   peak = len(stack) - stack.index(first_not(0xC0FFEE))
+//
+// Send 'p' over USB serial for the report, next to the profiler's.
+
+#pragma once
+
+#include <Arduino.h>
+
+struct MemoryStats {
+    // RAM1 (FlexRAM)
+    uint32_t itcmBytes;        // Banks given to code
+    uint32_t codeBytes;        // .text + FASTRUN actually in them
+    uint32_t dataBytes;        // Initialised globals (.data)
+    uint32_t bssBytes;         // Zeroed globals and statics (.bss)
+    uint32_t stackBytes;       // Everything from the end of .bss up
+    uint32_t stackPeakBytes;   // Deepest the stack has been since boot
+
+    // RAM2 (OCRAM)
+    uint32_t dmamemBytes;      // DMAMEM buffers
+    uint32_t heapUsedBytes;    // Allocated by malloc/new right now
+    uint32_t heapFreeBytes;    // Still available to malloc
+
+    uint32_t flashBytes;       // Program image in flash
+};
+
+// Paint the unused stack. Call first thing in setup(), while the stack
+// is still shallow — anything painted over later counts as used.
+void memory_init();
+
+// Section sizes and the current high-water mark. The stack scan walks
+// up from the end of .bss, so this takes a few hundred microseconds at
+// most — fine for a report, not for every tick.
+MemoryStats memory_stats();
+
+// ── Diagnostics ────────────────────────────────────────────────────────
+// Print the [Memory] lines.
+void memory_report(Print& out);
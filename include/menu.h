@@ -50,19 +50,18 @@ enum AppState : uint8_t {
 // Set up the menu system. Call once from setup().
 void menu_init();
 
-// Process a nav switch direction and return the resulting app state.
+// Process a nav switch PRESS and return the resulting app state.
 //
 // If the user just moves the cursor, this returns APP_MENU (stay here).
 // If they press center on an item, it returns that item's target state
 // (e.g. APP_RUNNING for "Start").
 //
-// Edge detection is handled internally — holding a direction doesn't 
-// repeat. You need to release and press again to move further.
+// Call once per press event (input_events.h) — holding a direction 
+// doesn't repeat. You need to release and press again to move further.
 AppState menu_update(NavDirection dir);
 
 // Draw the current menu state to the OLED display.
-// Call this from the main loop when in APP_MENU state.
-// Rendering is throttled internally (won't hog I2C bandwidth).
+// Called from the OLED render task, which sets the refresh rate.
 void menu_render();
 
 // Reset the cursor to the top item. Call this when returning to the 
@@ -18,4 +18,8 @@ void run_opt_rampspd();
 void run_opt_beep();
 void run_opt_pres();
 void run_opt_userModeChange();
-void run_standby();
\ No newline at end of file
+void run_standby();
+
+// Edges run_auto() has handled since boot (for diagnostics and the
+// replay engine's per-userMode summaries).
+uint32_t auto_edge_count();
@@ -3,14 +3,85 @@
 #pragma once
 
 #include <Arduino.h>
+#include "fixed.h"
 
-// Play a three-tone beep sequence through the motor.
+// Play a three-tone beep sequence (250ms per note) through the motor.
 // Uses tone() so the motor itself acts as a crude speaker.
+// Non-blocking: the notes are queued and played by motor_tone_tick().
+// Ignored if a sequence is already playing.
 void beep_motor(int f1, int f2, int f3);
 
-// Safe wrapper for writing motor speed. Keeps the PWM write 
-// in one place so it's easy to add logging or safety checks later.
+// Queue one note (freq 0 = rest). Returns false if the queue is full.
+bool motor_tone_queue(uint16_t freq, uint16_t durationMs);
+
+// Advance the tone sequencer. Call on every pass of loop() — it only 
+// does work when a note's time is up. When the last note ends, the 
+// engine gets the pin back.
+void motor_tone_tick();
+
+// True while a sequence is queued or playing.
+bool motor_tone_busy();
+
+// ── Output engine ─────────────────────────────────────────────────────
+// The motor is driven from a 1kHz hardware timer, not from the mode 
+// code's 60Hz tick. Modes say where the motor should go and how fast; 
+// the engine moves it there a millisecond at a time, so a ramp stays 
+// smooth however long the displays or the SD card hold up the loop.
+//
+//   motor_engine_set(target=200, rise=25.5/s)   # ramp up over ~8s
+//   motor_engine_cut(hold_ms=5000)              # off now, back after 5s
+//
+// Levels are perceived INTENSITY, 0–255 (Q16.16, fixed.h). 0 is off; 
+// anything above it goes through a calibration table (MOTOR_LUT in 
+// motor.cpp) that starts at MOT_MIN, the lowest PWM the motor spins 
+// at, so equal steps in level feel like equal steps on the body.
+
+// Head for `target` at `risePerSec` going up and `fallPerSec` going 
+// down (0 = jump straight there). Takes effect on the next 1ms step; 
+// calling it every tick with the same values is free.
+void motor_engine_set(q16_t target, q16_t risePerSec, q16_t fallPerSec);
+
+// Cooldown: output off immediately, held off for holdMs, then ramped 
+// back up from 0 toward the target. Calling it again while holding 
+// restarts the hold — so "cut every tick over the limit" keeps the 
+// motor off until the pressure drops, then times the cooldown.
+// Also clears an emergency cut (motor_emergency_cut), in the same 
+// step as the hold takes over, so the edge guard's cut hands straight 
+// on to the cooldown with no 1ms gap in between.
+void motor_engine_cut(uint32_t holdMs);
+
+// True during a motor_engine_cut() hold.
+bool motor_engine_holding();
+
+// Current level (before calibration), for displays and logging.
+q16_t motor_engine_level();
+
+// Step the engine by hand. Only does anything in dry run, where the 
+// timer leaves it alone — the replay engine calls this once per 
+// simulated tick, so the real ramps run faster than real time.
+void motor_engine_advance(uint32_t ms);
+
+// Jump straight to an intensity (0–255) with no ramp. Used by the 
+// modes where the knob sets the speed directly, and to stop the motor.
+// While an emergency cut is latched, the output stays at 0.
 void motor_write(int speed);
 
-// Set up motor pin and PWM prescaler. Called from setup().
+// ISR-safe: kill the motor PWM immediately and latch it off until 
+// motor_release_cut(). Used by the edge guard (edge_guard.h).
+// Also abandons any beep sequence in progress.
+void motor_emergency_cut();
+
+// Clear the emergency latch. The engine's level was dropped to 0 by 
+// the cut, so the motor ramps back from off.
+void motor_release_cut();
+
+// Dry run: while on, the engine and motor_emergency_cut() keep all
+// their bookkeeping but never touch the pin, and the engine only moves
+// when motor_engine_advance() is called. Used by the replay engine
+// (session_replay.h) to run the real mode code without the motor.
+// The pin is left at 0 for the duration.
+void motor_set_dry_run(bool enable);
+
+// Set up motor pin and PWM prescaler, and start the engine's timer. 
+// Called from setup().
 void motor_init();
\ No newline at end of file
@@ -46,15 +46,11 @@ enum NavDirection : uint8_t {
 
 // ── Public interface ───────────────────────────────────────────────────
 
-// Configure pins. Call once from setup().
+// Configure pins. Call once from setup(), before input_init().
 void nav_init();
 
-// Poll the switch and return which direction is currently pressed.
-// Returns NAV_NONE if nothing is pressed.
-// Call this once per main loop tick — the 60Hz sample rate provides
-// natural debouncing since mechanical switch bounce is typically <10ms
-// and our sample period is ~16ms.
-NavDirection nav_read();
+// Presses and releases arrive as events from input_events.h — the
+// pins are interrupt-driven and debounced there.
 
 // Get a human-readable string for a direction (for display/debug).
 // Returns a pointer to a string literal, e.g. "Up", "Center", "None".
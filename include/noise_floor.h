@@ -0,0 +1,67 @@
+// noise_floor.h — Streaming statistics of the pressure delta
+//
+// The edge threshold (pressureLimit) is a distance above the baseline,
+// and the right distance depends on how noisy the sensor is today: plug
+// fit, tube length and the gain trimpot all move it, so the knob gets
+// re-tuned every session. NoiseFloor watches the same delta the edge
+// guard checks (sample - baseline) and keeps three numbers, all in ADC
+// counts:
+//
+//   mean       What the delta sits at when nothing is happening
+//   deviation  How far it wanders from that (standard deviation)
+//   peak       The highest it has reached recently, decaying back
+//              toward the mean over the window — the top of the noise
+//
+// User mode 7 puts the threshold a few deviations above that peak.
+//
+// The mean and variance are Welford's running update for the first
+// window of samples, then the exponentially weighted form of the same
+// update, so old samples fade out and it follows drift. In Python:
+//
+//   n += 1
+//   a = 1 / min(n, window)
+//   d = x - mean
+//   mean += a * d
+//   var = (1 - a) * (var + a * d * d)
+//
+// Samples far outside the noise (an actual clench) are left out, so an
+// edge doesn't raise the threshold for the next one. Constant memory,
+// integer-only updates, safe to call from an ISR.
+
+#pragma once
+
+#include "hal.h"
+
+class NoiseFloor {
+public:
+    // windowSamples: how many samples the statistics cover
+    explicit NoiseFloor(uint32_t windowSamples);
+
+    // Forget everything and start the first window again, optionally
+    // at a new length (a different sample rate).
+    void reset();
+    void reset(uint32_t windowSamples);
+
+    // Feed one delta (sample - baseline), in ADC counts.
+    void update(int32_t delta);
+
+    // A full window has been seen — until then the numbers are still
+    // settling and shouldn't steer anything.
+    bool primed() const { return _primed; }
+
+    // Main-loop side. Each is a single 32-bit read, so they're safe
+    // against the ISR, though not a matched set to the sample.
+    float mean() const      { return _meanQ16 / 65536.0f; }
+    float deviation() const;
+    float peak() const      { return _peakQ16 / 65536.0f; }
+
+private:
+    uint8_t  _shift;           // Window = 2^shift samples
+    uint32_t _count = 0;
+    uint64_t _varQ16 = 0;      // ISR-private; published as _varQ8
+
+    volatile bool     _primed = false;
+    volatile int32_t  _meanQ16 = 0;
+    volatile int32_t  _peakQ16 = 0;
+    volatile uint32_t _varQ8 = 0;
+};
@@ -16,10 +16,24 @@
 // Initialize the display hardware. Called once from setup().
 void display_init();
 
+// ── Sending ────────────────────────────────────────────────────────────
+// The display_* draw functions below only draw into RAM and note 
+// which 8×8 tiles changed since the panel was last updated. This hands 
+// the changed tiles to the I2C bus manager (i2c_bus.h) in small 
+// chunks, without waiting for them to go out, until the bus queue is 
+// full. Returns true if there's more left for the next call.
+//
+// Call it often (every tick) so a big change drains over a few 
+// ticks; call the draw functions at whatever rate the screen needs.
+bool display_service();
+
+// True while changed tiles are still waiting to be sent.
+bool display_pending();
+
 // ── Operational display ────────────────────────────────────────────────
 // Refresh the display with current state values.
 // Call this from the main loop when in APP_RUNNING state.
-// Throttled internally — safe to call every tick.
+// Draws a frame and queues the parts that changed (display_service).
 void display_update(uint8_t mode, float motorSpeed, int pressure, int averagePressure, NavDirection navDir);
 
 // ── Menu display ───────────────────────────────────────────────────────
@@ -32,14 +46,14 @@ void display_update(uint8_t mode, float motorSpeed, int pressure, int averagePre
 //   itemCount — how many items in the array
 //   cursorPos — which item is highlighted (0-indexed)
 //
-// Throttled internally — safe to call every tick.
+// Draws a frame and queues the parts that changed (display_service).
 void display_menu(const char* title, const char* items[], uint8_t itemCount, uint8_t cursorPos);
 
 // ── Message display ────────────────────────────────────────────────────
 // Draw a simple two-line centred message. Useful for placeholder 
 // screens (Settings, Demo) before their full UI is built out.
 //
-// Throttled internally — safe to call every tick.
+// Draws a frame and queues the parts that changed (display_service).
 void display_message(const char* title, const char* message);
 
 void display_demo_water(float gsr);
\ No newline at end of file
@@ -0,0 +1,42 @@
+// power.h — Sleep between scheduler passes, slower clock when idle
+//
+// loop() used to spin: pass after pass of "is anything due yet? no",
+// with the M7 flat out at 600MHz for a few percent of useful work. On a
+// battery that's most of the runtime, and the heat sits right next to
+// the pressure sensor.
+//
+// Now, once a pass has run everything that was due, loop() asks the
+// scheduler how long until the next task wants the CPU and sleeps for
+// that long. A one-shot timer is set for the moment the task is due,
+// and the core waits for an interrupt (WFI) — that timer's, or any of
+// the others that keep running underneath: the ADCs, the motor engine,
+// the LED and LCD DMA, USB. Whatever wakes it, the pass runs exactly
+// as it would have; sleep is only ever the gap between passes.
+//
+// In Python terms:
+//
+//   while True:
+//       scheduler.run()
+//       time.sleep(scheduler.idle_seconds())   # instead of `pass`
+//
+// On the menu and in STANDBY there's barely anything to do, so the CPU
+// clock can drop as well (POWER_IDLE_CPU_HZ in config.h).
+
+#pragma once
+
+#include <Arduino.h>
+
+// Sleep for up to `us` microseconds, or until any interrupt. Returns
+// straight away for gaps too short to be worth it.
+void power_idle(int32_t us);
+
+// Run the CPU at POWER_IDLE_CPU_HZ (true) or full speed (false). Only
+// touches the clock when the choice changes, so call it every tick.
+void power_set_low_clock(bool low);
+
+// ── Diagnostics ────────────────────────────────────────────────────────
+// Share of the time spent asleep since the last call, in percent.
+uint8_t power_sleep_percent();
+
+// Current CPU clock in MHz.
+uint32_t power_cpu_mhz();
@@ -1,16 +1,46 @@
-// pressure.h — Pressure reading and running average interface
+// pressure.h — Pressure reading and baseline interface
+//
+// update_pressure() fills the pressure and averagePressure globals
+// that the modes read. WHERE those numbers come from is pluggable: 
+// normally the background ADC, but it can also be the demo simulation 
+// or a recorded session (session_replay.h), so the real run_auto() can 
+// be tested against any of them. In Python terms:
+//
+//   source = LiveSource()          # or SimSource(), ReplaySource(f)
+//   pressure, average = source.read_tick()
 
 #pragma once
 
 #include <Arduino.h>
 
-// Call once per main loop tick. Handles sampling the ADC and 
-// updating the running average at the correct sub-frequency.
-// sampleTick is the main loop's tick counter.
-void update_pressure(int sampleTick);
+// A pressure source produces one tick's worth of pressure and baseline.
+// It is also responsible for feeding the edge guard with every sample
+// it covers (the live source leaves that to the ADC interrupt).
+// read_tick returns false when the source has run out — the end of a 
+// recording.
+struct PressureSource {
+    const char* name;
+    bool (*read_tick)(int& pressure, int& baseline);
+};
 
-// Read the raw pressure sensor (4x oversampled).
+extern const PressureSource PRESSURE_SOURCE_LIVE;   // Background ADC
+extern const PressureSource PRESSURE_SOURCE_SIM;    // sim_tick()'s output
+
+// Switch source. Anything other than the live source also stops the
+// ADC interrupt feeding the edge guard, so only one thing drives it.
+void pressure_set_source(const PressureSource* source);
+const PressureSource* pressure_source();
+
+// Call once per main loop tick. Picks up this tick's sample and 
+// baseline from the current source into the pressure and 
+// averagePressure globals. Returns false if the source has run out 
+// (the globals are left as they were).
+bool update_pressure();
+
+// Latest raw pressure sample from the background ADC (hardware 
+// averaged and decimated). Non-blocking — safe to call any time.
 // Separated out so it can also be used in the debug display mode.
 int read_pressure_raw();
 
+// Start the background ADC (and with it the baseline filter).
 void pressure_init();
\ No newline at end of file
@@ -0,0 +1,70 @@
+// pressure_sampler.h — Background, timer-driven pressure acquisition
+//
+// The pressure sensor used to be read on demand: four analogRead()
+// calls with delay(1) between them, every 60Hz tick. That blocked the
+// main loop for ~4ms per frame and meant the sensor was only sampled
+// when the rest of the UI happened to be ready.
+//
+// Now the ADC runs on its own. A hardware timer triggers a conversion
+// ADC_SAMPLE_RATE_HZ times a second, the ADC's built-in averaging
+// smooths each conversion over OVERSAMPLE readings, and the
+// conversion-complete interrupt decimates those into a steady
+// PRESSURE_SAMPLE_HZ stream that lands in a ring buffer.
+//
+// The main loop never waits on the ADC again. It just asks for the
+// latest sample (or drains the ring if it wants every one).
+//
+// In Python terms the old code was:
+//   p = sum(adc.read() for _ in range(4)) / 4   # blocks ~4ms
+// and the new one is:
+//   p = sampler.latest                          # instant
+// with a background thread filling `sampler` at 1kHz.
+
+#pragma once
+
+#include <Arduino.h>
+#include "config.h"
+
+// One entry in the sample stream: the decimated reading and the 
+// baseline as it stood when that reading arrived.
+struct PressureSample {
+    uint16_t raw;
+    uint16_t baseline;
+};
+
+// Microseconds between consecutive samples. Sample N was taken 
+// N × PRESSURE_SAMPLE_PERIOD_US after pressure_sampler_init().
+constexpr uint32_t PRESSURE_SAMPLE_PERIOD_US = 1000000UL / PRESSURE_SAMPLE_HZ;
+
+// Start the ADC timer and conversion interrupt. Called from pressure_init().
+void pressure_sampler_init();
+
+// Most recent decimated sample (0–ADC_MAX). Non-blocking.
+uint16_t pressure_sampler_latest();
+
+// Current pressure baseline (averagePressure), maintained by the ISR
+// at the full sample rate. See baseline_filter.h.
+uint16_t pressure_sampler_baseline();
+
+// Total decimated samples produced since init. A reader can start
+// with cursor = pressure_sampler_count() to only see new samples.
+uint32_t pressure_sampler_count();
+
+// Copy every decimated sample newer than `cursor` (up to maxCount)
+// into out[], oldest first, and advance the cursor. Returns the
+// number copied. Each consumer keeps its own cursor. If a reader 
+// falls more than a ring's worth behind, the oldest samples are lost 
+// and the cursor jumps forward — compare it before and after to spot 
+// the gap.
+uint16_t pressure_sampler_read(uint32_t& cursor, PressureSample* out, uint16_t maxCount);
+
+// The ADC library's driver object. The sensor channels 
+// (sensor_channels.h) use its second module; there must only be one 
+// of these, since constructing it resets both modules.
+class ADC;
+ADC& adc_driver();
+
+// Should the ISR hand every sample to the edge guard? On by default.
+// Switched off while another pressure source (pressure.h) is driving
+// the guard, so live samples can't trip it during a replay.
+void pressure_sampler_feed_guard(bool enable);
@@ -0,0 +1,81 @@
+// profiler.h — Per-module cycle counting with the DWT cycle counter
+//
+// The Cortex-M7 has a free-running 32-bit counter (DWT->CYCCNT) that 
+// ticks once per CPU clock — 600 million times a second on the 
+// Teensy 4.0. Reading it is a single load, so we can time a block of 
+// code down to the individual cycle with no measurable overhead.
+//
+// Wrap a call in a ProfileScope and the profiler records how long it 
+// took:
+//
+//   {
+//       ProfileScope prof(PROF_FIRE_TICK);
+//       fire_tick();
+//   }   // ← recorded here, when 'prof' goes out of scope
+//
+// In Python terms it's a context manager:
+//
+//   with profile("fire_tick"):
+//       fire_tick()
+//
+// For each section we keep min/avg/max and a log-scale histogram for 
+// the 99th percentile, plus a count of frames where the control tick 
+// started late (a "frame overrun"). Send 'p' over USB serial for a 
+// report, 'r' to reset the numbers (see serial_report.h).
+//
+// When PROFILER_ENABLED is false (config.h), ProfileScope is an empty 
+// object and every call below compiles away to nothing.
+
+#pragma once
+
+#include <Arduino.h>
+#include "config.h"
+
+enum ProfileSection : uint8_t {
+    PROF_UPDATE_PRESSURE,
+    PROF_STATE_MACHINE,
+    PROF_LEDS_SHOW,
+    PROF_MATRIX_SCROLL,
+    PROF_DISPLAY_UPDATE,
+    PROF_ALPHANUM,
+    PROF_FIRE_TICK,
+    PROF_REPORT_SERIAL,
+    PROF_SECTION_COUNT
+};
+
+// Enable the cycle counter (the Teensy core normally already has).
+void profiler_init();
+
+// Record one measurement. Normally called by ProfileScope.
+void profiler_record(ProfileSection section, uint32_t cycles);
+
+// Call at the start of every control tick. Counts a frame overrun 
+// whenever the gap since the previous tick is more than 10% over 
+// UPDATE_PERIOD_US.
+void profiler_frame_mark();
+
+// Print the per-section table and overrun count.
+void profiler_report(Print& out);
+
+// Zero every statistic.
+void profiler_reset();
+
+class ProfileScope {
+public:
+    explicit ProfileScope(ProfileSection section) : _section(section)
+    {
+        if constexpr (PROFILER_ENABLED) _start = ARM_DWT_CYCCNT;
+    }
+
+    ~ProfileScope()
+    {
+        if constexpr (PROFILER_ENABLED) profiler_record(_section, ARM_DWT_CYCCNT - _start);
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    ProfileSection _section;
+    uint32_t _start = 0;
+};
@@ -0,0 +1,83 @@
+// sample_ring.h — Fixed-size ring buffer filled from interrupt context
+//
+// A small template for streaming samples from an ISR (the producer) to
+// any number of main-loop readers (the consumers). The producer never
+// blocks and never waits: when the ring is full it simply overwrites
+// the oldest sample, like a chart recorder that keeps scrolling.
+//
+// Each reader keeps its OWN cursor — the total sample count it has
+// consumed up to. That way the serial reporter, a logger and a display
+// can all drain the same stream at their own pace without stealing
+// samples from each other.
+//
+// In Python terms it's like a collections.deque(maxlen=N) where every
+// consumer remembers "I've seen everything up to sample number X":
+//
+//   ring = deque(maxlen=N)
+//   new = [s for i, s in enumerate_with_global_index(ring) if i >= cursor]
+//   cursor = total_pushed
+//
+// THREAD SAFETY (single core, one ISR producer):
+//   - push() is only ever called from ONE interrupt handler
+//   - _head is volatile and is written AFTER the sample slot, with a
+//     compiler barrier in between, so a reader that sees the new head
+//     is guaranteed to see the sample it points at
+//   - a reader that falls more than N samples behind is snapped forward
+//     to the oldest sample still held — it loses data, but never reads
+//     a slot that is being overwritten mid-copy
+
+#pragma once
+
+#include <Arduino.h>
+
+template <typename T, uint16_t N>
+class SampleRing {
+    // Power-of-two size lets us wrap with a mask instead of a modulo.
+    // On the M7 that's one AND instead of a divide inside the ISR.
+    static_assert(N != 0 && (N & (N - 1)) == 0, "SampleRing size must be a power of two");
+
+public:
+    // Producer side — call from the ISR only.
+    void push(const T& sample)
+    {
+        _buf[_head & (N - 1)] = sample;
+        __asm__ volatile("" ::: "memory");  // Slot must land before head moves
+        _head = _head + 1;
+    }
+
+    // Total number of samples ever pushed. Wraps after ~49 days at 1kHz.
+    uint32_t count() const { return _head; }
+
+    // Most recent sample, or a default-constructed T if nothing yet.
+    T latest() const
+    {
+        uint32_t h = _head;
+        return h ? _buf[(h - 1) & (N - 1)] : T{};
+    }
+
+    // Copy up to maxCount samples that are newer than `cursor` into out[],
+    // oldest first, and advance the cursor past them. Returns how many
+    // samples were copied. Start a new reader with cursor = count().
+    uint16_t read(uint32_t& cursor, T* out, uint16_t maxCount) const
+    {
+        uint32_t h = _head;
+
+        // Reader fell too far behind — skip to the oldest sample we
+        // still hold. Leave one slot of slack for a push landing while
+        // we copy.
+        if (h - cursor > N - 1) cursor = h - (N - 1);
+
+        uint16_t n = 0;
+        while (cursor != h && n < maxCount) {
+            out[n++] = _buf[cursor & (N - 1)];
+            cursor++;
+        }
+        return n;
+    }
+
+    void clear() { _head = 0; }
+
+private:
+    T _buf[N] = {};
+    volatile uint32_t _head = 0;
+};
@@ -0,0 +1,92 @@
+// scheduler.h — Cooperative task scheduler with rates and budgets
+//
+// loop() used to do everything on one 60Hz tick, and every display
+// that was too slow for that grew its own millis() throttle. Now each
+// subsystem registers a task with its own period and a time budget,
+// and the scheduler decides what runs on each pass of loop().
+//
+// There are two classes of task:
+//
+//   TASK_CONTROL  Pressure, edge handling, motor, state machine.
+//                 Always run as soon as they're due, before anything
+//                 else.
+//
+//   TASK_RENDER   Displays, LEDs, serial output. Run only if their
+//                 budget fits in the time left before the next
+//                 control task is due. Otherwise they're deferred to
+//                 a later pass.
+//
+// A render task that has been waiting for a whole extra period runs
+// anyway, straight after the next control pass (when there's the
+// most slack available), so a slow display gets updated less often
+// but is never starved completely. If a task falls far enough
+// behind to miss whole periods, those periods are skipped — it
+// never runs twice in a row to "catch up".
+//
+// In Python terms it's a tiny, single-threaded asyncio loop:
+//
+//   for task in control_tasks:
+//       if task.due(): task.run()
+//   for task in render_tasks:
+//       if task.due() and task.budget <= time_until_next_control():
+//           task.run()
+//
+// Tasks are plain void() functions. Nothing is pre-empted — a task
+// that overruns its budget delays everything after it, so budgets
+// should be honest. Overruns are counted for diagnostics.
+
+#pragma once
+
+#include <Arduino.h>
+
+enum TaskClass : uint8_t {
+    TASK_CONTROL,
+    TASK_RENDER
+};
+
+typedef void (*TaskFn)();
+
+struct SchedulerTask {
+    const char* name;
+    TaskFn      fn;
+    uint32_t    periodUs;
+    uint32_t    budgetUs;
+    TaskClass   taskClass;
+
+    uint32_t    nextDueUs;     // micros() at which it's next due
+    bool        deferred;      // Already deferred during this period
+
+    // ── Diagnostics ───────────────────────────────────────────────────
+    uint32_t    runs;          // Times the task has run
+    uint32_t    deferrals;     // Periods where it had to wait for slack
+    uint32_t    skips;         // Whole periods dropped from falling behind
+    uint32_t    overruns;      // Runs that took longer than budgetUs
+    uint32_t    lastUs;        // Duration of the most recent run
+    uint32_t    maxUs;         // Longest run seen
+};
+
+constexpr uint8_t SCHEDULER_MAX_TASKS = 12;
+
+// Register a task. Tasks of the same class are considered in
+// registration order, so register render tasks most-important first.
+// Returns the task index, or -1 if the table is full.
+int8_t scheduler_add(const char* name, TaskFn fn, uint32_t periodUs,
+                     uint32_t budgetUs, TaskClass taskClass);
+
+// Run whatever is due. Call on every pass of loop().
+void scheduler_run();
+
+// Microseconds until the next control task is due (negative if one is
+// already late). For render tasks that share out their own time, like
+// the frame coordinator (frame_coordinator.h).
+int32_t scheduler_slack_us();
+
+// Microseconds until any task wants to run (0 if one is due now). A 
+// render task that is due but was deferred for lack of slack doesn't 
+// count: it waits for the next control pass anyway. loop() sleeps 
+// for this long between passes (power.h).
+int32_t scheduler_idle_us();
+
+// Diagnostics access. Returns nullptr for an out-of-range index.
+uint8_t scheduler_task_count();
+const SchedulerTask* scheduler_task(uint8_t index);
@@ -0,0 +1,92 @@
+// sensor_channels.h — Multi-rate body sensor channels (ECG, GSR)
+//
+// Pressure has its own sampler (pressure_sampler.h), built around the
+// edge guard. The next sensors — ECG and GSR — want very different
+// rates: an ECG needs a few hundred samples a second to catch each
+// QRS spike, while skin conductance barely changes in a tenth of a
+// second. Polling them from loop() would tie both to the 60Hz tick.
+//
+// Instead each channel declares its pin and sample rate, and a
+// hardware timer samples them all in the background on the second ADC
+// module. Every channel fills its own ring (sample_ring.h): one
+// producer (the interrupt), any number of readers with their own
+// cursors, no locks.
+//
+// In Python terms:
+//
+//   CHANNELS = [Channel("ecg", A10, 500), Channel("gsr", A11, 10)]
+//   ecg = sensors.view(SENSOR_ECG, out_hz=50)   # 10 samples averaged per output
+//   for v in ecg.read(): ...
+//
+// ── Time alignment ─────────────────────────────────────────────────────
+// All channels run off the same SENSOR_TICK_HZ timer, and each rate
+// divides it, so sample N of a channel was taken exactly
+// N × (1e6 / rate) µs after sensors_init() — see sensor_time_us().
+// If a conversion ever misses its slot, the previous value is repeated
+// rather than skipped, so that arithmetic never drifts.
+//
+// A SensorView decimates a channel to a lower rate (a box-car mean of
+// each block), with blocks that start on multiples of the output
+// period. So an ECG view and a GSR view at the same output rate cover
+// exactly the same time windows, sample for sample.
+
+#pragma once
+
+#include <Arduino.h>
+#include "config.h"
+
+enum SensorId : uint8_t {
+    SENSOR_ECG = 0,
+    SENSOR_GSR,
+    SENSOR_COUNT
+};
+
+struct SensorChannel {
+    const char* name;
+    uint8_t     pin;
+    uint16_t    rateHz;       // Must divide SENSOR_TICK_HZ
+};
+
+// Samples held per channel: ~2s of ECG, ~100s of GSR
+constexpr uint16_t SENSOR_RING_LEN = 1024;
+
+// Start the sample timer and the second ADC. Call once from setup().
+void sensors_init();
+
+const SensorChannel& sensor_channel(SensorId id);
+
+// ── Raw samples (0–ADC_MAX) ────────────────────────────────────────────
+uint16_t sensor_latest(SensorId id);
+
+// Total samples produced on this channel since init. Start a reader
+// with cursor = sensor_count(id) to only see new ones.
+uint32_t sensor_count(SensorId id);
+
+// Copy samples newer than `cursor` into out[], oldest first, and
+// advance the cursor. Same contract as SampleRing::read().
+uint16_t sensor_read(SensorId id, uint32_t& cursor, uint16_t* out, uint16_t maxCount);
+
+// micros() timestamp at which sample `index` of a channel was taken.
+uint32_t sensor_time_us(SensorId id, uint32_t index);
+
+// ── Decimated views ────────────────────────────────────────────────────
+struct SensorView {
+    SensorId id;
+    uint16_t factor;          // Channel samples per view sample
+    uint32_t cursor;          // Always a multiple of factor
+};
+
+// A view of a channel at outHz (rounded to a whole decimation factor,
+// and never above the channel's own rate), starting from the latest
+// complete block.
+SensorView sensor_view(SensorId id, uint16_t outHz);
+
+// Copy every complete block since the last call, averaged, into out[].
+// A view that falls a whole ring behind skips forward to the oldest
+// block still held.
+uint16_t sensor_view_read(SensorView& view, uint16_t* out, uint16_t maxCount);
+
+// ── Diagnostics ────────────────────────────────────────────────────────
+// Samples repeated because the ADC hadn't finished the previous tick's
+// conversions.
+uint32_t sensor_overruns();
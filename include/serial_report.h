@@ -4,9 +4,31 @@
 
 #include <Arduino.h>
 
-// Output current state over serial in CSV-like format.
-// Useful for external analysis tools or plotting.
-void report_serial();
+// What report_serial() sends. Selectable at run time from the serial 
+// console (see serial_poll_commands).
+enum ReportMode : uint8_t {
+    REPORT_OFF,      // Nothing (the default while DEBUG_MODE is on)
+    REPORT_TEXT,     // One CSV-like line per tick
+    REPORT_BINARY    // Framed records at the full sample rate (telemetry.h)
+};
+
+// Output current state over serial in the selected format.
+// Useful for external analysis tools or plotting. mode is the 
+// operational state, included in binary records.
+void report_serial(uint8_t mode);
+
+void serial_set_report_mode(ReportMode mode);
+ReportMode serial_report_mode();
+
+// Handle single-character commands from the USB serial console.
+// Non-blocking — only reads what's already arrived. Call every tick.
+//   'p'  profiler report (per-module timings), scheduler task table
+//        and the rest of the diagnostics, memory use included
+//   'r'  reset profiler statistics
+//   't'  text report          'b'  binary telemetry          'o'  reports off
+//   'R'  replay every userMode over the latest recorded session
+//   'S'  replay every userMode over 30 minutes of simulation
+void serial_poll_commands();
 
 void debug_print(const char* label, int value);
 void debug_print(const char* label, float value);
\ No newline at end of file
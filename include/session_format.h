@@ -0,0 +1,140 @@
+// session_format.h — SESSnnnn.BIN: the session recorder's file format
+//
+// The recorder (session_recorder.h) writes these files on the device;
+// the replay engine (session_replay.h) and the host tests read them
+// back through SessionDecoder below. Nothing here touches the card or
+// the Arduino core, so it builds on the host too (hal.h).
+//
+// ═══════════════════════════════════════════════════════════════════════
+// FILE FORMAT — SESSnnnn.BIN, a sequence of 512-byte sectors
+// ═══════════════════════════════════════════════════════════════════════
+//
+// Every sector starts with a RecorderSectorHeader (little-endian)
+// holding ABSOLUTE values, so each sector decodes on its own and a lost
+// sector costs only its own ~240ms. `sector` counts up from 0; a gap
+// means the card fell behind and sectors were dropped.
+//
+// The payload is `used` bytes of records, one per pressure sample
+// unless it starts with the escape byte 0x80:
+//
+//   dp dp          sample: int8 pressure delta (never -128),
+//                          int8 baseline delta
+//   80 01 P P B B  sample: absolute pressure, baseline (u16 each)
+//   80 02 L L M M  control: pressureLimit (u16), motor speed
+//         m u            (int16, Q11.4 — ×16), mode, userMode
+//   80 03 C C      edge: the guard tripped; minimumcooldown (u16)
+//   80 04 N N      gap: N samples were lost before the next one
+//
+// Sample k of a sector was taken (firstSample + k) ms after the
+// sampler started. Control and edge records apply from the next
+// sample onwards. In Python:
+//
+//   hdr = struct.unpack("<IIIIHHHhBBHH", sector[:30])
+//   crc_ok = crc16_ccitt(sector[:28] + sector[30:30 + used]) == hdr[-1]
+
+#pragma once
+
+#include "hal.h"
+
+constexpr uint16_t RECORDER_SECTOR_BYTES = 512;
+constexpr uint32_t RECORDER_MAGIC = 0x3153584E;       // "NXS1"
+
+struct __attribute__((packed)) RecorderSectorHeader {
+    uint32_t magic;
+    uint32_t sector;       // Index within the session
+    uint32_t firstSample;  // Sampler count of the first sample record
+    uint32_t timeMs;       // millis() when the sector was started
+    uint16_t pressure;     // Values the deltas in this sector start from
+    uint16_t baseline;
+    uint16_t limit;
+    int16_t  motorQ4;
+    uint8_t  mode;
+    uint8_t  userMode;
+    uint16_t used;         // Payload bytes after the header
+    uint16_t crc;          // CRC-16/CCITT of the header above + payload
+};
+
+static_assert(sizeof(RecorderSectorHeader) == 30, "RecorderSectorHeader must stay 30 bytes");
+
+constexpr uint16_t SESSION_PAYLOAD_BYTES = RECORDER_SECTOR_BYTES - sizeof(RecorderSectorHeader);
+
+// Record escape byte and opcodes (see the table above)
+constexpr uint8_t SESSION_ESCAPE        = 0x80;
+constexpr uint8_t SESSION_OP_SAMPLE_ABS = 0x01;
+constexpr uint8_t SESSION_OP_CONTROL    = 0x02;
+constexpr uint8_t SESSION_OP_EDGE       = 0x03;
+constexpr uint8_t SESSION_OP_GAP        = 0x04;
+
+// The same CRC layout the recorder seals with: the header up to (not
+// including) crc, then the payload
+uint16_t session_sector_crc(const uint8_t* sector, uint16_t used);
+
+// A whole sector from a file: right magic, a payload that fits, and a
+// CRC that matches. Copies the header out to `header` if given.
+bool session_sector_valid(const uint8_t* sector, RecorderSectorHeader* header = nullptr);
+
+struct SessionSample {
+    uint16_t raw;          // Pressure (0–ADC_MAX)
+    uint16_t baseline;
+};
+
+// Streams the samples back out of a file, one sector at a time. In 
+// Python terms:
+//
+//   for sector in file:
+//       if decoder.load(sector):
+//           while (s := decoder.next()) is not None: use(s)
+//
+// A damaged sector is refused by load() and the decoder carries on 
+// with the next one — its keyframe makes it decodable on its own. 
+// Lost samples (gap records) come back as the last value held, so 
+// sample count and time stay in step with the session.
+class SessionDecoder {
+public:
+    // Forget everything, ready for a new file.
+    void reset();
+
+    // Take the next RECORDER_SECTOR_BYTES of the file. Returns false 
+    // (and ignores it) if it isn't a valid session sector.
+    bool load(const uint8_t* sector);
+
+    // The next sample. false when the loaded sector is used up and 
+    // it's time to load() the next one.
+    bool next(SessionSample& out);
+
+    // Control values as of the last sample returned — from the 
+    // sector's keyframe or a later control record
+    uint16_t limit() const     { return _limit; }
+    int16_t  motorQ4() const   { return _motorQ4; }
+    uint8_t  mode() const      { return _mode; }
+    uint8_t  userMode() const  { return _userMode; }
+
+    // ── Counters, for reports and tests ──
+    uint32_t samples() const         { return _samples; }     // Including gap fill
+    uint32_t edges() const           { return _edges; }       // Edge records seen
+    uint32_t sectorsLoaded() const   { return _loaded; }
+    uint32_t sectorsRejected() const { return _rejected; }
+    uint32_t sectorsMissing() const  { return _missing; }     // Gaps in `sector`
+
+private:
+    uint8_t  _sector[RECORDER_SECTOR_BYTES];
+    uint16_t _pos = 0;
+    uint16_t _used = 0;
+    bool     _haveSector = false;
+    uint32_t _lastIndex = 0;
+
+    uint16_t _pressure = 0;
+    uint16_t _baseline = 0;
+    uint32_t _gapLeft = 0;
+
+    uint16_t _limit = 0;
+    int16_t  _motorQ4 = 0;
+    uint8_t  _mode = 0;
+    uint8_t  _userMode = 0;
+
+    uint32_t _samples = 0;
+    uint32_t _edges = 0;
+    uint32_t _loaded = 0;
+    uint32_t _rejected = 0;
+    uint32_t _missing = 0;
+};
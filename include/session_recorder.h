@@ -0,0 +1,80 @@
+// session_recorder.h — Compact binary session log on an SD card
+//
+// Telemetry (telemetry.h) streams every sample to a host, but only
+// while a laptop is plugged in and listening. To tune the userMode
+// strategies from real sessions we want the device to keep its own
+// record: every 1kHz pressure sample plus the control values and edge
+// events around it, for sessions lasting hours.
+//
+// Samples are delta-encoded — consecutive readings rarely move by more
+// than a few counts, so most samples cost 2 bytes (2KB/s, ~7MB an
+// hour). Records are built into 512-byte sectors in a RAM2 ring
+// buffer by the control task, which costs a few µs per tick. A
+// low-priority task later writes whole sectors to the card, one
+// aligned sector per write into a pre-allocated file, so the FAT
+// never has to be touched in the middle of a session.
+//
+// In Python terms:
+//
+//   ring.append(encode(sample))        # control task, cheap
+//   if ring.has_full_sector():         # recorder task, when idle
+//       f.write(ring.pop_sector())
+//
+// The file format, and the decoder that reads it back, are in
+// session_format.h.
+
+#pragma once
+
+#include <Arduino.h>
+#include "session_format.h"
+
+// SD card chip select. The card shares SPI (pins 11/12/13) with the
+// colour LCD; pin 0 is free on that side of the board.
+constexpr uint8_t RECORDER_SD_CS = 0;
+
+constexpr uint16_t RECORDER_RING_SECTORS = 128;        // 64KB ≈ 30s of backlog
+
+// Space reserved on the card when a session starts, so the file is one
+// contiguous run of sectors. 64MB ≈ 9 hours at full rate.
+constexpr uint64_t RECORDER_PREALLOC_BYTES = 64ULL * 1024 * 1024;
+
+// The file's size in the directory only moves on a sync(), so that's 
+// all a power cut leaves of a session. Sync every this many sectors 
+// (~10s), and as soon as the device goes idle. One sync is a directory 
+// sector write, not a FAT walk — the clusters were all allocated up 
+// front. The few sectors after the last sync are found again at boot.
+constexpr uint16_t RECORDER_SYNC_SECTORS = 40;
+
+// Look for the SD card, finish off the last session if the power went 
+// in the middle of it, and create and pre-allocate the next 
+// SESSnnnn.BIN ready for the first session. Call once during boot,
+// before any mode can run the motor. Returns false (and the recorder
+// stays off) if there's no card or no room on it.
+bool recorder_init();
+
+// Begin a new session / finish the current one. Called on entering
+// and leaving APP_RUNNING. Starting records into the file made ahead
+// of time, so it never touches the FAT. If that file isn't ready yet
+// (the last session is still closing), the session starts once it is.
+void recorder_start();
+void recorder_stop();
+
+// Control-task side: encode every new pressure sample, and any change
+// in the control values, into the ring. mode is the operational state.
+void recorder_capture(uint8_t mode);
+
+// Low-priority task: write finished sectors to the card while the SPI
+// bus is free. Closing the last session's file and making the next 
+// one can block for hundreds of ms, so they wait for `idle` — true 
+// while nothing can be driving the motor (off APP_RUNNING, or STANDBY).
+void recorder_service(bool idle);
+
+// Name of the newest session file on the card (e.g. "SESS0012.BIN").
+// Returns false if there is no card or no session yet — or while one 
+// is still being recorded.
+bool recorder_latest_session(char* name, size_t len);
+
+// ── Diagnostics ────────────────────────────────────────────────────────
+bool     recorder_active();
+uint32_t recorder_sectors_written();
+uint32_t recorder_sectors_dropped();   // Ring was full — card too slow
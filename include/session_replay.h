@@ -0,0 +1,73 @@
+// session_replay.h — Run the real edging logic over recorded or simulated data
+//
+// To see how a userMode behaves, you used to flash it and try it. The
+// replay engine runs the SAME run_auto() against a pressure trace
+// instead, much faster than real time, and reports what the mode did: how many edges, how
+// long the cooldowns were, how much of the time the motor was on.
+//
+// The trace comes from a pressure source (pressure.h):
+//
+//   REPLAY_SESSION  the newest SESSnnnn.BIN from the session recorder,
+//                   every 1kHz sample fed to the edge guard, and the
+//                   knob moved to follow the recorded pressureLimit
+//   REPLAY_SIM      sim_tick() with a fixed seed, REPLAY_SIM_TICKS long
+//
+// Each run is deterministic: same trace in, same numbers out.
+//
+// While a replay runs, the motor is in dry-run mode (motor.h) and the
+// live ADC is kept away from the edge guard. Everything run_auto()
+// touches is saved first and restored afterwards. In Python terms:
+//
+//   with dry_run(motor), source(ReplayFile(path)), saved(globals):
+//       for tick in source: run_auto()
+//
+// A replay takes over the mode code's globals, so it only runs from 
+// the main menu (motor stopped). Requests from the serial console wait 
+// there until the menu is showing. It doesn't hold the loop up, though: 
+// each control tick runs REPLAY_SLICE_US of it and carries on, and 
+// leaving the menu cancels it.
+
+#pragma once
+
+#include <Arduino.h>
+#include "config.h"
+
+enum ReplayKind : uint8_t {
+    REPLAY_NONE,
+    REPLAY_SESSION,
+    REPLAY_SIM
+};
+
+constexpr uint32_t REPLAY_SIM_TICKS = 30UL * 60 * FREQUENCY;   // 30 minutes
+constexpr uint32_t REPLAY_SIM_SEED  = 12345;
+
+// Replay time per control tick. The menu's own per-tick work is tiny, 
+// so this leaves the control task well inside its 2ms budget. At full 
+// clock a tick of replay is ~15us, so a 30-minute session is a ~25s 
+// run per userMode; the CPU stays at full clock while one is going.
+constexpr uint32_t REPLAY_SLICE_US = 1000;
+
+// What one userMode did over one trace
+struct ReplayResult {
+    uint32_t ticks;
+    uint32_t edges;
+    uint32_t motorOnTicks;       // motorSpeed above MOT_MIN
+    uint32_t cooldownTicks;      // Total time from each edge to motor back on
+    uint32_t longestCooldownTicks;
+};
+
+// Ask for every userMode to be replayed over `kind`. Serial-console
+// side; the run itself happens in replay_service().
+void replay_request(ReplayKind kind);
+
+// Run the next slice of a pending or running request, printing a row
+// of the results table as each userMode finishes. Call from the 
+// control task every tick the main menu is showing.
+void replay_service();
+
+// A request is queued or running.
+bool replay_active();
+
+// Stop a running replay and put the live state back; nothing if none 
+// is running. Call every tick the main menu isn't showing.
+void replay_cancel();
@@ -0,0 +1,87 @@
+// settings.h — Persistent settings with write-behind and wear levelling
+//
+// The settings used to be single bytes at fixed EEPROM addresses, read
+// once at boot and never written. On the Teensy 4 "EEPROM" is emulated
+// in flash, and every changed byte is a flash program — occasionally a
+// whole sector erase, which holds the CPU for tens of milliseconds.
+// That can't happen in the middle of a 60Hz control tick.
+//
+// So the settings live in RAM — the usual globals (rampUp, userMode,
+// sensitivity, ...) ARE the live copy — and this module keeps them
+// saved in the background:
+//
+//   1. settings_service() notices a global has changed.
+//   2. It waits until nothing has changed for SETTINGS_SETTLE_MS, so
+//      turning the knob through twenty values is one save, not twenty.
+//   3. It waits until the device is idle (menu, or STANDBY) with the
+//      motor off.
+//   4. It writes a whole record a few bytes per call into the NEXT slot
+//      of a ring of slots, CRC last.
+//
+// At boot the slot with the newest sequence number and a good CRC
+// wins. A save that was cut off by power loss leaves a bad CRC in its
+// own slot, so the previous record still loads. Rotating through the
+// slots spreads the writes over all of them.
+//
+// With no good slot at all, the old fixed-address bytes (sensitivity 
+// and max speed) are read instead, so a unit updated from that build 
+// keeps them; the first save moves them into a slot.
+//
+// In Python terms:
+//
+//   best = max((s for s in slots if s.crc_ok and s.version == VERSION),
+//              key=lambda s: s.seq, default=DEFAULTS)
+//   ...
+//   if live != saved and quiet_for(3s) and idle:
+//       slots[(best.index + 1) % N].write_slowly(live, seq=best.seq + 1)
+//
+// To add a setting: add a field to Settings, wire it up in
+// settings.cpp's capture/apply, and bump SETTINGS_VERSION (old records
+// then fall back to defaults rather than loading as garbage).
+
+#pragma once
+
+#include <Arduino.h>
+
+constexpr uint8_t  SETTINGS_VERSION      = 1;
+constexpr uint8_t  SETTINGS_SLOT_BYTES   = 32;
+constexpr uint8_t  SETTINGS_SLOT_COUNT   = 32;     // 1KB of the 1080-byte emulated EEPROM
+constexpr uint32_t SETTINGS_SETTLE_MS    = 3000;   // Quiet time before a save starts
+constexpr uint8_t  SETTINGS_BYTES_PER_CALL = 4;    // Flash programs per settings_service()
+
+struct Settings {
+    int16_t  sensitivity;         // run_auto()'s raw encoder position
+    uint8_t  maxMotorSpeed;
+    uint8_t  rampUp;              // Seconds
+    uint8_t  userMode;            // 1..userModeTotal
+    uint8_t  brightness;          // LED ring, 0–255
+    uint16_t cooldown;
+    uint8_t  cooldownStep;
+    uint16_t maxCooldown;
+    uint8_t  pressureStep;
+};
+
+// Load the newest good record into the globals (or the defaults if
+// there isn't one) and apply the brightness to the LED ring.
+void settings_init();
+
+// Background saving. `idle` says it's safe to touch flash now — no
+// session running, motor off. Cheap when nothing has changed; call it
+// from a low-priority task.
+void settings_service(bool idle);
+
+// The live settings, as the globals hold them right now.
+Settings settings_current();
+
+// Copy `s` into the globals. It's saved like any other change.
+void settings_apply(const Settings& s);
+
+// Put every setting back to its default (saved in the background).
+void settings_reset_defaults();
+
+// True while the live settings differ from the newest saved record.
+bool settings_pending();
+
+// ── Diagnostics ────────────────────────────────────────────────────────
+uint32_t settings_saves();        // Completed saves since boot
+int8_t   settings_slot();         // Slot the newest record is in, -1 if none
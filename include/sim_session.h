@@ -31,7 +31,7 @@
 
 #pragma once
 
-#include <Arduino.h>
+#include "hal.h"
 
 // ── Simulated values ───────────────────────────────────────────────────
 // These are updated every time sim_tick() is called. Read them freely 
@@ -69,7 +69,7 @@ extern float sim_gsr_phasic;    // Just the spike component (for displays
 // ── Simulated pressure system ──────────────────────────────────────────
 // Instead of directly generating a "delta" value, we simulate what
 // the pressure sensor actually reads, then derive the delta through
-// the same RunningAverage logic the real device uses.
+// the same baseline filter the real device uses.
 //
 // This means sim_arousal (the delta) naturally exhibits all the 
 // real system's behaviours:
@@ -90,7 +90,9 @@ extern int   sim_avg_pressure;    // Running average of sim_pressure
 
 // Reset all simulation state. Call when entering demo mode so each 
 // demo session starts fresh from a "resting" baseline.
-void sim_reset();
+// seed = 0 picks a seed from the clock; any other value gives the same
+// session every time (the replay engine uses this).
+void sim_reset(uint32_t seed = 0);
 
 // Advance the simulation by one tick. Call once per 60Hz loop 
 // iteration when in demo mode.
@@ -1,15 +1,56 @@
-// state.h — State machine dispatcher and transition logic
+// state.h — Operational mode table, dispatcher and transitions
+//
+// Every operational mode (STANDBY, MANUAL, AUTO, ...) is described by
+// one row of a constant table in state.cpp: what it runs each tick,
+// what it sets up on the way in and tidies up on the way out, what the
+// displays call it, and where the left/right nav cycle goes next.
+//
+// In Python terms:
+//
+//   MODES = {
+//       MANUAL: Mode(tick=run_manual, enter=knob_to_zero, exit=stop,
+//                    label="MANUAL", title="Manual", prev=STANDBY, next=AUTO),
+//       ...
+//   }
+//
+// The table is indexed directly by the mode constant, so a tick, a
+// transition or a label lookup is one array access — no searching.
 
 #pragma once
 
 #include <Arduino.h>
 
-// Run the current state's logic (dispatches to the right mode function).
+struct ModeDescriptor {
+    uint8_t     id;               // The mode constant (config.h) this row is for
+    void      (*tick)();          // Runs once per control tick while active
+    void      (*enter)();         // One-time setup on arrival (may be nullptr)
+    void      (*exit)();          // One-time tidy-up on departure (may be nullptr)
+    const char* label;            // Short caps text for the matrix and LCD
+    const char* title;            // Longer text for the OLED
+    uint32_t    colour;           // 0xRRGGBB — the mode's LED ring cursor (modes.cpp)
+    uint8_t     prev;             // NAV_LEFT goes here
+    uint8_t     next;             // NAV_RIGHT goes here
+};
+
+// The row for `mode`. Unknown values get STANDBY's row, so a bad
+// constant can only ever stop the motor.
+const ModeDescriptor& mode_descriptor(uint8_t mode);
+
+inline const char* mode_label(uint8_t mode) { return mode_descriptor(mode).label; }
+inline const char* mode_title(uint8_t mode) { return mode_descriptor(mode).title; }
+
+// Run the current state's logic for this tick.
 void run_state_machine(uint8_t state);
 
-// Determine the next state based on the current state and button press.
-// Handles transitions between modes and the power-off sequence.
-// Returns the new state.
-// uint8_t set_state(uint8_t state);
-uint8_t get_next_state(uint8_t state);
-uint8_t get_previous_state(uint8_t state);
\ No newline at end of file
+// Leave `from` and arrive in `to`: runs from's exit hook, then to's
+// enter hook. Returns `to`. Neither mode ticks here — the new one
+// gets its first tick from the next run_state_machine() call.
+uint8_t state_transition(uint8_t from, uint8_t to);
+
+// Run a mode's enter or exit hook on its own — for leaving and
+// re-entering APP_RUNNING, where there's no mode on the other side.
+void state_enter(uint8_t state);
+void state_exit(uint8_t state);
+
+inline uint8_t get_next_state(uint8_t state)     { return mode_descriptor(state).next; }
+inline uint8_t get_previous_state(uint8_t state) { return mode_descriptor(state).prev; }
@@ -0,0 +1,78 @@
+// telemetry.h — Binary, framed, sample-rate telemetry over USB serial
+//
+// The text report (report_serial) sends one line per 60Hz tick and 
+// spends most of its time turning numbers into ASCII. For offline 
+// analysis we want every 1kHz sample, so this mode sends fixed-size 
+// binary records instead — one per pressure sample.
+//
+// ═══════════════════════════════════════════════════════════════════════
+// RECORD FORMAT (22 bytes, little-endian, no padding)
+// ═══════════════════════════════════════════════════════════════════════
+//
+//   offset  size  field
+//   ──────  ────  ─────────────────────────────────────────────────────
+//    0      2     sync        0x5AA5 (bytes A5 5A on the wire)
+//    2      2     seq         record counter, wraps at 65535
+//    4      4     sample      sampler count (pressure_sampler.h)
+//    8      2     pressure    raw decimated sample (0–4095)
+//   10      2     baseline    averagePressure at that sample
+//   12      2     delta       pressure - baseline (signed)
+//   14      2     limit       pressureLimit
+//   16      1     motor       motor speed (0–255)
+//   17      1     mode        operational state (config.h)
+//   18      2     cooldown    minimumcooldown
+//   20      2     crc         CRC-16/CCITT-FALSE of bytes 0–19
+//
+// pressure/baseline/delta/sample are per sample. limit/motor/mode/
+// cooldown come from the main loop and repeat across the ~17 records 
+// sent each tick.
+//
+// The sample count is the timestamp: sample N was taken N × 
+// PRESSURE_SAMPLE_PERIOD_US after the sampler started. At 1kHz it 
+// only wraps after 49 days, where a µs time in 32 bits would wrap 
+// after 71 minutes — shorter than a long session. A gap in it is 
+// samples the sampler ring overran before they could be sent; a gap 
+// in seq is records lost on the way to the host.
+//
+// A host reader hunts for the sync word, checks the CRC, and uses the 
+// sequence number to spot dropped records. Text from other commands 
+// (like the 'p' profiler report) can land between records; the 
+// sync + CRC lets the reader skip over it. In Python:
+//
+//   rec = struct.unpack("<HHIHHhHBBHH", buf[i:i+22])
+//   ok  = crc16_ccitt(buf[i:i+20]) == rec[-1]
+//   t   = rec[2] / 1000.0          # seconds, at PRESSURE_SAMPLE_HZ = 1000
+
+#pragma once
+
+#include <Arduino.h>
+
+struct __attribute__((packed)) TelemetryRecord {
+    uint16_t sync;
+    uint16_t seq;
+    uint32_t sample;
+    uint16_t pressure;
+    uint16_t baseline;
+    int16_t  delta;
+    uint16_t limit;
+    uint8_t  motor;
+    uint8_t  mode;
+    uint16_t cooldown;
+    uint16_t crc;
+};
+
+static_assert(sizeof(TelemetryRecord) == 22, "TelemetryRecord must stay 22 bytes");
+
+constexpr uint16_t TELEMETRY_SYNC = 0x5AA5;
+
+// Start streaming from the newest sample (not the ~256ms backlog 
+// sitting in the ring). Call when switching into binary mode.
+void telemetry_start();
+
+// Drain every new pressure sample into records and send whatever 
+// batch is ready. Never blocks — if USB can't keep up, the oldest 
+// batch is dropped and counted. mode is the operational state.
+void telemetry_stream(uint8_t mode);
+
+// Records lost to a full USB buffer or to falling behind the ring.
+uint32_t telemetry_dropped();
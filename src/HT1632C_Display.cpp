@@ -37,78 +37,7 @@
 // 26/02/2026 Add scrollText() with signed-position drawing helpers
 
 #include "HT1632C_Display.h"
-
-// ── Basic 5×7 Font ─────────────────────────────────────────────────────
-// Each character is 5 bytes wide, each byte is one column with bit 0
-// at the top. ASCII 32 (space) through 90 (Z).
-static const uint8_t FONT_5X7[][5] PROGMEM = {
-    {0x00, 0x00, 0x00, 0x00, 0x00}, // 32: space
-    {0x00, 0x00, 0x5F, 0x00, 0x00}, // 33: !
-    {0x00, 0x07, 0x00, 0x07, 0x00}, // 34: "
-    {0x14, 0x7F, 0x14, 0x7F, 0x14}, // 35: #
-    {0x24, 0x2A, 0x7F, 0x2A, 0x12}, // 36: $
-    {0x23, 0x13, 0x08, 0x64, 0x62}, // 37: %
-    {0x36, 0x49, 0x55, 0x22, 0x50}, // 38: &
-    {0x00, 0x05, 0x03, 0x00, 0x00}, // 39: '
-    {0x00, 0x1C, 0x22, 0x41, 0x00}, // 40: (
-    {0x00, 0x41, 0x22, 0x1C, 0x00}, // 41: )
-    {0x14, 0x08, 0x3E, 0x08, 0x14}, // 42: *
-    {0x08, 0x08, 0x3E, 0x08, 0x08}, // 43: +
-    {0x00, 0x50, 0x30, 0x00, 0x00}, // 44: ,
-    {0x08, 0x08, 0x08, 0x08, 0x08}, // 45: -
-    {0x00, 0x60, 0x60, 0x00, 0x00}, // 46: .
-    {0x20, 0x10, 0x08, 0x04, 0x02}, // 47: /
-    {0x3E, 0x51, 0x49, 0x45, 0x3E}, // 48: 0
-    {0x00, 0x42, 0x7F, 0x40, 0x00}, // 49: 1
-    {0x42, 0x61, 0x51, 0x49, 0x46}, // 50: 2
-    {0x21, 0x41, 0x45, 0x4B, 0x31}, // 51: 3
-    {0x18, 0x14, 0x12, 0x7F, 0x10}, // 52: 4
-    {0x27, 0x45, 0x45, 0x45, 0x39}, // 53: 5
-    {0x3C, 0x4A, 0x49, 0x49, 0x30}, // 54: 6
-    {0x01, 0x71, 0x09, 0x05, 0x03}, // 55: 7
-    {0x36, 0x49, 0x49, 0x49, 0x36}, // 56: 8
-    {0x06, 0x49, 0x49, 0x29, 0x1E}, // 57: 9
-    {0x00, 0x36, 0x36, 0x00, 0x00}, // 58: :
-    {0x00, 0x56, 0x36, 0x00, 0x00}, // 59: ;
-    {0x08, 0x14, 0x22, 0x41, 0x00}, // 60: <
-    {0x14, 0x14, 0x14, 0x14, 0x14}, // 61: =
-    {0x00, 0x41, 0x22, 0x14, 0x08}, // 62: >
-    {0x02, 0x01, 0x51, 0x09, 0x06}, // 63: ?
-    {0x3E, 0x41, 0x5D, 0x55, 0x1E}, // 64: @
-    {0x7E, 0x11, 0x11, 0x11, 0x7E}, // 65: A
-    {0x7F, 0x49, 0x49, 0x49, 0x36}, // 66: B
-    {0x3E, 0x41, 0x41, 0x41, 0x22}, // 67: C
-    {0x7F, 0x41, 0x41, 0x22, 0x1C}, // 68: D
-    {0x7F, 0x49, 0x49, 0x49, 0x41}, // 69: E
-    {0x7F, 0x09, 0x09, 0x09, 0x01}, // 70: F
-    {0x3E, 0x41, 0x49, 0x49, 0x7A}, // 71: G
-    {0x7F, 0x08, 0x08, 0x08, 0x7F}, // 72: H
-    {0x00, 0x41, 0x7F, 0x41, 0x00}, // 73: I
-    {0x20, 0x40, 0x41, 0x3F, 0x01}, // 74: J
-    {0x7F, 0x08, 0x14, 0x22, 0x41}, // 75: K
-    {0x7F, 0x40, 0x40, 0x40, 0x40}, // 76: L
-    {0x7F, 0x02, 0x0C, 0x02, 0x7F}, // 77: M
-    {0x7F, 0x04, 0x08, 0x10, 0x7F}, // 78: N
-    {0x3E, 0x41, 0x41, 0x41, 0x3E}, // 79: O
-    {0x7F, 0x09, 0x09, 0x09, 0x06}, // 80: P
-    {0x3E, 0x41, 0x51, 0x21, 0x5E}, // 81: Q
-    {0x7F, 0x09, 0x19, 0x29, 0x46}, // 82: R
-    {0x46, 0x49, 0x49, 0x49, 0x31}, // 83: S
-    {0x01, 0x01, 0x7F, 0x01, 0x01}, // 84: T
-    {0x3F, 0x40, 0x40, 0x40, 0x3F}, // 85: U
-    {0x1F, 0x20, 0x40, 0x20, 0x1F}, // 86: V
-    {0x3F, 0x40, 0x38, 0x40, 0x3F}, // 87: W
-    {0x63, 0x14, 0x08, 0x14, 0x63}, // 88: X
-    {0x07, 0x08, 0x70, 0x08, 0x07}, // 89: Y
-    {0x61, 0x51, 0x49, 0x45, 0x43}, // 90: Z
-};
-
-#define FONT_FIRST_CHAR 32
-#define FONT_LAST_CHAR  90
-#define FONT_CHAR_WIDTH 5
-#define FONT_CHAR_SPACING 1  // 1px gap between characters
-#define FONT_TOTAL_CHAR_WIDTH (FONT_CHAR_WIDTH + FONT_CHAR_SPACING)  // 6px per char
-
+#include "font_5x7.h"
 
 // ════════════════════════════════════════════════════════════════════════
 // Constructor
@@ -116,9 +45,12 @@ static const uint8_t FONT_5X7[][5] PROGMEM = {
 
 HT1632C_Display::HT1632C_Display(uint8_t pinCS, uint8_t pinWR, uint8_t pinDATA)
     : _pinCS(pinCS), _pinWR(pinWR), _pinDATA(pinDATA),
-      _scrollOffset(0), _lastScrollTime(0), _lastText(nullptr), _textPixelWidth(0)
+      _shadowValid(false),
+      _scrollOffset(0), _lastScrollTime(0), _lastText(nullptr), _textPixelWidth(0),
+      _slotCount(0), _poolUsed(0), _strip(_scratch)
 {
     memset(_buffer, 0, HT1632C_WIDTH);
+    memset(_shadow, 0, HT1632C_WIDTH);
 }
 
 
@@ -163,6 +95,8 @@ void HT1632C_Display::begin() {
     _sendCommand(HT1632C_CMD_BLINK_OFF);      // 5. No blinking
     setBrightness(8);                          // 6. Mid brightness
 
+    // Display RAM is random at power-on — send all of it the first time
+    _shadowValid = false;
     clear();
     flush();
 }
@@ -214,7 +148,7 @@ void HT1632C_Display::setColumn(uint8_t col, uint8_t data) {
 // Display Output — THE CRITICAL FIX
 // ════════════════════════════════════════════════════════════════════════
 //
-// Push the entire framebuffer to the HT1632C.
+// Push the framebuffer to the HT1632C.
 //
 // Two corrections based on hardware testing:
 //
@@ -236,27 +170,66 @@ void HT1632C_Display::setColumn(uint8_t col, uint8_t data) {
 //   for col in reversed(buffer):
 //       send(col)   # LED data byte
 //       send(0x00)  # padding byte       # 48 bytes → 24 columns!
+//
+// ── Change detection ──────────────────────────────────────────────────
+//
+// Every bit is bit-banged (two GPIO writes + a clock pulse), so a full 
+// flush is 394 bits. But most ticks nothing has changed — a static 
+// graph, a short label that doesn't scroll — and a scroll step moves 
+// every column but leaves blank ones blank.
+//
+// _shadow holds what the chip's RAM currently contains. flush() finds 
+// the first and last column that differ from it and sends ONLY that 
+// run, using the HT1632C's successive-address write: give it the start 
+// address once and it auto-increments through the data that follows. 
+// If nothing differs, nothing is sent at all.
+//
+// Because of the column reversal, logical column c lives at RAM nibble 
+// address (23 - c) × 4 — so the run starts at the RIGHTMOST changed 
+// column and works leftwards, exactly like the full flush does.
+//
+// (Hardware SPI/FlexIO would be faster again, but pins 6/7/8 aren't 
+// on an SPI port and the HT1632C's 3+7-bit header doesn't fit a byte 
+// stream. Sending less is the bigger win anyway.)
+
+bool HT1632C_Display::flush() {
+    int8_t lo = 0;
+    int8_t hi = HT1632C_WIDTH - 1;
+
+    if (_shadowValid) {
+        // Narrow [lo, hi] to the columns that actually changed
+        while (lo < HT1632C_WIDTH && _buffer[lo] == _shadow[lo]) lo++;
+        if (lo == HT1632C_WIDTH) return false;           // Nothing to send
+        while (_buffer[hi] == _shadow[hi]) hi--;
+    }
 
-void HT1632C_Display::flush() {
     digitalWriteFast(_pinCS, LOW);
 
-    _writeBits(0b101, 3);     // Write mode ID
-    _writeBits(0x00, 7);      // Start at RAM address 0
+    _writeBits(0b101, 3);                        // Write mode ID
+    _writeBits((HT1632C_WIDTH - 1 - hi) * 4, 7); // RAM address of column hi
 
-    // Send 24 columns × 2 bytes each = 48 bytes total.
+    // 2 bytes per column, from hi down to lo.
     // Reverse order: buffer[23] goes to RAM addr 0 (rightmost),
-    // buffer[0] goes to RAM addr 46 (leftmost).
+    // buffer[0] goes to RAM addr 92 (leftmost).
     //
     // Using int8_t (signed) because we count down past zero.
     // With uint8_t, decrementing 0 would wrap to 255 and loop forever.
     // It's a classic C/C++ gotcha — Python's range(23, -1, -1) handles
     // this automatically, but in C++ we have to think about the type.
-    for (int8_t col = HT1632C_WIDTH - 1; col >= 0; col--) {
+    for (int8_t col = hi; col >= lo; col--) {
         _writeBits(_buffer[col], 8);  // COM0–7: the 8 actual LEDs
         _writeBits(0x00, 8);          // COM8–15: padding (no LEDs here)
+        _shadow[col] = _buffer[col];
     }
 
     digitalWriteFast(_pinCS, HIGH);
+
+    _shadowValid = true;
+    return true;
+}
+
+void HT1632C_Display::invalidate() {
+    _shadowValid = false;
 }
 
 
@@ -298,56 +271,62 @@ void HT1632C_Display::drawString(uint8_t x, const char* str) {
 
 
 // ════════════════════════════════════════════════════════════════════════
-// Signed-position Drawing Helpers (private — for scrolling)
+// Scroll Strips
 // ════════════════════════════════════════════════════════════════════════
 //
-// These are like drawChar/drawString but accept a signed int for the 
-// x position. This allows text to be partially off the left edge of 
-// the display — essential for smooth scrolling.
+// A strip is a whole message rasterised into columns, once — "MANUAL" 
+// is 35 columns. Scrolling then never touches the font again: each 
+// step is a 24-byte window copy out of the strip, with blank columns 
+// wherever the window hangs off either end.
 //
-// In Python you'd just use negative indices and let the list handle 
-// bounds. In C++, writing to _buffer[-3] would corrupt random memory,
-// so we have to explicitly skip columns that fall outside 0..WIDTH-1.
-//
-// The original functions stay untouched with uint8_t x so existing 
-// code (like the static mode_to_string display) keeps working without 
-// any changes.
+// In Python terms:
+//   strip = render(text)                       # once, on text change
+//   buffer = [strip[i - x] if 0 <= i - x < len(strip) else 0
+//             for i in range(24)]              # every scroll step
 
-void HT1632C_Display::_drawCharSigned(int x, char c)
+uint16_t HT1632C_Display::_renderStrip(const char* text, uint8_t* out, uint16_t maxCols)
 {
-    if (c < FONT_FIRST_CHAR || c > FONT_LAST_CHAR) c = ' ';
-    uint8_t index = c - FONT_FIRST_CHAR;
-
-    for (int col = 0; col < FONT_CHAR_WIDTH; col++) {
-        int colX = x + col;
-
-        // Skip columns that are off-screen in either direction.
-        // This is the key difference from drawChar() — we handle 
-        // negative positions gracefully instead of relying on 
-        // uint8_t wrapping.
-        if (colX < 0) continue;            // Off the left edge
-        if (colX >= HT1632C_WIDTH) break;  // Off the right edge (and all remaining will be too)
+    uint16_t width = 0;
+    for (const char* p = text; *p; p++) {
+        if (width != 0) {
+            if (width >= maxCols) break;
+            out[width++] = 0x00;            // 1px gap between characters
+        }
+        for (uint8_t col = 0; col < FONT_CHAR_WIDTH && width < maxCols; col++) {
+            out[width++] = font_5x7_column(*p, col);
+        }
+    }
+    return width;
+}
 
-        _buffer[colX] = pgm_read_byte(&FONT_5X7[index][col]);
+void HT1632C_Display::_blitStrip(int x)
+{
+    // Screen column i shows strip column (i - x)
+    for (int i = 0; i < HT1632C_WIDTH; i++) {
+        int s = i - x;
+        _buffer[i] = (s >= 0 && s < _textPixelWidth) ? _strip[s] : 0x00;
     }
 }
 
-void HT1632C_Display::_drawStringSigned(int x, const char* str)
+bool HT1632C_Display::registerScrollText(const char* text)
 {
-    while (*str) {
-        // Once we're fully off the right edge, no point continuing
-        if (x >= HT1632C_WIDTH) break;
-
-        // Only bother drawing if at least part of the character is 
-        // on screen. A char is 5px wide, so it's visible if 
-        // x > -FONT_CHAR_WIDTH (i.e. its rightmost column is at x+4 >= 0).
-        if (x > -FONT_CHAR_WIDTH) {
-            _drawCharSigned(x, *str);
-        }
+    if (text == nullptr) return false;
 
-        x += FONT_TOTAL_CHAR_WIDTH;  // Advance cursor (5px char + 1px gap)
-        str++;
+    for (uint8_t i = 0; i < _slotCount; i++) {
+        if (_slots[i].text == text) return true;     // Already cached
     }
+    if (_slotCount >= HT1632C_SCROLL_SLOTS) return false;
+
+    uint16_t room = HT1632C_SCROLL_POOL_COLS - _poolUsed;
+    uint16_t width = _renderStrip(text, &_stripPool[_poolUsed], room);
+
+    // Don't cache a truncated strip — better to scroll it uncached 
+    // from scratch (which has its own, separate limit)
+    if (*text != '\0' && width >= room) return false;
+
+    _slots[_slotCount++] = { text, _poolUsed, width };
+    _poolUsed += width;
+    return true;
 }
 
 
@@ -387,7 +366,7 @@ bool HT1632C_Display::scrollText(const char* text, unsigned long scrollIntervalM
 {
     // --- Detect text change and reset scroll ---
     // We compare the pointer, not the string content. This works 
-    // because mode_to_string() returns pointers to string literals, 
+    // because mode_label() returns pointers to string literals, 
     // which have fixed addresses. If you were passing dynamically 
     // built strings, you'd need strcmp() instead.
     //
@@ -399,23 +378,29 @@ bool HT1632C_Display::scrollText(const char* text, unsigned long scrollIntervalM
         _scrollOffset = 0;
         _lastScrollTime = millis();
 
-        // Calculate total pixel width of the text.
-        // Each character is 6px (5px glyph + 1px spacing), minus 
-        // the trailing space after the last character.
-        int len = 0;
-        const char* p = text;
-        while (*p) { len++; p++; }
-        _textPixelWidth = (len * FONT_TOTAL_CHAR_WIDTH) - FONT_CHAR_SPACING;
+        // Find the pre-rendered strip, or render into scratch.
+        // The strip's width is the text's pixel width: 6px per 
+        // character (5px glyph + 1px spacing), minus the trailing gap.
+        _strip = nullptr;
+        for (uint8_t i = 0; i < _slotCount; i++) {
+            if (_slots[i].text == text) {
+                _strip = &_stripPool[_slots[i].start];
+                _textPixelWidth = _slots[i].width;
+                break;
+            }
+        }
+        if (_strip == nullptr) {
+            _textPixelWidth = _renderStrip(text, _scratch, HT1632C_SCROLL_SCRATCH_COLS);
+            _strip = _scratch;
+        }
 
         // Draw immediately on change (don't wait for first scroll tick)
-        clear();
         if (_textPixelWidth <= HT1632C_WIDTH) {
             // Short text — draw statically, centred
-            int centreX = (HT1632C_WIDTH - _textPixelWidth) / 2;
-            _drawStringSigned(centreX, text);
+            _blitStrip((HT1632C_WIDTH - _textPixelWidth) / 2);
         } else {
             // Long text — draw at position 0 (start of scroll)
-            _drawStringSigned(0, text);
+            _blitStrip(0);
         }
         flush();
         return true;
@@ -446,8 +431,7 @@ bool HT1632C_Display::scrollText(const char* text, unsigned long scrollIntervalM
     }
 
     // --- Redraw at new position ---
-    clear();
-    _drawStringSigned(_scrollOffset, text);
+    _blitStrip(_scrollOffset);
     flush();
     return true;
 }
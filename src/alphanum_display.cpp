@@ -26,6 +26,7 @@
 // 0.2ms at 400kHz — easily fits within a 60Hz tick (16.7ms budget).
 
 #include "alphanum_display.h"
+#include "i2c_bus.h"
 #include <Wire.h>
 #include <Adafruit_LEDBackpack.h>
 
@@ -42,6 +43,67 @@ static Adafruit_AlphaNum4 alpha4 = Adafruit_AlphaNum4();
 static bool displayReady = false;
 
 
+// ════════════════════════════════════════════════════════════════════════
+// Sending
+// ════════════════════════════════════════════════════════════════════════
+//
+// The display functions below only edit alpha4.displaybuffer — nothing
+// goes out until alphanum_commit(). That lets a caller build one frame
+// from several calls (text, then a dot) and send it as one write.
+//
+// Most ticks the frame is identical to the last one: "MENU" is redrawn
+// 60 times a second but changes never. So we keep a SHADOW of the four
+// digit words the HT16K33 last accepted and skip the transfer when the
+// new frame matches it. In Python terms:
+//
+//   if frame != shadow and bus.write(frame):
+//       shadow = frame.copy()
+//
+// The shadow only updates once a write is actually queued, so an
+// update dropped by a full bus queue goes out on the next commit.
+
+static uint16_t sentDigits[4];
+static bool     sentValid = false;      // Does sentDigits match the chip?
+
+// The Adafruit library's writeDisplay() is a blocking Wire transfer. 
+// Once the shared bus manager has taken over (i2c_bus.h), we send the 
+// same bytes ourselves as a fire-and-forget transaction instead: 
+// register address 0x00, then the 8 × 16-bit display RAM words, low 
+// byte first — 17 bytes, exactly what writeDisplay() sends.
+//
+// Returns false if the update couldn't be queued (bus queue full).
+
+static bool alphanum_flush()
+{
+    if (!i2c_bus_active()) {
+        alpha4.writeDisplay();
+        return true;
+    }
+
+    uint8_t msg[17];
+    msg[0] = 0x00;
+    for (uint8_t i = 0; i < 8; i++) {
+        msg[1 + i * 2] = alpha4.displaybuffer[i] & 0xFF;
+        msg[2 + i * 2] = alpha4.displaybuffer[i] >> 8;
+    }
+    return i2c_write(ALPHANUM_I2C_ADDR, msg, sizeof(msg)) >= 0;
+}
+
+void alphanum_commit()
+{
+    if (!displayReady) return;
+
+    if (sentValid && memcmp(sentDigits, alpha4.displaybuffer, sizeof(sentDigits)) == 0) {
+        return;     // Already on the display
+    }
+
+    if (alphanum_flush()) {
+        memcpy(sentDigits, alpha4.displaybuffer, sizeof(sentDigits));
+        sentValid = true;
+    }
+}
+
+
 // ════════════════════════════════════════════════════════════════════════
 // Initialisation
 // ════════════════════════════════════════════════════════════════════════
@@ -63,6 +125,8 @@ bool alphanum_init()
         alpha4.setBrightness(8);   // Mid-range brightness
         alpha4.clear();
         alpha4.writeDisplay();     // Push the cleared state to hardware
+        memcpy(sentDigits, alpha4.displaybuffer, sizeof(sentDigits));
+        sentValid = true;
         Serial.println("[AlphaNum] Init OK at 0x70");
     } else {
         Serial.println("[AlphaNum] Not found at 0x70!");
@@ -88,11 +152,10 @@ void alphanum_show_text(const char* text)
         alpha4.writeDigitAscii(i, text[i]);
     }
 
-    // writeDisplay() sends the 4-digit buffer to the HT16K33 over 
-    // I2C. Until you call this, changes are only in local memory.
-    // It's the same pattern as our HT1632C flush() or U8g2's 
-    // sendBuffer() — buffer locally, then push to hardware.
-    alpha4.writeDisplay();
+    // Nothing is sent yet — alphanum_commit() pushes the buffer to the 
+    // HT16K33, and only if it differs from what's already showing. 
+    // It's the same pattern as our HT1632C flush() or the OLED's 
+    // display_commit() — buffer locally, then push to hardware.
 }
 
 
@@ -142,7 +205,6 @@ void alphanum_clear()
     if (!displayReady) return;
 
     alpha4.clear();
-    alpha4.writeDisplay();
 }
 
 
@@ -154,7 +216,14 @@ void alphanum_set_brightness(uint8_t level)
     // This controls the duty cycle of the LED multiplexing — 
     // similar to PWM but handled by the chip internally.
     if (level > 15) level = 15;
-    alpha4.setBrightness(level);
+    if (!i2c_bus_active()) {
+        alpha4.setBrightness(level);
+        return;
+    }
+
+    // Dimming set command: 0xE0 | level, a single byte
+    uint8_t cmd = 0xE0 | level;
+    i2c_write(ALPHANUM_I2C_ADDR, &cmd, 1);
 }
 
 
@@ -167,18 +236,15 @@ void alphanum_set_dot(uint8_t digit)
     // 14-segment display. Bit 14 is the decimal point.
     //
     // By OR-ing in that bit, we add the dot WITHOUT clearing the 
-    // character that's already there. Then we flush to hardware.
+    // character that's already there. It joins the same frame as the 
+    // text, so the next alphanum_commit() sends both in one write.
     //
     // In Python terms:
     //   display.buffer[digit] |= (1 << 14)   # set the dot bit
-    //   display.flush()
     //
     // The displaybuffer is a public member of Adafruit_LEDBackpack 
     // (the parent class of Adafruit_AlphaNum4), so we can access 
     // it directly. This is one of those cases where reaching into 
     // the library's internals is the cleanest solution.
-    for (uint8_t i = 0; i < 4; i++) {
-        alpha4.displaybuffer[i] |= (1 << 14);
-    }
-    alpha4.writeDisplay();  // Single I2C transaction
-}
\ No newline at end of file
+    alpha4.displaybuffer[digit] |= (1 << 14);
+}
@@ -0,0 +1,87 @@
+// auto_policy.cpp — Per-userMode thresholds and cooldowns
+//
+// The cooldowns used to come out of the ramp itself: an edge threw 
+// motorSpeed negative, and the motor stayed off while the per-tick 
+// increment climbed it back past MOT_MIN — "seconds × FREQUENCY × 
+// increment" deep for that many seconds. The motor engine (motor.h) 
+// holds the output off for a set time instead, so these are now just 
+// the times the modes always meant.
+
+#include "auto_policy.h"
+
+int auto_pressure_limit(int userMode, int knob, const NoiseFloor& noise)
+{
+    if (userMode == 7 && noise.primed())
+    {
+        // Mode 7 follows the sensor instead: the top of the recent 
+        // noise plus a few deviations of margin, so a change in gain 
+        // or fit moves the threshold with it. The knob only biases 
+        // it, ±ADAPTIVE_BIAS_RANGE around the middle.
+        float top = noise.peak() + ADAPTIVE_DEVIATIONS * noise.deviation();
+        int bias = map(knob, 0, AUTO_KNOB_MAX, ADAPTIVE_BIAS_RANGE, -ADAPTIVE_BIAS_RANGE);
+        return constrain((int)(top + 0.5f) + bias, 10, (int)MAX_PRESSURE_LIMIT);
+    }
+
+    // Every other mode, and mode 7 for its first NOISE_WINDOW_SECONDS
+    return map(knob, 0, AUTO_KNOB_MAX, MAX_PRESSURE_LIMIT, 1);
+}
+
+int auto_knob_for_limit(int userMode, int limit, const NoiseFloor& noise)
+{
+    // map() truncates, so mapping back the other way can land a knob 
+    // off, and mode 7 has no closed-form inverse at all. Both are 
+    // monotone in the knob and there are only AUTO_KNOB_MAX+1 
+    // positions: take the first one at or below the limit.
+    for (int knob = 0; knob < AUTO_KNOB_MAX; knob++)
+        if (auto_pressure_limit(userMode, knob, noise) <= limit)
+            return knob;
+    return AUTO_KNOB_MAX;
+}
+
+uint32_t auto_cooldown_ms(int userMode, const AutoSettings& s, AutoEdgeState& e)
+{
+    uint32_t rampMs = (uint32_t)(s.rampUp > 1 ? s.rampUp : 1) * 1000;
+
+    switch (userMode)
+    {
+        case 1:  // Half ramp-up time as cooldown
+            return rampMs / 2;
+
+        case 2:  // Double ramp-up time as cooldown
+            return rampMs * 2;
+
+        case 3:  // Fixed cooldown (in seconds)
+            return (uint32_t)s.cooldown * 1000;
+
+        case 4:  // Slow creep — cooldown increases each edge
+        {
+            uint32_t ms = (uint32_t)e.minimumcooldown * 1000;
+            if (e.cooldownFlag == 1)
+            {
+                e.cooldownFlag = 0;
+                if (e.minimumcooldown <= s.maxCooldown)
+                    e.minimumcooldown += s.cooldownStep;
+            }
+            return ms;
+        }
+
+        case 5:  // More sensitive — lowers threshold each edge
+            if (e.cooldownFlag == 1)
+            {
+                e.cooldownFlag = 0;
+                int lowered = e.pressureLimit - s.pressureStep;
+                if (s.cooldown <= s.maxCooldown)
+                    e.pressureLimit = lowered > 10 ? lowered : 10;
+            }
+            return (uint32_t)s.cooldown * 1000;
+
+        case 6:  // Clench-responsive — half ramp, plus the time to climb 10 levels
+            return rampMs / 2 + rampMs * 10 / (uint32_t)(s.maxMotorSpeed > 1 ? s.maxMotorSpeed : 1);
+
+        case 7:  // Adaptive threshold — fixed cooldown, like mode 3
+            return (uint32_t)s.cooldown * 1000;
+
+        default:
+            return 0;
+    }
+}
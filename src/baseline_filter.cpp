@@ -0,0 +1,138 @@
+// baseline_filter.cpp — Fixed-point EMA / block-window baseline
+//
+// ═══════════════════════════════════════════════════════════════════════
+// CHOOSING THE SHIFT
+// ═══════════════════════════════════════════════════════════════════════
+//
+// An EMA with alpha = 2 / (N + 1) has roughly the same lag as an
+// N-sample box-car average. We round alpha to the nearest power of
+// two so the update is a shift instead of a multiply:
+//
+//   N = 2000 (2s at 1kHz)  →  alpha ≈ 1/1000  →  shift 10 (1/1024)
+//   N =  120 (2s at 60Hz)  →  alpha ≈ 1/60    →  shift  6 (1/64)
+//
+// For the window mode the window is BLOCKS (64) blocks long, and each
+// block is 2^shift samples, again rounded up to a power of two so the
+// final average is a shift:
+//
+//   N = 2000  →  block 32 samples  →  window 2048 samples
+//   N =  120  →  block  2 samples  →  window  128 samples
+//
+// ═══════════════════════════════════════════════════════════════════════
+// FIXED POINT
+// ═══════════════════════════════════════════════════════════════════════
+//
+// The EMA accumulator holds the average scaled by 2^16 ("Q16"), so the
+// fractional part isn't lost to integer truncation every sample. With
+// 12-bit samples the largest value is 4095 << 16 ≈ 2^28, comfortably
+// inside an int32_t. In Python terms:
+//
+//   acc = avg * 65536
+//   acc += ((sample * 65536) - acc) >> shift
+//   avg = round(acc / 65536)
+
+#include "baseline_filter.h"
+
+// Smallest s such that (base << s) >= n. Used to round a window length
+// up to a power-of-two multiple of `base`.
+static uint8_t ceil_shift(uint32_t n, uint32_t base)
+{
+    uint8_t s = 0;
+    while ((base << s) < n && s < 24) s++;
+    return s;
+}
+
+BaselineFilter::BaselineFilter(uint8_t mode, uint32_t windowSamples, uint8_t medianN)
+    : _mode(mode),
+      _medianN(medianN > MEDIAN_MAX ? MEDIAN_MAX : medianN)
+{
+    if (_mode == BASELINE_WINDOW) {
+        _shift = ceil_shift(windowSamples, BLOCKS);
+    } else {
+        // alpha = 1/2^shift ≈ 2/N  →  2^(shift+1) ≈ N
+        _shift = ceil_shift(windowSamples, 2);
+    }
+}
+
+void BaselineFilter::reset()
+{
+    _primed = false;
+    _value = 0;
+}
+
+void BaselineFilter::reset(uint16_t value)
+{
+    seed(value);
+}
+
+// Fill every stage with the same value, as if the input had been flat
+// at `value` forever.
+void BaselineFilter::seed(uint16_t value)
+{
+    _emaAcc = (int32_t)value << 16;
+
+    uint32_t blockValue = (uint32_t)value << _shift;
+    for (uint8_t i = 0; i < BLOCKS; i++) _blockSum[i] = blockValue;
+    _windowSum = blockValue * BLOCKS;
+    _partialSum = 0;
+    _partialCount = 0;
+    _blockIndex = 0;
+
+    for (uint8_t i = 0; i < MEDIAN_MAX; i++) _medianBuf[i] = value;
+    _medianIndex = 0;
+
+    _value = value;
+    _primed = true;
+}
+
+// Median of the last _medianN raw samples. Copies the small ring and
+// insertion-sorts it — at most 7 elements, so a bounded handful of
+// compares regardless of input.
+uint16_t BaselineFilter::median_prefilter(uint16_t sample)
+{
+    _medianBuf[_medianIndex] = sample;
+    if (++_medianIndex >= _medianN) _medianIndex = 0;
+
+    uint16_t sorted[MEDIAN_MAX];
+    for (uint8_t i = 0; i < _medianN; i++) {
+        uint16_t v = _medianBuf[i];
+        int8_t j = i - 1;
+        while (j >= 0 && sorted[j] > v) {
+            sorted[j + 1] = sorted[j];
+            j--;
+        }
+        sorted[j + 1] = v;
+    }
+    return sorted[_medianN / 2];
+}
+
+uint16_t BaselineFilter::update(uint16_t sample)
+{
+    if (!_primed) {
+        seed(sample);
+        return _value;
+    }
+
+    if (_medianN > 1) sample = median_prefilter(sample);
+
+    if (_mode == BASELINE_WINDOW) {
+        _partialSum += sample;
+        if (++_partialCount >= (1u << _shift)) {
+            // Block complete: swap it into the ring in place of the
+            // oldest block and adjust the running total. Two adds,
+            // no loop over the window.
+            _windowSum += _partialSum - _blockSum[_blockIndex];
+            _blockSum[_blockIndex] = _partialSum;
+            _blockIndex = (_blockIndex + 1) & (BLOCKS - 1);
+            _partialSum = 0;
+            _partialCount = 0;
+
+            _value = (uint16_t)(_windowSum >> (BLOCKS_LOG2 + _shift));
+        }
+    } else {
+        _emaAcc += (((int32_t)sample << 16) - _emaAcc) >> _shift;
+        _value = (uint16_t)((_emaAcc + (1 << 15)) >> 16);
+    }
+
+    return _value;
+}
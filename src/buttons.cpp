@@ -11,33 +11,38 @@ void button_init()
     digitalWrite(ENC_SW, HIGH);  // Enable internal pull-up resistor
 }
 
-uint8_t check_button()
+// Press classified on release, waiting for check_button() to collect it
+static uint8_t pendingPress = BTN_NONE;
+static uint32_t keyDownTime = 0;
+
+void button_handle_event(const InputEvent& ev)
 {
-    static bool lastBtn = ENC_SW_DOWN;
-    static unsigned long keyDownTime = 0;
-    uint8_t btnState = BTN_NONE;
-    bool thisBtn = digitalRead(ENC_SW);
-
-    // Detect the moment the button is pressed down
-    if (thisBtn == ENC_SW_DOWN && lastBtn == ENC_SW_UP) {
-        keyDownTime = millis();
-        if (DEBUG_BUTTONS) debug_print("buttonPush:", thisBtn); // Print to serial if enabled
+    if (ev.source != INPUT_ENC_BUTTON) return;
+
+    // The moment the button is pressed down
+    if (ev.pressed) {
+        keyDownTime = ev.timeMs;
+        if (DEBUG_BUTTONS) debug_print("buttonPush:", (int)ENC_SW_DOWN); // Print to serial if enabled
+        return;
     }
 
-    // Detect the moment the button is released — classify press length
-    if (thisBtn == ENC_SW_UP && lastBtn == ENC_SW_DOWN) {
-        unsigned long held = millis() - keyDownTime;
-        if (held >= V_LONG_PRESS_MS) {
-            btnState = BTN_V_LONG;
-        } else if (held >= LONG_PRESS_MS) {
-            btnState = BTN_LONG;
-        } else {
-            btnState = BTN_SHORT;
-        }
+    // The moment the button is released — classify press length
+    uint32_t held = ev.timeMs - keyDownTime;
+    if (held >= V_LONG_PRESS_MS) {
+        pendingPress = BTN_V_LONG;
+    } else if (held >= LONG_PRESS_MS) {
+        pendingPress = BTN_LONG;
+    } else {
+        pendingPress = BTN_SHORT;
     }
+}
+
+uint8_t check_button()
+{
+    uint8_t btnState = pendingPress;
+    pendingPress = BTN_NONE;
 
     if (DEBUG_BUTTONS) debug_print("buttonState:", btnState); // Print to serial if enabled
-    lastBtn = thisBtn;
     return btnState;
 }
 
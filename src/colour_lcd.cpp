@@ -19,11 +19,12 @@
 //    CS held LOW, data streamed via SPI.transfer(). CPU blocks until
 //    each byte is clocked out. Fine for small fills or init.
 //
-// 3. DMA PIXEL DATA (lcd_send_frame_async):
-//    CS held LOW, entire pixel buffer sent via DMA. CPU returns
-//    immediately and is free for other work. The DMA controller reads
-//    bytes from the buffer in the background, feeding them to the SPI
-//    peripheral at wire speed. A callback fires when done.
+// 3. DMA PIXEL DATA (lcd_*_async):
+//    CS held LOW, pixel data sent via DMA. CPU returns immediately and
+//    is free for other work. The DMA controller reads bytes from the 
+//    buffer in the background, feeding them to the SPI peripheral at 
+//    wire speed. A callback fires when done — and when streaming, 
+//    that callback queues up the next strip.
 //
 //    In Python terms, modes 1+2 are like:
 //      for byte in data: spi.write(byte)   # blocks
@@ -53,6 +54,26 @@
 
 constexpr uint32_t LCD_SPI_SPEED = 30000000;  // 30MHz — maximum using dodgy breadboard wiring, 40MHz should be possible on a dedicated board.
 
+// ── Sharing the bus ──────────────────────────────────────────────────
+// The SD card (session_recorder.cpp) is on the same SPI bus, and SdFat 
+// sets its own mode and clock for every access — on the Teensy 4 that 
+// rewrites the SPI peripheral's config, and endTransaction() doesn't 
+// put it back. So every LCD operation claims the bus with its own 
+// settings first and lets go when it's done: a blocking command or 
+// fill at its end, a DMA transfer from the completion interrupt once 
+// the last byte is out.
+static const SPISettings LCD_SPI_SETTINGS(LCD_SPI_SPEED, MSBFIRST, SPI_MODE3);
+
+static inline void lcd_bus_claim()
+{
+    SPI.beginTransaction(LCD_SPI_SETTINGS);
+}
+
+static inline void lcd_bus_release()
+{
+    SPI.endTransaction();
+}
+
 // ═══════════════════════════════════════════════════════════════════════
 // DMA state
 // ═══════════════════════════════════════════════════════════════════════
@@ -74,9 +95,60 @@ constexpr uint32_t LCD_SPI_SPEED = 30000000;  // 30MHz — maximum using dodgy b
 static EventResponder spiEvent;
 static volatile bool dmaBusy = false;
 
+// ── Strip streaming state ────────────────────────────────────────────
+// Two strip buffers, ping-ponged between "on the wire" and "being 
+// rendered". 2 × 3,840 pixels × 2 bytes = 15KB, small enough to live 
+// in DTCM — which the DMA engine can read directly and which is never 
+// cached, so there's no cache flush to worry about.
+//
+// stripLines[i] is how many lines buffer i currently holds, 0 = empty.
+
+// Aligned so renderers can fill rows with 32-bit stores.
+alignas(4) static uint16_t stripBuf[2][LCD_STRIP_PIXELS];
+static uint16_t stripLines[2] = { 0, 0 };
+static uint8_t  stripSending = 0;          // Buffer currently on the wire
+
+static LcdStripRenderFn streamRender = nullptr;   // nullptr = not streaming
+static uint16_t streamWidth = 0;
+static uint16_t streamHeight = 0;
+static uint16_t streamLinesPerStrip = 0;
+static uint16_t streamNextLine = 0;        // First line not yet rendered
+
+// Uniform streams (fills, repeated lines) produce the same pixels for 
+// every strip, so each buffer is rendered once when the stream starts 
+// and then just re-sent. stripPrimed[i] = buffer i already holds it.
+static bool streamUniform = false;
+static bool stripPrimed[2] = { false, false };
+
+// Render the next strip of the region into buffer `idx`. Leaves the 
+// buffer marked empty if the whole region has already been rendered.
+static void stream_render_into(uint8_t idx)
+{
+    uint16_t lines = 0;
+    if (streamNextLine < streamHeight) {
+        lines = streamHeight - streamNextLine;
+        if (lines > streamLinesPerStrip) lines = streamLinesPerStrip;
+        if (!(streamUniform && stripPrimed[idx])) {
+            streamRender(stripBuf[idx], streamNextLine, lines);
+            stripPrimed[idx] = true;
+        }
+        streamNextLine += lines;
+    }
+    stripLines[idx] = lines;
+}
+
+static void stream_send(uint8_t idx)
+{
+    stripSending = idx;
+    SPI.transfer((void*)stripBuf[idx], nullptr,
+                 (size_t)stripLines[idx] * streamWidth * 2, spiEvent);
+}
+
 // DMA completion callback — called from interrupt context when the
-// SPI DMA transfer finishes. Releases the chip select and clears
-// the busy flag.
+// SPI DMA transfer finishes. While streaming, it chains the next strip
+// straight onto the wire and then renders the one after into the 
+// buffer that just came free. Otherwise (or once the last strip is 
+// out) it releases the chip select and clears the busy flag.
 //
 // IMPORTANT: This runs in ISR (Interrupt Service Routine) context,
 // which means:
@@ -86,7 +158,21 @@ static volatile bool dmaBusy = false;
 // It's like a signal handler in Python — minimal work only.
 static void onDmaComplete(EventResponderRef event)
 {
+    if (streamRender != nullptr) {
+        uint8_t done = stripSending;
+        uint8_t next = done ^ 1;
+        stripLines[done] = 0;
+
+        if (stripLines[next] > 0) {
+            stream_send(next);            // Keep the wire busy first...
+            stream_render_into(done);     // ...then refill the free buffer
+            return;
+        }
+        streamRender = nullptr;           // Last strip is out
+    }
+
     digitalWriteFast(LCD_PIN_CS, HIGH);  // Release chip select
+    lcd_bus_release();                   // The SD card can have the bus
     dmaBusy = false;                     // Signal "ready for next frame"
 }
 
@@ -134,21 +220,6 @@ static void lcd_bulk_end()
 }
 
 
-// ═══════════════════════════════════════════════════════════════════════
-// Hardware reset
-// ═══════════════════════════════════════════════════════════════════════
-
-static void lcd_hardware_reset()
-{
-    digitalWriteFast(LCD_PIN_CS, LOW);
-    delay(20);
-    digitalWriteFast(LCD_PIN_RST, LOW);
-    delay(20);
-    digitalWriteFast(LCD_PIN_RST, HIGH);
-    delay(20);
-}
-
-
 // ═══════════════════════════════════════════════════════════════════════
 // Set draw window
 // ═══════════════════════════════════════════════════════════════════════
@@ -174,32 +245,50 @@ static void lcd_set_window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
 // ═══════════════════════════════════════════════════════════════════════
 // Initialisation
 // ═══════════════════════════════════════════════════════════════════════
-
-void lcd_init()
+//
+// The panel needs three 20ms reset phases and 120ms after sleep-out
+// before it will take pixels — about 200ms in all, nearly all of it
+// waiting. Rather than sit in delay() for that, lcd_init_start() kicks
+// off the reset and lcd_init_service() moves through the steps below
+// as each wait runs out, so the rest of setup (and the control loop)
+// carries on in the meantime.
+//
+// In Python terms it's a generator the boot code keeps calling next() on:
+//
+//   def init():
+//       cs_low();    yield wait(20)
+//       reset_low(); yield wait(20)
+//       reset_high(); yield wait(20)
+//       send_registers(); sleep_out(); yield wait(120)
+//       display_on(); yield wait(20)
+//       clear_async(); yield until_dma_done
+
+enum LcdInitStep : uint8_t {
+    LCD_INIT_NOT_STARTED,
+    LCD_INIT_RESET_ASSERT,        // CS low, waiting to pull RST low
+    LCD_INIT_RESET_LOW,           // RST low, waiting to release it
+    LCD_INIT_RESET_RELEASED,      // Waiting for the controller to wake
+    LCD_INIT_SLEEP_OUT,           // Registers sent, waiting out SLPOUT
+    LCD_INIT_DISPLAY_ON,          // Waiting for DISPON to settle
+    LCD_INIT_CLEARING,            // Black fill going out by DMA
+    LCD_INIT_DONE
+};
+
+static LcdInitStep initStep = LCD_INIT_NOT_STARTED;
+static uint32_t    initWaitFromMs = 0;
+static uint16_t    initWaitMs = 0;
+
+static void init_wait(LcdInitStep next, uint16_t ms)
 {
-    // ── GPIO setup ─────────────────────────────────────────────────────
-    pinMode(LCD_PIN_CS,  OUTPUT);
-    pinMode(LCD_PIN_DC,  OUTPUT);
-    pinMode(LCD_PIN_RST, OUTPUT);
-    digitalWriteFast(LCD_PIN_CS, HIGH);
-    digitalWriteFast(LCD_PIN_RST, HIGH);
-
-    // ── SPI setup ──────────────────────────────────────────────────────
-    SPI.begin();
-    SPI.beginTransaction(SPISettings(LCD_SPI_SPEED, MSBFIRST, SPI_MODE3));
-
-    // ── DMA completion handler ─────────────────────────────────────────
-    // attachImmediate() means the callback fires directly from the DMA
-    // interrupt — no queuing delay. The alternative attachInterrupt()
-    // queues it for the next yield(), which would add latency.
-    spiEvent.attachImmediate(onDmaComplete);
-
-    // ── Hardware reset ─────────────────────────────────────────────────
-    lcd_hardware_reset();
-
-    // ── Waveshare init sequence ────────────────────────────────────────
-    // (every register value verbatim from Waveshare's demo code)
+    initStep = next;
+    initWaitFromMs = millis();
+    initWaitMs = ms;
+}
 
+// Every register value verbatim from Waveshare's demo code. About 50
+// bytes at 30MHz — a few microseconds.
+static void lcd_send_init_registers()
+{
     lcd_write_command(0x36);  // MADCTL
     lcd_write_data(0x00);
 
@@ -261,14 +350,86 @@ void lcd_init()
     lcd_write_data(0x00);
 
     lcd_write_command(0x21);  // INVON
-    lcd_write_command(0x11);  // SLPOUT
-    delay(120);
-    lcd_write_command(0x29);  // DISPON
-    delay(20);
+}
 
-    lcd_fill(0x0000);
+void lcd_init_start()
+{
+    // ── GPIO setup ─────────────────────────────────────────────────────
+    pinMode(LCD_PIN_CS,  OUTPUT);
+    pinMode(LCD_PIN_DC,  OUTPUT);
+    pinMode(LCD_PIN_RST, OUTPUT);
+    digitalWriteFast(LCD_PIN_CS, HIGH);
+    digitalWriteFast(LCD_PIN_RST, HIGH);
+
+    // ── SPI setup ──────────────────────────────────────────────────────
+    SPI.begin();    // Settings go on per operation (lcd_bus_claim)
+
+    // ── DMA completion handler ─────────────────────────────────────────
+    // attachImmediate() means the callback fires directly from the DMA
+    // interrupt — no queuing delay. The alternative attachInterrupt()
+    // queues it for the next yield(), which would add latency.
+    spiEvent.attachImmediate(onDmaComplete);
 
-    Serial.println("[LCD] Init complete (40MHz SPI, DMA enabled)");
+    // ── Hardware reset, first phase ────────────────────────────────────
+    digitalWriteFast(LCD_PIN_CS, LOW);
+    init_wait(LCD_INIT_RESET_ASSERT, 20);
+}
+
+bool lcd_init_service()
+{
+    if (initStep == LCD_INIT_DONE) return true;
+    if (initStep == LCD_INIT_NOT_STARTED) return false;
+    if (millis() - initWaitFromMs < initWaitMs) return false;
+
+    switch (initStep) {
+        case LCD_INIT_RESET_ASSERT:
+            digitalWriteFast(LCD_PIN_RST, LOW);
+            init_wait(LCD_INIT_RESET_LOW, 20);
+            break;
+
+        case LCD_INIT_RESET_LOW:
+            digitalWriteFast(LCD_PIN_RST, HIGH);
+            init_wait(LCD_INIT_RESET_RELEASED, 20);
+            break;
+
+        case LCD_INIT_RESET_RELEASED:
+            lcd_bus_claim();
+            lcd_send_init_registers();
+            lcd_write_command(0x11);  // SLPOUT
+            lcd_bus_release();
+            init_wait(LCD_INIT_SLEEP_OUT, 120);
+            break;
+
+        case LCD_INIT_SLEEP_OUT:
+            lcd_bus_claim();
+            lcd_write_command(0x29);  // DISPON
+            lcd_bus_release();
+            init_wait(LCD_INIT_DISPLAY_ON, 20);
+            break;
+
+        case LCD_INIT_DISPLAY_ON:
+            // Clear whatever the panel woke up showing — by DMA, so 
+            // this doesn't block for the ~36ms a synchronous fill takes
+            if (lcd_fill_async(0x0000)) initStep = LCD_INIT_CLEARING;
+            break;
+
+        case LCD_INIT_CLEARING:
+            if (!lcd_frame_busy()) {
+                initStep = LCD_INIT_DONE;
+                Serial.println("[LCD] Init complete (30MHz SPI, DMA enabled)");
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    return initStep == LCD_INIT_DONE;
+}
+
+bool lcd_ready()
+{
+    return initStep == LCD_INIT_DONE;
 }
 
 
@@ -278,12 +439,14 @@ void lcd_init()
 
 void lcd_fill(uint16_t colour)
 {
+    lcd_bus_claim();
     lcd_set_window(0, 0, LCD_WIDTH - 1, LCD_HEIGHT - 1);
     lcd_bulk_start();
     for (uint32_t i = 0; i < LCD_PIXEL_COUNT; i++) {
         lcd_bulk_pixel(colour);
     }
     lcd_bulk_end();
+    lcd_bus_release();
 }
 
 
@@ -293,6 +456,7 @@ void lcd_fill(uint16_t colour)
 
 void lcd_begin_draw(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
 {
+    lcd_bus_claim();      // Held until lcd_end_draw()
     lcd_set_window(x0, y0, x1, y1);
     lcd_bulk_start();
 }
@@ -305,6 +469,7 @@ void lcd_push_pixel(uint16_t colour)
 void lcd_end_draw()
 {
     lcd_bulk_end();
+    lcd_bus_release();
 }
 
 
@@ -334,15 +499,20 @@ void lcd_end_draw()
 // all the content, hit "send all", and the system handles delivery
 // while you do something else.
 
-bool lcd_send_frame_async(const uint16_t* pixelData, uint32_t pixelCount)
+bool lcd_blit_rect_async(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+                         const uint16_t* pixels)
 {
     // Don't start a new transfer if one is in progress
-    if (dmaBusy) return false;
+    if (dmaBusy || pixels == nullptr) return false;
+    if (width == 0 || height == 0) return false;
+    if (x + width > LCD_WIDTH || y + height > LCD_HEIGHT) return false;
 
     // Set up the draw window (synchronous — just a few command bytes,
     // takes microseconds). This tells the ST7789 "the next pixels go
-    // into this rectangular region."
-    lcd_set_window(0, 0, LCD_WIDTH - 1, LCD_HEIGHT - 1);
+    // into this rectangular region." The bus is ours from here until
+    // onDmaComplete lets it go.
+    lcd_bus_claim();
+    lcd_set_window(x, y, x + width - 1, y + height - 1);
 
     // Assert CS and DC for data streaming.
     // These stay held throughout the entire DMA transfer. The
@@ -363,27 +533,159 @@ bool lcd_send_frame_async(const uint16_t* pixelData, uint32_t pixelCount)
     // but our buffer is uint16_t*. The DMA doesn't care about types —
     // it just moves bytes. The pixel data is already byte-swapped
     // (RGB565_BE) so the bytes are in the right order for the display.
+    // (If the buffer is in cached RAM rather than DTCM, the SPI library 
+    // flushes the cache for it before the DMA starts.)
     //
-    // pixelCount * 2 because each pixel is 2 bytes (uint16_t = 16 bits).
-    // The DMA counts in bytes, not pixels.
-    SPI.transfer((void*)pixelData, nullptr, pixelCount * 2, spiEvent);
+    // The count is in bytes: each pixel is 2 (uint16_t = 16 bits).
+    SPI.transfer((void*)pixels, nullptr, (size_t)width * height * 2, spiEvent);
 
     return true;
 }
 
+bool lcd_send_frame_async(const uint16_t* pixelData, uint32_t pixelCount)
+{
+    // Anything other than a whole frame would wrap around the window
+    if (pixelCount != LCD_PIXEL_COUNT) return false;
+    return lcd_blit_rect_async(0, 0, LCD_WIDTH, LCD_HEIGHT, pixelData);
+}
+
 bool lcd_frame_busy()
 {
     return dmaBusy;
 }
 
 
+// ═══════════════════════════════════════════════════════════════════════
+// Strip streaming
+// ═══════════════════════════════════════════════════════════════════════
+//
+// Timeline for a full-screen stream (16-line strips, 30MHz SPI):
+//
+//   main loop   render 0, render 1, start DMA 0 ─→ return
+//   DMA         |── strip 0 (~2ms) ──|── strip 1 ──|── strip 2 ──| ...
+//   ISR                              ↑ send 1,     ↑ send 2,
+//                                      render 2      render 3
+//
+// Each strip is rendered one strip-time (~2ms) before it's needed, so 
+// the render only has to keep ahead of the wire, not finish a whole 
+// frame first. The first pixels leave the Teensy within microseconds 
+// of the call instead of after a full-frame render.
+
+// Shared by lcd_stream_rect_async and the uniform fill/repeat helpers.
+static bool stream_start(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+                         LcdStripRenderFn render, bool uniform)
+{
+    if (dmaBusy || render == nullptr) return false;
+    if (width == 0 || height == 0) return false;
+    if (x + width > LCD_WIDTH || y + height > LCD_HEIGHT) return false;
+
+    lcd_bus_claim();      // Released by onDmaComplete after the last strip
+    lcd_set_window(x, y, x + width - 1, y + height - 1);
+
+    streamUniform = uniform;
+    stripPrimed[0] = false;
+    stripPrimed[1] = false;
+    streamRender = render;
+    streamWidth = width;
+    streamHeight = height;
+    streamLinesPerStrip = (uint16_t)(LCD_STRIP_PIXELS / width);
+    if (streamLinesPerStrip > height) streamLinesPerStrip = height;
+    streamNextLine = 0;
+
+    // Prime both buffers so the ISR always has the next strip ready
+    stream_render_into(0);
+    stream_render_into(1);
+
+    digitalWriteFast(LCD_PIN_CS, LOW);
+    digitalWriteFast(LCD_PIN_DC, HIGH);
+
+    // Busy BEFORE the DMA starts — same race as lcd_send_frame_async()
+    dmaBusy = true;
+    stream_send(0);
+
+    return true;
+}
+
+bool lcd_stream_rect_async(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+                           LcdStripRenderFn render)
+{
+    return stream_start(x, y, width, height, render, false);
+}
+
+bool lcd_stream_frame_async(LcdStripRenderFn render)
+{
+    return lcd_stream_rect_async(0, 0, LCD_WIDTH, LCD_HEIGHT, render);
+}
+
+bool lcd_streaming(LcdStripRenderFn render)
+{
+    // streamRender is cleared just before dmaBusy, in the same ISR
+    return dmaBusy && streamRender == render;
+}
+
+
+// ═══════════════════════════════════════════════════════════════════════
+// Async fill / repeat-line
+// ═══════════════════════════════════════════════════════════════════════
+//
+// Both are uniform streams: every strip is identical, so the two strip 
+// buffers are filled once, up front, and the ISR just keeps re-sending 
+// them until the rectangle is covered. A full-screen clear is 18 DMA 
+// chunks from the same two buffers — no per-strip work at all, and 
+// nothing is read from the caller's memory after the call returns.
+
+static uint32_t fillColour2x = 0;           // Swapped colour, doubled
+static const uint16_t* repeatLine = nullptr; // Only read while priming
+
+static void fill_render_strip(uint16_t* out, uint16_t y0, uint16_t lines)
+{
+    (void)y0;
+    uint32_t count = (uint32_t)lines * streamWidth;
+    uint32_t* out32 = (uint32_t*)out;    // stripBuf is 4-byte aligned
+    for (uint32_t i = 0; i < count / 2; i++) out32[i] = fillColour2x;
+    if (count & 1) out[count - 1] = (uint16_t)fillColour2x;
+}
+
+static void repeat_render_strip(uint16_t* out, uint16_t y0, uint16_t lines)
+{
+    (void)y0;
+    for (uint16_t i = 0; i < lines; i++) {
+        memcpy(out + (uint32_t)i * streamWidth, repeatLine, streamWidth * 2);
+    }
+}
+
+bool lcd_fill_rect_async(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+                         uint16_t colour)
+{
+    if (dmaBusy) return false;    // Don't touch fillColour2x mid-stream
+    uint16_t swapped = __builtin_bswap16(colour);
+    fillColour2x = (uint32_t)swapped | ((uint32_t)swapped << 16);
+    return stream_start(x, y, width, height, fill_render_strip, true);
+}
+
+bool lcd_fill_async(uint16_t colour)
+{
+    return lcd_fill_rect_async(0, 0, LCD_WIDTH, LCD_HEIGHT, colour);
+}
+
+bool lcd_repeat_line_async(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+                           const uint16_t* line)
+{
+    if (line == nullptr) return false;
+    repeatLine = line;
+    bool started = stream_start(x, y, width, height, repeat_render_strip, true);
+    repeatLine = nullptr;
+    return started;
+}
+
+
 // ═══════════════════════════════════════════════════════════════════════
 // Test tick — cycle through solid colours
 // ═══════════════════════════════════════════════════════════════════════
 
 void lcd_test_tick()
 {
-    // Don't run sync fills while DMA is active
+    // Wait for the previous fill to finish going out
     if (dmaBusy) return;
 
     static unsigned long lastChange = 0;
@@ -395,7 +697,7 @@ void lcd_test_tick()
     const uint16_t colours[] = { 0xF800, 0x07E0, 0x001F, 0xFFFF };
     const char* names[] = { "RED", "GREEN", "BLUE", "WHITE" };
 
-    lcd_fill(colours[colourIndex]);
+    lcd_fill_async(colours[colourIndex]);
     Serial.print("[LCD] Fill: ");
     Serial.println(names[colourIndex]);
 
@@ -0,0 +1,21 @@
+// crc16.cpp — Nibble-table CRC-16/CCITT-FALSE
+
+#include "crc16.h"
+
+// Nibble-at-a-time CRC table for polynomial 0x1021. 16 entries 
+// instead of 256 — two lookups per byte, 32 bytes of flash.
+static const uint16_t CRC16_NIBBLE[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+uint16_t crc16_ccitt(const uint8_t* data, size_t len)
+{
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < len; i++) {
+        uint8_t b = data[i];
+        crc = (uint16_t)(crc << 4) ^ CRC16_NIBBLE[(crc >> 12) ^ (b >> 4)];
+        crc = (uint16_t)(crc << 4) ^ CRC16_NIBBLE[(crc >> 12) ^ (b & 0x0F)];
+    }
+    return crc;
+}
@@ -0,0 +1,119 @@
+// edge_guard.cpp — ISR-side edge detection and motor cut
+//
+// ═══════════════════════════════════════════════════════════════════════
+// HANDSHAKE BETWEEN ISR AND MAIN LOOP
+// ═══════════════════════════════════════════════════════════════════════
+//
+//   main loop (60Hz)                    sampler ISR (1kHz)
+//   ────────────────                    ──────────────────
+//   edge_guard_arm(pressureLimit) ──→   guardLimit, guardArmed
+//                                       baseline filter (same ISR)
+//                                       sample - baseline > limit?
+//                                         motor_emergency_cut()
+//                                         tripPending = true
+//   edge_guard_take_event()       ◄──   tripPending
+//   → run_auto() starts cooldown
+//     motor_engine_cut(holdMs)
+//       hold in place, then
+//       motor_release_cut()
+//
+// The latch is only let go once the cooldown hold is holding the
+// output at 0, so at no point between the trip and the cooldown can
+// the 1kHz engine see "not cut, not holding" and step the motor on.
+//
+// Every shared variable is a single aligned 32-bit word (or a bool),
+// which the Cortex-M7 reads and writes atomically, so no locking is
+// needed — only 'volatile' to stop the compiler caching them.
+
+#include "edge_guard.h"
+#include "config.h"
+#include "motor.h"
+
+static volatile bool     guardArmed    = false;
+static volatile int32_t  guardLimit    = MAX_PRESSURE_LIMIT;
+static volatile bool     tripPending   = false;
+static volatile uint32_t tripCount     = 0;
+
+// Consecutive over-limit samples seen so far (ISR-private).
+static uint8_t overCount = 0;
+
+// Fed from the same call as the guard, so it sees exactly the deltas
+// the guard judges, at whatever rate the source produces them
+static NoiseFloor noise((uint32_t)PRESSURE_SAMPLE_HZ * NOISE_WINDOW_SECONDS);
+
+// The live sensor's statistics while a replay has the guard
+static NoiseFloor liveNoise((uint32_t)PRESSURE_SAMPLE_HZ * NOISE_WINDOW_SECONDS);
+static bool noiseStashed = false;
+
+
+void edge_guard_arm(int limit)
+{
+    if (!guardArmed) {
+        // Fresh arm — forget anything that happened while disarmed
+        tripPending = false;
+        overCount = 0;
+    }
+    guardLimit = limit;
+    guardArmed = true;
+}
+
+void edge_guard_disarm()
+{
+    guardArmed = false;
+    tripPending = false;
+    motor_release_cut();
+}
+
+void edge_guard_feed(uint16_t sample, uint16_t baseline)
+{
+    int32_t delta = (int32_t)sample - (int32_t)baseline;
+    noise.update(delta);
+
+    if (!guardArmed) return;
+
+    if (delta > guardLimit) {
+        // Require EDGE_GUARD_CONFIRM_SAMPLES in a row so a single
+        // glitchy conversion can't trigger a cut on its own.
+        if (overCount < EDGE_GUARD_CONFIRM_SAMPLES) overCount++;
+        if (overCount >= EDGE_GUARD_CONFIRM_SAMPLES && !tripPending) {
+            motor_emergency_cut();
+            tripPending = true;
+            tripCount = tripCount + 1;
+        }
+    } else {
+        overCount = 0;
+    }
+}
+
+bool edge_guard_take_event()
+{
+    if (!tripPending) return false;
+    tripPending = false;
+    return true;
+}
+
+uint32_t edge_guard_trip_count()
+{
+    return tripCount;
+}
+
+const NoiseFloor& edge_guard_noise()
+{
+    return noise;
+}
+
+void edge_guard_stash_noise(uint32_t sampleHz)
+{
+    if (!noiseStashed) {
+        liveNoise = noise;
+        noiseStashed = true;
+    }
+    noise.reset(sampleHz * NOISE_WINDOW_SECONDS);
+}
+
+void edge_guard_restore_noise()
+{
+    if (!noiseStashed) return;
+    noise = liveNoise;
+    noiseStashed = false;
+}
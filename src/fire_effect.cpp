@@ -1,4 +1,4 @@
-// fire_effect.cpp — Doom Fire effect with DMA double-buffering
+// fire_effect.cpp — Doom Fire effect, strip-streamed to the LCD
 //
 // The classic PSX Doom fire algorithm, rendering to the ST7789V2 LCD
 // via async DMA transfers. The CPU never blocks on display output.
@@ -10,15 +10,14 @@
 // Three distinct phases run in a pipeline:
 //
 //   1. SIMULATE  — fire_step() updates the 60×70 heat grid (~0.1ms)
-//   2. RENDER    — fire_render_to_buffer() scales 4× into a pixel
-//                  buffer with pre-swapped RGB565 colours (~1ms)
-//   3. TRANSFER  — DMA streams the pixel buffer to the LCD (~27ms)
+//   2. RENDER    — fire_render_strip() scales 4× into a 16-line strip
+//                  with pre-swapped RGB565 colours (a few µs per strip)
+//   3. TRANSFER  — DMA streams each strip to the LCD (~27ms per frame)
 //
-// Phase 3 runs in the background via DMA. While the DMA controller
-// is streaming frame N to the display, the CPU is free to run the
-// main loop (motor control, pressure sensing, LED updates, etc).
-// On the next tick where DMA is idle, we simulate and render frame
-// N+1, then kick off a new DMA transfer.
+// Phases 2 and 3 overlap: the LCD driver asks for strip N+1 while 
+// strip N is on the wire (see lcd_stream_frame_async). The heat grid 
+// only changes in fire_step(), which only runs once the whole frame 
+// has gone out, so the strips of one frame always match.
 //
 // In Python terms, the pipeline is like:
 //
@@ -26,33 +25,21 @@
 //       while True:
 //           if not dma_busy():
 //               fire_step()
-//               render_to_buffer(back_buffer)
-//               swap_buffers()
-//               await start_dma(front_buffer)  # returns immediately
+//               start_stream(render_strip)  # returns immediately
 //           await sleep(0)  # yield to other tasks
 //
 // ═══════════════════════════════════════════════════════════════════════
 // MEMORY LAYOUT
 // ═══════════════════════════════════════════════════════════════════════
 //
-// The fire simulation grid is tiny: 60×70 = 4,200 bytes.
-// The pixel buffers are large: 2 × 67,200 pixels × 2 bytes = 268,800.
+// The fire simulation grid is tiny: 60×70 = 4,200 bytes, and that's 
+// all this module owns. The pixels only ever exist one strip at a 
+// time, in the LCD driver's two 7.5KB strip buffers.
 //
-// DMAMEM places the pixel buffers in the Teensy 4.0's secondary RAM
-// (RAM2 / OCRAM, 512KB). This is important for two reasons:
-//
-//   1. CAPACITY: Keeps 268KB out of the primary DTCM (512KB), which
-//      is needed for the stack, heap, and time-critical variables.
-//
-//   2. DMA COMPATIBILITY: RAM2 is configured as non-cacheable by the
-//      Teensy's default MPU (Memory Protection Unit) settings. This
-//      means CPU writes go directly to physical RAM — no risk of DMA
-//      reading stale cached data. Without this, we'd need explicit
-//      cache flush calls (arm_dcache_flush) before every DMA transfer.
-//
-// In Python terms, DMAMEM is like choosing between a fast local dict
-// (DTCM) and a larger but slightly slower database (RAM2). We put
-// the big buffers in the database and keep the hot data local.
+// This used to render into two full-frame buffers in RAM2 (DMAMEM, 
+// 2 × 134,400 bytes = 268,800 — over half of RAM2) just to show a 
+// 60×70 image. Streaming strips frees all of that for logging and 
+// session buffers.
 //
 // ═══════════════════════════════════════════════════════════════════════
 // 4× SCALING
@@ -60,51 +47,40 @@
 //
 // Each 60×70 fire cell becomes a 4×4 pixel block on the 240×280 LCD:
 //
-//   For each fire row (70 rows):
-//     For each of 4 LCD sub-rows:
+//   For each LCD line in the strip:
+//     First line of a fire row?
 //       For each fire column (60 columns):
 //         Write the colour 4 times (4× horizontal)
+//     Otherwise:
+//       Copy the line above (4× vertical)
 //
 // This gives bold, chunky flames where individual cells are clearly
 // visible — more like a roaring campfire than a delicate candle.
 
 #include "fire_effect.h"
 #include "colour_lcd.h"
+#include "fast_rand.h"
 
 // ── Fire simulation buffer ───────────────────────────────────────────
 // Each cell holds a heat value from 0 (cold) to PALETTE_SIZE-1 (max).
 // At 60×70 = 4,200 bytes, this lives in fast DTCM where the CPU can
 // blaze through it. 'static' = file-private (like Python's _underscore).
-static uint8_t fireBuffer[FIRE_WIDTH * FIRE_HEIGHT];
+//
+// Aligned to 4 bytes so fire_step() can read four cells at a time 
+// with one 32-bit load (FIRE_WIDTH is a multiple of 4, so every row 
+// starts aligned too).
+alignas(4) static uint8_t fireBuffer[FIRE_WIDTH * FIRE_HEIGHT];
+static_assert(FIRE_WIDTH % 4 == 0, "fire_step() processes cells in groups of 4");
 
 // Convenience macro to access the flat array as a 2D grid.
 // In Python: fire[y][x]. In C: fire[y * width + x].
 #define FIRE_PIXEL(x, y) fireBuffer[(y) * FIRE_WIDTH + (x)]
 
-// ── Pixel double-buffers ─────────────────────────────────────────────
-// Two full-frame buffers for ping-pong rendering.
-//
-// DMAMEM tells the linker to place these in RAM2 (OCRAM) instead of
-// the default DTCM. This is a Teensy-specific attribute — it doesn't
-// exist in standard C++. On the Teensy 4.0, the linker script defines
-// a special section for DMAMEM that maps to the 512KB OCRAM region.
-//
-// Each buffer: 67,200 pixels × 2 bytes = 134,400 bytes.
-// Two buffers: 268,800 bytes total in RAM2.
-// RAM2 is 512KB, so this uses about 52% — plenty of room.
-DMAMEM static uint16_t pixelBuf[2][LCD_PIXEL_COUNT];
-
-// Which buffer the CPU will render into next.
-// After rendering, we send this buffer to DMA and flip the index.
-// The DMA reads from pixelBuf[1 - writeIndex] (the "front" buffer)
-// while the CPU writes to pixelBuf[writeIndex] (the "back" buffer).
-static uint8_t writeIndex = 0;
-
 // ── Palette (pre-swapped for DMA) ────────────────────────────────────
 //
 // 37 entries mapping heat (0-36) to byte-swapped RGB565 fire colours.
 //
-// These use RGB565_BE instead of RGB565 because the pixel buffers are
+// These use RGB565_BE instead of RGB565 because the pixel strips are
 // sent to the display via DMA, which reads bytes sequentially from
 // memory. The ST7789 expects big-endian byte order, but ARM stores
 // uint16_t as little-endian. Pre-swapping at compile time means zero
@@ -156,6 +132,14 @@ static const uint16_t firePalette[PALETTE_SIZE] = {
     RGB565_BE(0xFF, 0xFF, 0xFF),   // 36: pure white — the fuel source
 };
 
+// Same palette with each colour duplicated into both halves of a 
+// 32-bit word, built once in fire_init(). One load + two 32-bit 
+// stores then writes a whole 4-pixel-wide cell.
+static uint32_t firePalette2x[PALETTE_SIZE];
+
+// Random source for fire_step() — see fast_rand.h
+static FastRand fireRand;
+
 // ── Tuneable parameters ──────────────────────────────────────────────
 // These are the "knobs" that external code can turn via the setter
 // functions. They're file-scope statics (module-private), with the
@@ -192,13 +176,11 @@ void fire_init()
         FIRE_PIXEL(x, FIRE_HEIGHT - 1) = fireIntensity;
     }
 
-    // Clear both pixel buffers to black (0x0000).
-    // Even though they're in RAM2, memset works fine — it's still
-    // normal memory, just at a different address range.
-    memset(pixelBuf[0], 0, sizeof(pixelBuf[0]));
-    memset(pixelBuf[1], 0, sizeof(pixelBuf[1]));
+    for (uint8_t i = 0; i < PALETTE_SIZE; i++) {
+        firePalette2x[i] = (uint32_t)firePalette[i] | ((uint32_t)firePalette[i] << 16);
+    }
 
-    writeIndex = 0;
+    fireRand.seed(hal_micros());
 }
 
 
@@ -207,90 +189,134 @@ void fire_init()
 // ═══════════════════════════════════════════════════════════════════════
 //
 // Iterates top-to-bottom so we read from unmodified cells below.
-// At 60×70 = 4,200 cells on a 600MHz ARM, this takes well under 1ms.
+//
+// This used to call random() twice per cell (8,400 calls a frame) and 
+// constrain() the destination. Now it works on FOUR cells at a time, 
+// packed into one 32-bit word, with ONE xorshift call per group:
+//
+//   r = 32 random bits
+//     bits 0-3 of each byte → cooling nibble (scaled to 0..maxCooling-1)
+//     bits 4-5 of each byte → wind (0..3, minus 1 → -1..+2)
+//
+//   src4   = the 4 heat bytes below, one 32-bit load
+//   cool4  = (nibbles × maxCooling) >> 4, all 4 bytes in one multiply
+//            (15 × 16 = 240 still fits in a byte, so lanes never carry)
+//   heat4  = src4 - cool4, each byte clamped at 0 — UQSUB8 on the M7,
+//            a single SIMD instruction for all four cells
+//
+// Only the scattered wind stores are done per cell. Groups away from 
+// the edges can't be blown off the grid, so they skip the clamp.
+//
+// Cooling is (nibble × maxCooling) >> 4 instead of random(0, max) — 
+// the same range and very nearly the same spread, without a divide.
+
+// Saturating per-byte subtract: each byte of a minus the same byte 
+// of b, floored at 0. In Python: [max(0, x - y) for x, y in zip(a, b)]
+static inline uint32_t sub_sat_u8x4(uint32_t a, uint32_t b)
+{
+#if defined(__ARM_FEATURE_SIMD32)
+    uint32_t r;
+    asm("uqsub8 %0, %1, %2" : "=r"(r) : "r"(a), "r"(b));
+    return r;
+#else
+    uint32_t r = 0;
+    for (int i = 0; i < 32; i += 8) {
+        uint8_t x = a >> i, y = b >> i;
+        r |= (uint32_t)(x > y ? x - y : 0) << i;
+    }
+    return r;
+#endif
+}
+
+// Scatter one group of 4 cells into the destination row.
+// EDGE = true only for the groups at each end of the row.
+template <bool EDGE>
+static inline void fire_store4(uint8_t* dst, int x, uint32_t heat4, uint32_t wind4)
+{
+    for (int i = 0; i < 4; i++) {
+        int destX = x + i + (int)((wind4 >> (i * 8)) & 0x03) - 1;
+        if (EDGE) {
+            if (destX < 0) destX = 0;
+            if (destX > FIRE_WIDTH - 1) destX = FIRE_WIDTH - 1;
+        }
+        dst[destX] = (uint8_t)(heat4 >> (i * 8));
+    }
+}
 
-static void fire_step()
+void fire_step()
 {
+    const uint32_t maxCooling = fireMaxCooling;
+
     for (int y = 0; y < FIRE_HEIGHT - 1; y++) {
-        for (int x = 0; x < FIRE_WIDTH; x++) {
-            // Read heat from the cell directly below
-            uint8_t srcHeat = FIRE_PIXEL(x, y + 1);
-
-            // Random cooling: subtract 0 to (fireMaxCooling-1) heat units.
-            // This is what makes the flame taper off as it rises.
-            // Higher fireMaxCooling → more aggressive cooling → shorter flames.
-            // Controlled externally via fire_set_cooling().
-            uint8_t cooling = random(0, fireMaxCooling);
-
-            // Random horizontal drift for organic wobble.
-            // The & 3 maps random bits to 0-3, minus 1 gives -1 to +2.
-            // Slight rightward bias creates a subtle "wind" effect.
-            int wind = (random(0, 256) & 3) - 1;
-            int destX = constrain(x + wind, 0, FIRE_WIDTH - 1);
-
-            // Apply cooling, clamped to zero
-            int newHeat = srcHeat - cooling;
-            if (newHeat < 0) newHeat = 0;
-            FIRE_PIXEL(destX, y) = (uint8_t)newHeat;
+        uint8_t* dst = &FIRE_PIXEL(0, y);
+        const uint32_t* src = (const uint32_t*)&FIRE_PIXEL(0, y + 1);
+
+        for (int x = 0; x < FIRE_WIDTH; x += 4) {
+            uint32_t r = fireRand.next();
+
+            uint32_t cool4 = (((r & 0x0F0F0F0F) * maxCooling) >> 4) & 0x0F0F0F0F;
+            uint32_t wind4 = (r >> 4) & 0x03030303;
+            uint32_t heat4 = sub_sat_u8x4(src[x / 4], cool4);
+
+            // Wind reaches at most 1 left / 2 right, so only the first 
+            // and last group can land outside the row
+            if (x == 0 || x + 4 >= FIRE_WIDTH) {
+                fire_store4<true>(dst, x, heat4, wind4);
+            } else {
+                fire_store4<false>(dst, x, heat4, wind4);
+            }
         }
     }
 }
 
 
 // ═══════════════════════════════════════════════════════════════════════
-// Render to pixel buffer — 4× scaling with pre-swapped colours
+// Render one strip — 4× scaling with pre-swapped colours
 // ═══════════════════════════════════════════════════════════════════════
 //
-// Converts the 60×70 heat grid into a 240×280 pixel buffer ready for
-// DMA transfer. Each fire cell becomes a 4×4 block of identical pixels.
+// Called by the LCD driver for each strip of the frame: fill `lines` 
+// LCD rows starting at LCD row y0. Each fire cell becomes a 4×4 block 
+// of identical pixels, written left to right, top to bottom — the 
+// order the ST7789 expects.
 //
-// The output is written sequentially to the buffer — left to right,
-// top to bottom — matching the order the ST7789 expects pixels. This
-// means DMA can just blast the buffer byte-by-byte and the display
-// fills correctly.
+// Runs in the DMA completion interrupt (after the first two strips), 
+// so it has to be quick. Only the first LCD line of each fire row is 
+// built from the palette; the other three are a memcpy of the line 
+// above — 16 lines costs 4 palette passes plus 12 copies, a few µs.
 //
-// PERFORMANCE NOTE:
-// Writing to RAM2 (DMAMEM) is slightly slower than DTCM (~2 cycles
-// vs 1 cycle per access), but at 67,200 pixels this still takes only
-// ~1-2ms on the 600MHz Cortex-M7. The sequential write pattern also
-// means the memory bus pipeline stays full — no random access stalls.
+// Each palette pass writes 32 bits at a time: firePalette2x holds each 
+// colour twice, so a 4-pixel cell is two word stores instead of four 
+// halfword stores. (The strip buffers are 4-byte aligned, and a 
+// 240-pixel row is 480 bytes, so every row starts aligned.)
 
-static void fire_render_to_buffer(uint16_t* buf)
+void fire_render_strip(uint16_t* out, uint16_t y0, uint16_t lines)
 {
-    // 'offset' tracks our position in the flat pixel buffer.
-    // We increment it for every pixel we write, and it naturally
-    // wraps through all 67,200 positions left-to-right, top-to-bottom.
-    uint32_t offset = 0;
-
-    for (int y = 0; y < FIRE_HEIGHT; y++)
+    for (uint16_t i = 0; i < lines; i++)
     {
-        // Each fire row produces FIRE_SCALE (4) identical LCD rows.
-        // We repeat the same row data 4 times for vertical scaling.
-        for (int rep = 0; rep < FIRE_SCALE; rep++)
+        uint16_t y = y0 + i;
+        uint16_t* row = out + (uint32_t)i * LCD_WIDTH;
+
+        // Same fire row as the line above, and that line is in this 
+        // strip? Just copy it.
+        if (i > 0 && (y % FIRE_SCALE) != 0) {
+            memcpy(row, row - LCD_WIDTH, LCD_WIDTH * sizeof(uint16_t));
+            continue;
+        }
+
+        const uint8_t* heat = &FIRE_PIXEL(0, y / FIRE_SCALE);
+        uint32_t* row32 = (uint32_t*)row;
+        for (int x = 0; x < FIRE_WIDTH; x++)
         {
-            for (int x = 0; x < FIRE_WIDTH; x++)
-            {
-                // Look up the pre-swapped colour for this cell's heat.
-                // The palette already contains byte-swapped RGB565
-                // values (via RGB565_BE), so no conversion needed here.
-                uint16_t colour = firePalette[FIRE_PIXEL(x, y)];
-
-                // Write the colour FIRE_SCALE (4) times for horizontal
-                // scaling. Each fire pixel becomes 4 LCD pixels wide.
-                buf[offset]     = colour;
-                buf[offset + 1] = colour;
-                buf[offset + 2] = colour;
-                buf[offset + 3] = colour;
-                offset += FIRE_SCALE;
-            }
+            // Look up the pre-swapped, pre-doubled colour for this 
+            // cell's heat (two RGB565_BE pixels in one word).
+            uint32_t colour2 = firePalette2x[heat[x]];
+
+            // Two word stores = FIRE_SCALE (4) pixels across.
+            row32[0] = colour2;
+            row32[1] = colour2;
+            row32 += FIRE_SCALE / 2;
         }
     }
-
-    // Sanity check: we should have written exactly LCD_PIXEL_COUNT pixels.
-    // 60 × 4 × 70 × 4 = 67,200 ✓
-    // This assert is compiled out in release builds but catches bugs 
-    // during development. In Python you'd use assert offset == 67200.
-    // (void)offset;  // suppress unused warning if asserts disabled
 }
 
 
@@ -301,6 +327,7 @@ static void fire_render_to_buffer(uint16_t* buf)
 // Called every main loop tick (60Hz). The actual fire frame rate is
 // determined by how fast DMA can push frames — at 40MHz SPI with
 // 134,400 bytes per frame, that's ~27ms per frame = ~37 FPS.
+// (30MHz on the current breadboard wiring: ~36ms, ~28 FPS.)
 //
 // If DMA is still busy sending the last frame, we simply skip this
 // tick. No work wasted, no CPU stalled. The main loop continues at
@@ -308,7 +335,7 @@ static void fire_render_to_buffer(uint16_t* buf)
 //
 // Timeline for a typical frame:
 //
-//   Tick 0:  DMA idle → fire_step (0.1ms) → render (1.5ms) → start DMA
+//   Tick 0:  DMA idle → fire_step (0.1ms) → start strip stream
 //   Tick 1:  DMA busy → skip (0ms) ← main loop runs other stuff
 //   Tick 2:  DMA idle → fire_step → render → start DMA
 //   ...
@@ -334,23 +361,10 @@ void fire_tick()
     // Run the fire simulation
     fire_step();
 
-    // Render the fire into the current write buffer (4× scaled,
-    // pre-swapped colours ready for DMA)
-    fire_render_to_buffer(pixelBuf[writeIndex]);
-
-    // Kick off the DMA transfer of this buffer to the display.
-    // lcd_send_frame_async sets up the draw window, asserts CS,
-    // and starts the DMA — then returns immediately.
-    lcd_send_frame_async(pixelBuf[writeIndex], LCD_PIXEL_COUNT);
-
-    // Flip to the other buffer for next time.
-    // While DMA reads from pixelBuf[writeIndex] (now the "front"),
-    // we'll render the next frame into pixelBuf[1 - writeIndex]
-    // (the "back"). Classic double-buffer swap.
-    //
-    // In Python: writeIndex = 1 - writeIndex
-    // Or equivalently: writeIndex ^= 1 (XOR toggle between 0 and 1)
-    writeIndex = 1 - writeIndex;
+    // Start streaming the frame. The driver renders the first two 
+    // strips right now, starts the DMA, and returns; the remaining 
+    // strips are rendered from the DMA interrupt as the wire frees up.
+    lcd_stream_frame_async(fire_render_strip);
 }
 
 
@@ -380,9 +394,12 @@ void fire_set_intensity(uint8_t heat)
 
 void fire_set_cooling(uint8_t maxCooling)
 {
-    // Minimum of 1: random(0, 0) is undefined/pointless.
-    // In practice values above ~6 make the fire almost invisible.
+    // Minimum of 1: zero cooling fills the whole screen solid.
+    // Maximum of 16: fire_step() scales a 4-bit random value by this 
+    // and the product has to fit in a byte. In practice values above 
+    // ~6 make the fire almost invisible anyway.
     if (maxCooling < 1) maxCooling = 1;
+    if (maxCooling > 16) maxCooling = 16;
     fireMaxCooling = maxCooling;
 }
 
@@ -394,4 +411,19 @@ uint8_t fire_get_intensity()
 uint8_t fire_get_cooling()
 {
     return fireMaxCooling;
+}
+
+
+// ═══════════════════════════════════════════════════════════════════════
+// Host tests and benchmarks
+// ═══════════════════════════════════════════════════════════════════════
+
+void fire_seed(uint32_t seed)
+{
+    fireRand.seed(seed);
+}
+
+const uint8_t* fire_heat()
+{
+    return fireBuffer;
 }
\ No newline at end of file
@@ -0,0 +1,102 @@
+// frame_coordinator.cpp — One render loop for every display
+
+#include "frame_coordinator.h"
+#include "scheduler.h"
+
+struct DisplaySlot {
+    const Display* display;
+    uint32_t costUs;          // Peak-hold estimate of one render
+    uint8_t  waiting;         // Consecutive ticks it wanted and missed
+    uint32_t frames;
+    uint32_t missed;
+    uint32_t forced;
+};
+
+static DisplaySlot slots[FRAMES_MAX_DISPLAYS];
+static uint8_t slotCount = 0;
+
+// Rises straight to a slower render; after a one-off spike, falls back
+// by 1/8 of the gap per render. Like a VU meter's peak hold.
+static inline uint32_t track_cost(uint32_t cost, uint32_t measured)
+{
+    if (measured >= cost) return measured;
+    return cost - (cost - measured) / 8;
+}
+
+bool frames_add(const Display* display)
+{
+    if (slotCount >= FRAMES_MAX_DISPLAYS || display == nullptr || display->render == nullptr) {
+        return false;
+    }
+
+    DisplaySlot& s = slots[slotCount++];
+    s = {};
+    s.display = display;
+    s.costUs = display->initialCostUs;
+    return true;
+}
+
+void frames_run()
+{
+    // Hungriest first: a display that missed last tick gets first go
+    // at this one. Insertion sort — there are only a handful, and it
+    // keeps registration order among equals.
+    uint8_t order[FRAMES_MAX_DISPLAYS];
+    for (uint8_t i = 0; i < slotCount; i++) {
+        uint8_t j = i;
+        while (j > 0 && slots[order[j - 1]].waiting < slots[i].waiting) {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = i;
+    }
+
+    for (uint8_t k = 0; k < slotCount; k++) {
+        DisplaySlot& s = slots[order[k]];
+        const Display& d = *s.display;
+
+        if (d.wantsFrame && !d.wantsFrame()) {
+            s.waiting = 0;
+            continue;
+        }
+
+        // Still sending the last frame by DMA — nothing to gain by 
+        // trying now, and it isn't this tick's fault, so no penalty
+        if (d.isBusy && d.isBusy()) continue;
+
+        int32_t left = scheduler_slack_us();
+        bool fits = left > 0 && s.costUs <= (uint32_t)left;
+        bool force = s.waiting >= FRAMES_FORCE_AFTER;
+
+        if (!fits && !force) {
+            s.waiting++;
+            s.missed++;
+            continue;
+        }
+
+        uint32_t start = micros();
+        d.render(left > 0 ? (uint32_t)left : 0);
+        s.costUs = track_cost(s.costUs, micros() - start);
+
+        if (!fits) s.forced++;
+        s.frames++;
+        s.waiting = 0;
+    }
+}
+
+uint8_t frames_count()
+{
+    return slotCount;
+}
+
+bool frames_stats(uint8_t index, FrameStats& out)
+{
+    if (index >= slotCount) return false;
+    const DisplaySlot& s = slots[index];
+    out.name   = s.display->name;
+    out.frames = s.frames;
+    out.missed = s.missed;
+    out.forced = s.forced;
+    out.costUs = s.costUs;
+    return true;
+}
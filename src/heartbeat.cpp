@@ -0,0 +1,269 @@
+// heartbeat.cpp — Fixed-point Pan-Tompkins QRS detection
+//
+// ═══════════════════════════════════════════════════════════════════════
+// THE FILTER CHAIN (all at HEARTBEAT_DETECT_HZ, x = input, y = output)
+// ═══════════════════════════════════════════════════════════════════════
+//
+//   low-pass    y[n] = 2y[n-1] - y[n-2] + x[n] - 2x[n-6] + x[n-12]
+//               (gain 36, so the output is scaled back down by 32)
+//   high-pass   y[n] = x[n-16] - mean(x[n-31..n])
+//               (a 32-tap running mean subtracted from the middle tap)
+//   derivative  y[n] = (2x[n] + x[n-1] - x[n-3] - 2x[n-4]) / 8
+//   square      y[n] = x[n]²
+//   integrate   y[n] = sum(x[n-N+1..n]),  N = 150ms of samples
+//
+// Each stage keeps its history in a small power-of-two ring indexed by
+// the sample number, so a "tap" is just an AND with the mask. The
+// integrator is a running sum and is never divided — the thresholds
+// are compared against the sum directly.
+//
+// Peak picking follows the paper: every local maximum of the
+// integrated signal is either a beat (above THRESHOLD1, and outside
+// the 200ms refractory period) or noise, and updates the matching
+// running peak level. If no beat turns up for 166% of the average RR
+// interval, the biggest noise peak since the last beat is taken as a
+// missed beat if it clears the lower THRESHOLD2 ("searchback").
+
+#include "heartbeat.h"
+
+constexpr uint8_t  DECIMATION = ECG_SAMPLE_HZ / HEARTBEAT_DETECT_HZ;
+static_assert(ECG_SAMPLE_HZ % HEARTBEAT_DETECT_HZ == 0, "ECG rate must be a multiple of the detector rate");
+
+constexpr uint32_t MWI_LEN     = HEARTBEAT_DETECT_HZ * 150 / 1000;   // 150ms integrator
+constexpr uint32_t REFRACTORY  = HEARTBEAT_DETECT_HZ * 200 / 1000;   // No two beats closer
+constexpr uint32_t LEARN_START = 64;                                 // Let the filters settle first
+constexpr uint32_t LEARN_END   = HEARTBEAT_DETECT_HZ * 2;            // 2s learning phase
+constexpr uint32_t RR_MIN      = HEARTBEAT_DETECT_HZ * 60 / 240;     // 240bpm
+constexpr uint32_t RR_MAX      = HEARTBEAT_DETECT_HZ * 60 / 30;      // 30bpm
+constexpr uint32_t LOCK_TIMEOUT = HEARTBEAT_DETECT_HZ * 2;
+constexpr uint8_t  LOCK_BEATS   = 8;
+constexpr uint8_t  RR_HISTORY   = 8;
+
+// Keeps d² × MWI_LEN inside a uint32_t
+constexpr int32_t  DERIV_LIMIT = 8191;
+static_assert((uint64_t)DERIV_LIMIT * DERIV_LIMIT * MWI_LEN < 0xFFFFFFFFull, "Integrator can overflow");
+static_assert(MWI_LEN < 64, "Integrator history is 64 samples");
+
+// ── Filter state ─────────────────────────────────────────────────────
+static int32_t  lpX[16];
+static int32_t  lpY1, lpY2;
+static int32_t  hpX[64];
+static int32_t  hpSum;
+static int32_t  dX[8];
+static uint32_t mwiX[64];
+static uint32_t mwiSum;
+
+static uint32_t n;                  // Samples at the detector rate
+static uint32_t pairSum;
+static uint8_t  pairCount;
+
+// ── Peak picking state ───────────────────────────────────────────────
+static uint32_t lastMwi;
+static bool     rising;
+static uint32_t learnMax;
+static uint32_t spki, npki;         // Running signal / noise peak levels
+static uint32_t threshold1;
+
+static bool     haveBeat;
+static uint32_t lastBeat;           // Sample number of the last beat
+static uint32_t searchPeak;         // Biggest noise peak since then
+static uint32_t searchIdx;
+
+static uint16_t rrBuf[RR_HISTORY];
+static uint8_t  rrPos, rrFill;
+static uint32_t rrSum;
+static uint8_t  regularRun;
+
+// ── Published ────────────────────────────────────────────────────────
+static volatile uint32_t beatCount = 0;
+static volatile uint16_t bpm = 0;
+static volatile bool     regular = false;
+
+static void update_thresholds()
+{
+    threshold1 = npki + (spki > npki ? (spki - npki) / 4 : 0);
+}
+
+// level + (peak - level) / 2^shift, without going negative
+static inline uint32_t toward(uint32_t level, uint32_t peak, uint8_t shift)
+{
+    return level - (level >> shift) + (peak >> shift);
+}
+
+static void accept_beat(uint32_t peak, uint32_t idx, bool searchback)
+{
+    // A searchback beat cleared only the lower threshold, so it moves
+    // the signal level faster (the paper's 0.25)
+    spki = toward(spki, peak, searchback ? 2 : 3);
+    update_thresholds();
+
+    if (haveBeat) {
+        uint32_t rr = idx - lastBeat;
+        if (rr >= RR_MIN && rr <= RR_MAX) {
+            bool steady = true;
+            if (rrFill > 0) {
+                uint32_t avg = rrSum / rrFill;
+                steady = rr * 10 >= avg * 8 && rr * 10 <= avg * 12;   // Within 20%
+            }
+            regularRun = steady ? (uint8_t)(regularRun < 255 ? regularRun + 1 : 255) : 0;
+
+            if (rrFill == RR_HISTORY) rrSum -= rrBuf[rrPos];
+            else                      rrFill++;
+            rrBuf[rrPos] = (uint16_t)rr;
+            rrSum += rr;
+            rrPos = (rrPos + 1) % RR_HISTORY;
+
+            bpm = (uint16_t)((60UL * HEARTBEAT_DETECT_HZ * rrFill + rrSum / 2) / rrSum);
+        } else {
+            regularRun = 0;
+        }
+    }
+
+    haveBeat = true;
+    lastBeat = idx;
+    searchPeak = 0;
+    beatCount = beatCount + 1;
+    regular = regularRun >= LOCK_BEATS;
+}
+
+static void on_peak(uint32_t peak, uint32_t idx)
+{
+    if (haveBeat && idx - lastBeat < REFRACTORY) return;   // T wave, or the same QRS
+
+    if (peak > threshold1) {
+        accept_beat(peak, idx, false);
+        return;
+    }
+
+    npki = toward(npki, peak, 3);
+    update_thresholds();
+    if (peak > searchPeak) {
+        searchPeak = peak;
+        searchIdx = idx;
+    }
+}
+
+static void detect(int32_t x)
+{
+    uint32_t i = n++;
+
+    // ── Band-pass ─────────────────────────────────────────────────────
+    lpX[i & 15] = x;
+    int32_t lp = 2 * lpY1 - lpY2 + x - 2 * lpX[(i - 6) & 15] + lpX[(i - 12) & 15];
+    lpY2 = lpY1;
+    lpY1 = lp;
+    lp >>= 5;
+
+    hpSum += lp - hpX[(i - 32) & 63];
+    hpX[i & 63] = lp;
+    int32_t hp = hpX[(i - 16) & 63] - (hpSum >> 5);
+
+    // ── Derivative, square, integrate ────────────────────────────────
+    dX[i & 7] = hp;
+    int32_t d = (2 * hp + dX[(i - 1) & 7] - dX[(i - 3) & 7] - 2 * dX[(i - 4) & 7]) >> 3;
+    d = constrain(d, -DERIV_LIMIT, DERIV_LIMIT);
+    uint32_t sq = (uint32_t)(d * d);
+
+    mwiSum += sq - mwiX[(i - MWI_LEN) & 63];
+    mwiX[i & 63] = sq;
+    uint32_t mwi = mwiSum;
+
+    // ── Learning phase: seed the levels from the first 2s ────────────
+    if (i < LEARN_END) {
+        if (i >= LEARN_START && mwi > learnMax) learnMax = mwi;
+        if (i == LEARN_END - 1) {
+            spki = learnMax / 2;
+            npki = learnMax / 8;
+            update_thresholds();
+        }
+        lastMwi = mwi;
+        return;
+    }
+
+    // ── Peak picking ─────────────────────────────────────────────────
+    if (mwi > lastMwi) {
+        rising = true;
+    } else if (rising && mwi < lastMwi) {
+        rising = false;
+        on_peak(lastMwi, i - 1);
+    }
+    lastMwi = mwi;
+
+    // ── Searchback for a missed beat ─────────────────────────────────
+    if (haveBeat && rrFill > 0 && searchPeak > 0) {
+        uint32_t avg = rrSum / rrFill;
+        if (i - lastBeat > avg * 166 / 100 && searchPeak > threshold1 / 2) {
+            accept_beat(searchPeak, searchIdx, true);
+        }
+    }
+
+    // The signal's gone (lead off, or no sensor at all)
+    if (haveBeat && i - lastBeat > LOCK_TIMEOUT) {
+        regularRun = 0;
+        regular = false;
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// Public interface
+// ═══════════════════════════════════════════════════════════════════════
+
+void heartbeat_reset()
+{
+    memset(lpX, 0, sizeof(lpX));
+    memset(hpX, 0, sizeof(hpX));
+    memset(dX, 0, sizeof(dX));
+    memset(mwiX, 0, sizeof(mwiX));
+    lpY1 = lpY2 = hpSum = 0;
+    mwiSum = 0;
+    n = 0;
+    pairSum = 0;
+    pairCount = 0;
+
+    lastMwi = 0;
+    rising = false;
+    learnMax = 0;
+    spki = npki = threshold1 = 0;
+    haveBeat = false;
+    searchPeak = 0;
+    rrPos = rrFill = 0;
+    rrSum = 0;
+    regularRun = 0;
+
+    bpm = 0;
+    regular = false;
+}
+
+void heartbeat_feed(uint16_t sample)
+{
+    pairSum += sample;
+    if (++pairCount < DECIMATION) return;
+
+    int32_t x = (int32_t)(pairSum / DECIMATION);
+    pairSum = 0;
+    pairCount = 0;
+    detect(x);
+}
+
+uint32_t heartbeat_count()
+{
+    return beatCount;
+}
+
+bool heartbeat_poll(uint32_t& cursor)
+{
+    uint32_t c = beatCount;
+    bool beat = c != cursor;
+    cursor = c;
+    return beat;
+}
+
+uint16_t heartbeat_bpm()
+{
+    return bpm;
+}
+
+bool heartbeat_locked()
+{
+    return regular;
+}
@@ -0,0 +1,412 @@
+// i2c_bus.cpp — Interrupt-driven, queued I2C transactions on LPI2C1
+//
+// ═══════════════════════════════════════════════════════════════════════
+// HOW THE LPI2C CONTROLLER IS DRIVEN
+// ═══════════════════════════════════════════════════════════════════════
+//
+// The i.MX RT1062's LPI2C doesn't take "bytes", it takes COMMAND WORDS
+// through a 4-deep transmit FIFO (MTDR). Each word is a command in
+// bits 10:8 plus a data byte:
+//
+//   START  | addr<<1      generate (repeated) start + send address
+//   TX     | byte         send one data byte
+//   RECV   | n-1          clock in n bytes (they arrive in MRDR)
+//   STOP                  generate stop
+//
+// So a "write 3 bytes, then read 2" transaction is just this stream:
+//
+//   START|W  TX  TX  TX  START|R  RECV(1)  STOP
+//
+// and the controller does all the bit timing itself. The interrupt
+// only has to keep the FIFO topped up (TDF = "transmit FIFO has
+// room"), empty the receive FIFO (RDF), and notice the end (SDF =
+// "stop detected") or a problem (NDF = NACK, ALF/FEF/PLTF = errors).
+//
+// In Python terms the interrupt handler is:
+//
+//   def on_irq():
+//       if error: abort(); recover_bus(); finish(ERR)
+//       while fifo.has_room() and words: fifo.push(words.pop(0))
+//       while rx_fifo: rx.append(rx_fifo.pop())
+//       if stop_seen: finish(OK); start(next_highest_priority())
+//
+// Wire.begin()/setClock() have already set the pins, clock source and
+// bus timing registers, so all we change is the FIFO watermarks and
+// the interrupt enables.
+//
+// ═══════════════════════════════════════════════════════════════════════
+// RECOVERING FROM A BUS ERROR
+// ═══════════════════════════════════════════════════════════════════════
+//
+// A NACK leaves the controller in charge of a healthy bus, so a STOP
+// ends it. The other errors don't: after lost arbitration, a FIFO
+// error or a pin-low timeout the controller's state machine and FIFOs
+// are mid-transaction, and a slave that was cut off part-way through
+// sending a byte may still be holding SDA low, waiting for the clocks
+// to finish it. Left like that, every later transaction fails too.
+//
+// So before the next slot starts, the controller is disabled and its
+// FIFOs flushed, and if SDA is low the pins are borrowed as GPIO and
+// SCL is pulsed up to 9 times (a whole byte plus ACK) until the slave
+// lets go, followed by a STOP (SDA rising while SCL is high) so every
+// device sees the bus as free. That's the recovery in the I2C spec,
+// section 3.1.16. It costs ~100us of interrupt time, only on an error.
+
+#include "i2c_bus.h"
+
+// ── LPI2C register bits (i.MX RT1060 reference manual, ch. 47) ────────
+// Status (MSR) and interrupt-enable (MIER) share bit positions.
+constexpr uint32_t MSR_TDF  = 1u << 0;    // Transmit FIFO below watermark
+constexpr uint32_t MSR_RDF  = 1u << 1;    // Receive FIFO above watermark
+constexpr uint32_t MSR_SDF  = 1u << 9;    // STOP detected
+constexpr uint32_t MSR_NDF  = 1u << 10;   // NACK detected
+constexpr uint32_t MSR_ALF  = 1u << 11;   // Arbitration lost
+constexpr uint32_t MSR_FEF  = 1u << 12;   // FIFO error (command misuse)
+constexpr uint32_t MSR_PLTF = 1u << 13;   // Pin low timeout
+constexpr uint32_t MSR_ERRORS = MSR_NDF | MSR_ALF | MSR_FEF | MSR_PLTF;
+constexpr uint32_t MSR_W1C    = MSR_SDF | MSR_ERRORS | (1u << 8) | (1u << 14);
+
+constexpr uint32_t MCR_MEN = 1u << 0;     // Master enable
+constexpr uint32_t MCR_RTF = 1u << 8;     // Reset transmit FIFO
+constexpr uint32_t MCR_RRF = 1u << 9;     // Reset receive FIFO
+
+constexpr uint32_t CMD_TX    = 0u << 8;
+constexpr uint32_t CMD_RECV  = 1u << 8;
+constexpr uint32_t CMD_STOP  = 2u << 8;
+constexpr uint32_t CMD_START = 4u << 8;
+
+constexpr uint8_t  FIFO_DEPTH = 4;
+
+// Wire's pins on LPI2C1, and a quarter of a 100kHz clock period
+constexpr uint8_t  SDA_PIN = 18;          // GPIO_AD_B1_01
+constexpr uint8_t  SCL_PIN = 19;          // GPIO_AD_B1_00
+constexpr uint8_t  RECOVERY_HALF_US = 5;
+constexpr uint8_t  RECOVERY_CLOCKS  = 9;
+
+static inline uint8_t tx_fifo_count() { return LPI2C1_MFSR & 0x07; }
+static inline uint8_t rx_fifo_count() { return (LPI2C1_MFSR >> 16) & 0x07; }
+
+// ── Queue ─────────────────────────────────────────────────────────────
+
+struct I2cTxn {
+    bool        used;
+    uint8_t     addr;
+    uint8_t     txLen;
+    uint8_t     tx[I2C_MAX_WRITE];
+    uint8_t*    rx;
+    uint16_t    rxLen;
+    I2cPriority priority;
+    I2cDoneFn   done;
+    void*       ctx;
+    uint32_t    seq;          // Submission order, for FIFO within priority
+    int16_t     ticket;
+};
+
+// Where the active transaction's command stream has got to
+enum TxnStep : uint8_t {
+    STEP_START_WRITE,
+    STEP_DATA,
+    STEP_START_READ,
+    STEP_RECV,
+    STEP_STOP,
+    STEP_DONE                 // All words queued — waiting for STOP
+};
+
+static I2cTxn   queue[I2C_QUEUE_LEN];
+static int8_t   active = -1;  // Index of the transaction on the wire
+static TxnStep  step;
+static uint8_t  txPos;
+static uint16_t rxPos;
+static I2cStatus activeStatus;
+
+static uint32_t nextSeq = 0;
+static int16_t  nextTicket = 0;
+static bool     busReady = false;
+
+static volatile uint32_t completedCount = 0;
+static volatile uint32_t failureCount = 0;
+
+// ═══════════════════════════════════════════════════════════════════════
+// Interrupt-side helpers (also called from i2c_submit with IRQs off)
+// ═══════════════════════════════════════════════════════════════════════
+
+// Next command word for the active transaction, or false when there
+// are none left.
+static bool next_word(uint32_t& word)
+{
+    const I2cTxn& t = queue[active];
+
+    switch (step) {
+        case STEP_START_WRITE:
+            word = CMD_START | ((uint32_t)t.addr << 1);
+            step = STEP_DATA;
+            return true;
+
+        case STEP_DATA:
+            word = CMD_TX | t.tx[txPos++];
+            if (txPos >= t.txLen) step = t.rxLen > 0 ? STEP_START_READ : STEP_STOP;
+            return true;
+
+        case STEP_START_READ:
+            word = CMD_START | ((uint32_t)t.addr << 1) | 1;
+            step = STEP_RECV;
+            return true;
+
+        case STEP_RECV:
+            word = CMD_RECV | (uint32_t)(t.rxLen - 1);
+            step = STEP_STOP;
+            return true;
+
+        case STEP_STOP:
+            word = CMD_STOP;
+            step = STEP_DONE;
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+static void fill_tx_fifo()
+{
+    uint32_t word;
+    while (tx_fifo_count() < FIFO_DEPTH && next_word(word)) {
+        LPI2C1_MTDR = word;
+    }
+    // With nothing left to queue, TDF would fire forever — stop
+    // listening for it and wait for the STOP instead
+    if (step == STEP_DONE) LPI2C1_MIER &= ~MSR_TDF;
+}
+
+static void drain_rx_fifo()
+{
+    I2cTxn& t = queue[active];
+    while (rx_fifo_count() > 0) {
+        uint8_t b = (uint8_t)LPI2C1_MRDR;
+        if (rxPos < t.rxLen) t.rx[rxPos++] = b;
+    }
+}
+
+static void start_next()
+{
+    active = -1;
+    for (uint8_t i = 0; i < I2C_QUEUE_LEN; i++) {
+        if (!queue[i].used) continue;
+        if (active < 0 ||
+            queue[i].priority > queue[active].priority ||
+            (queue[i].priority == queue[active].priority &&
+             (int32_t)(queue[i].seq - queue[active].seq) < 0)) {
+            active = (int8_t)i;
+        }
+    }
+    if (active < 0) {
+        LPI2C1_MIER = 0;       // Bus idle
+        return;
+    }
+
+    // Pure reads skip the write phase and start with the read address
+    step = queue[active].txLen > 0 ? STEP_START_WRITE : STEP_START_READ;
+    txPos = 0;
+    rxPos = 0;
+    activeStatus = I2C_OK;
+
+    LPI2C1_MSR = MSR_W1C;      // Clear stale flags from the last one
+    LPI2C1_MIER = MSR_TDF | MSR_RDF | MSR_SDF | MSR_ERRORS;
+    fill_tx_fifo();
+}
+
+static void finish_active()
+{
+    I2cTxn& t = queue[active];
+    if (activeStatus == I2C_OK) completedCount++;
+    else                        failureCount++;
+
+    if (t.done) t.done(activeStatus, t.ctx);
+    t.used = false;
+    start_next();
+}
+
+// Put the controller and the bus back in a state the next transaction
+// can start from (see RECOVERING FROM A BUS ERROR above).
+static void recover_bus()
+{
+    LPI2C1_MCR &= ~MCR_MEN;
+    LPI2C1_MCR |= MCR_RTF | MCR_RRF;
+
+    // Borrow the pins as GPIO, keeping Wire's mux and pad settings to
+    // put back afterwards
+    uint32_t sdaMux = IOMUXC_SW_MUX_CTL_PAD_GPIO_AD_B1_01;
+    uint32_t sclMux = IOMUXC_SW_MUX_CTL_PAD_GPIO_AD_B1_00;
+    uint32_t sdaPad = IOMUXC_SW_PAD_CTL_PAD_GPIO_AD_B1_01;
+    uint32_t sclPad = IOMUXC_SW_PAD_CTL_PAD_GPIO_AD_B1_00;
+
+    pinMode(SDA_PIN, INPUT_PULLUP);
+    if (!digitalReadFast(SDA_PIN)) {
+        digitalWriteFast(SCL_PIN, HIGH);
+        pinMode(SCL_PIN, OUTPUT_OPENDRAIN);
+
+        for (uint8_t i = 0; i < RECOVERY_CLOCKS && !digitalReadFast(SDA_PIN); i++) {
+            digitalWriteFast(SCL_PIN, LOW);
+            delayMicroseconds(RECOVERY_HALF_US);
+            digitalWriteFast(SCL_PIN, HIGH);
+            delayMicroseconds(RECOVERY_HALF_US);
+        }
+
+        // STOP: SDA low, then high, with SCL high throughout
+        digitalWriteFast(SDA_PIN, LOW);
+        pinMode(SDA_PIN, OUTPUT_OPENDRAIN);
+        delayMicroseconds(RECOVERY_HALF_US);
+        digitalWriteFast(SDA_PIN, HIGH);
+        delayMicroseconds(RECOVERY_HALF_US);
+    }
+
+    IOMUXC_SW_PAD_CTL_PAD_GPIO_AD_B1_01 = sdaPad;
+    IOMUXC_SW_PAD_CTL_PAD_GPIO_AD_B1_00 = sclPad;
+    IOMUXC_SW_MUX_CTL_PAD_GPIO_AD_B1_01 = sdaMux;
+    IOMUXC_SW_MUX_CTL_PAD_GPIO_AD_B1_00 = sclMux;
+
+    LPI2C1_MSR = MSR_W1C;
+    LPI2C1_MCR |= MCR_MEN;
+}
+
+static void i2c_isr()
+{
+    uint32_t msr = LPI2C1_MSR;
+
+    if (active < 0) {
+        LPI2C1_MSR = msr & MSR_W1C;
+        LPI2C1_MIER = 0;
+        return;
+    }
+
+    // ── Problems ──────────────────────────────────────────────────────
+    if (msr & MSR_ERRORS) {
+        LPI2C1_MCR |= MCR_RTF | MCR_RRF;       // Drop the rest of it
+        LPI2C1_MSR = msr & MSR_ERRORS;
+
+        if (msr & MSR_NDF) {
+            // The address or a byte was NACKed. We still own the bus,
+            // so release it properly and finish when the STOP lands.
+            activeStatus = I2C_NACK;
+            step = STEP_DONE;
+            LPI2C1_MIER &= ~(MSR_TDF | MSR_RDF);
+            LPI2C1_MTDR = CMD_STOP;
+            return;
+        }
+
+        // Lost arbitration, FIFO error or a stuck pin — the next
+        // transaction would fail the same way without a reset
+        activeStatus = I2C_ERROR;
+        recover_bus();
+        finish_active();
+        return;
+    }
+
+    if (msr & MSR_RDF) drain_rx_fifo();
+    if (msr & MSR_TDF) fill_tx_fifo();
+
+    if (msr & MSR_SDF) {
+        LPI2C1_MSR = MSR_SDF;
+        drain_rx_fifo();
+        finish_active();
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// Public API
+// ═══════════════════════════════════════════════════════════════════════
+
+void i2c_bus_begin()
+{
+    LPI2C1_MIER = 0;
+    LPI2C1_MCR |= MCR_RTF | MCR_RRF;
+    LPI2C1_MSR = MSR_W1C;
+
+    // TDF when 1 or fewer words are left in the TX FIFO; RDF as soon
+    // as anything arrives (watermark 0)
+    LPI2C1_MFCR = (0u << 16) | 1u;
+
+    attachInterruptVector(IRQ_LPI2C1, i2c_isr);
+    NVIC_SET_PRIORITY(IRQ_LPI2C1, 144);    // Below the ADC and DMA
+    NVIC_ENABLE_IRQ(IRQ_LPI2C1);
+
+    busReady = true;
+}
+
+int16_t i2c_submit(uint8_t addr, const uint8_t* tx, uint8_t txLen,
+                   uint8_t* rx, uint16_t rxLen, I2cPriority priority,
+                   I2cDoneFn done, void* ctx)
+{
+    if (!busReady) return -1;
+    if (txLen > I2C_MAX_WRITE || rxLen > I2C_MAX_READ) return -1;
+    if (txLen == 0 && rxLen == 0) return -1;
+    if (rxLen > 0 && rx == nullptr) return -1;
+
+    int16_t ticket = -1;
+
+    __disable_irq();
+
+    // Displays may not take the slots kept back for sensors
+    uint8_t reserve = priority >= I2C_PRIO_SENSOR ? 0 : I2C_SENSOR_RESERVED;
+    if (i2c_free_slots() <= reserve) {
+        __enable_irq();
+        return -1;
+    }
+
+    for (uint8_t i = 0; i < I2C_QUEUE_LEN; i++) {
+        I2cTxn& t = queue[i];
+        if (t.used) continue;
+
+        t.addr = addr;
+        t.txLen = txLen;
+        if (txLen) memcpy(t.tx, tx, txLen);
+        t.rx = rx;
+        t.rxLen = rxLen;
+        t.priority = priority;
+        t.done = done;
+        t.ctx = ctx;
+        t.seq = nextSeq++;
+        t.ticket = ticket = nextTicket;
+        nextTicket = (nextTicket + 1) & 0x7FFF;
+        t.used = true;
+
+        if (active < 0) start_next();     // Bus was idle — kick it
+        break;
+    }
+    __enable_irq();
+
+    return ticket;
+}
+
+bool i2c_bus_active()
+{
+    return busReady;
+}
+
+bool i2c_busy(int16_t ticket)
+{
+    if (ticket < 0) return false;
+    for (uint8_t i = 0; i < I2C_QUEUE_LEN; i++) {
+        if (queue[i].used && queue[i].ticket == ticket) return true;
+    }
+    return false;
+}
+
+uint8_t i2c_free_slots()
+{
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < I2C_QUEUE_LEN; i++) {
+        if (!queue[i].used) n++;
+    }
+    return n;
+}
+
+uint32_t i2c_completed()
+{
+    return completedCount;
+}
+
+uint32_t i2c_failures()
+{
+    return failureCount;
+}
@@ -0,0 +1,115 @@
+// input_events.cpp — Pin-change interrupts, debouncing and the event queue
+//
+// Every input pin is active low (pressed = connected to GND, with a
+// pull-up holding it HIGH otherwise), so "pressed" is just
+// digitalReadFast(pin) == LOW.
+//
+// Each pin needs its own interrupt function, because attachInterrupt()
+// callbacks take no arguments. pin_isr<N> is a template, so the
+// compiler stamps out one tiny handler per table entry, each of which
+// just calls on_edge(N). In Python terms it's
+//   handlers = [functools.partial(on_edge, i) for i in range(len(PINS))]
+// done at compile time.
+
+#include "input_events.h"
+#include "config.h"
+#include "event_queue.h"
+
+struct InputPin {
+    uint8_t      pin;
+    InputSource  source;
+    NavDirection dir;
+};
+
+static const InputPin INPUT_PINS[] = {
+    { NAV_PIN_UP,     INPUT_NAV,        NAV_UP     },
+    { NAV_PIN_DOWN,   INPUT_NAV,        NAV_DOWN   },
+    { NAV_PIN_LEFT,   INPUT_NAV,        NAV_LEFT   },
+    { NAV_PIN_RIGHT,  INPUT_NAV,        NAV_RIGHT  },
+    { NAV_PIN_CENTER, INPUT_NAV,        NAV_CENTER },
+    { ENC_SW,         INPUT_ENC_BUTTON, NAV_NONE   },
+};
+static constexpr uint8_t INPUT_PIN_COUNT = sizeof(INPUT_PINS) / sizeof(INPUT_PINS[0]);
+
+// ── Per-pin debounce state ─────────────────────────────────────────────
+// Written by that pin's interrupt and by input_service() with
+// interrupts off, so they never race.
+static volatile bool     pinPressed[INPUT_PIN_COUNT];
+static volatile uint32_t lastEdgeUs[INPUT_PIN_COUNT];
+
+// All pin interrupts on the Teensy 4 share one GPIO vector and can't
+// preempt each other, and input_service() pushes with interrupts off —
+// so there is only ever one producer at a time.
+static EventQueue<InputEvent, INPUT_QUEUE_LEN> events;
+
+static void accept(uint8_t idx, bool pressed, uint32_t nowUs)
+{
+    pinPressed[idx] = pressed;
+    lastEdgeUs[idx] = nowUs;
+
+    InputEvent ev;
+    ev.timeMs  = millis();
+    ev.source  = INPUT_PINS[idx].source;
+    ev.dir     = INPUT_PINS[idx].dir;
+    ev.pressed = pressed;
+    events.push(ev);
+}
+
+static void on_edge(uint8_t idx)
+{
+    uint32_t now = micros();
+    if (now - lastEdgeUs[idx] < INPUT_DEBOUNCE_US) return;   // Bounce
+
+    bool pressed = digitalReadFast(INPUT_PINS[idx].pin) == LOW;
+    if (pressed != pinPressed[idx]) accept(idx, pressed, now);
+}
+
+template <uint8_t IDX>
+static void pin_isr()
+{
+    on_edge(IDX);
+}
+
+static_assert(INPUT_PIN_COUNT == 6, "Add a pin_isr<N> to PIN_ISRS for each new pin");
+
+typedef void (*PinIsr)();
+static const PinIsr PIN_ISRS[INPUT_PIN_COUNT] = {
+    pin_isr<0>, pin_isr<1>, pin_isr<2>, pin_isr<3>, pin_isr<4>, pin_isr<5>,
+};
+
+// ── Public interface ───────────────────────────────────────────────────
+
+void input_init()
+{
+    uint32_t now = micros();
+    for (uint8_t i = 0; i < INPUT_PIN_COUNT; i++) {
+        // Start from whatever the pin shows now, so a button held at
+        // boot doesn't produce a phantom press
+        pinPressed[i] = digitalReadFast(INPUT_PINS[i].pin) == LOW;
+        lastEdgeUs[i] = now;
+        attachInterrupt(digitalPinToInterrupt(INPUT_PINS[i].pin), PIN_ISRS[i], CHANGE);
+    }
+}
+
+void input_service()
+{
+    for (uint8_t i = 0; i < INPUT_PIN_COUNT; i++) {
+        __disable_irq();
+        uint32_t now = micros();
+        if (now - lastEdgeUs[i] >= INPUT_DEBOUNCE_US) {
+            bool pressed = digitalReadFast(INPUT_PINS[i].pin) == LOW;
+            if (pressed != pinPressed[i]) accept(i, pressed, now);
+        }
+        __enable_irq();
+    }
+}
+
+bool input_next_event(InputEvent& ev)
+{
+    return events.pop(ev);
+}
+
+uint32_t input_dropped()
+{
+    return events.dropped();
+}
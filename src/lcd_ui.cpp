@@ -0,0 +1,347 @@
+// lcd_ui.cpp — Retained-mode widgets with dirty-rectangle updates
+//
+// ═══════════════════════════════════════════════════════════════════════
+// ONE lcd_ui_tick()
+// ═══════════════════════════════════════════════════════════════════════
+//
+//   LCD busy? ──→ return (a rectangle is still going out)
+//       │
+//       ├── commit: for each widget with a pending change,
+//       │           diff pending vs visible → add_dirty(changed part)
+//       │           visible = pending
+//       │
+//       └── pop one dirty rectangle → lcd_stream_rect_async(ui_render_strip)
+//
+// The render callback composes the rectangle from scratch, line by line:
+// screen background first, then every widget that overlaps, in the
+// order they were added. So overlapping or merged rectangles are always
+// drawn correctly, whatever was on screen before.
+//
+// ═══════════════════════════════════════════════════════════════════════
+// MERGING
+// ═══════════════════════════════════════════════════════════════════════
+//
+// Every rectangle costs a window-setup (11 command bytes with CS
+// toggling) and a DMA start, so a dozen tiny rectangles side by side
+// are slower than one slightly bigger one. A new dirty rectangle is
+// merged into an existing one when their bounding box wastes less than
+// MERGE_SLACK_PX pixels over the two areas — like coalescing adjacent
+// writes in a disk cache. If the queue is full, it's merged into
+// whichever rectangle grows the least.
+
+#include "lcd_ui.h"
+#include "colour_lcd.h"
+#include "font_5x7.h"
+
+// Pixels of "wasted" redraw accepted to save one rectangle
+constexpr uint32_t MERGE_SLACK_PX = 256;
+
+// ── Types ──────────────────────────────────────────────────────────────
+
+struct UiRect {
+    uint16_t x, y, w, h;
+};
+
+enum WidgetType : uint8_t {
+    WIDGET_LABEL,
+    WIDGET_BAR
+};
+
+struct Widget {
+    WidgetType type;
+    UiRect     rect;
+    uint16_t   fg, bg;             // Pre-swapped (RGB565_BE)
+    bool       changed;            // Pending differs from visible
+
+    // Label: text padded with spaces to maxChars (no terminator needed)
+    uint8_t    scale;
+    uint8_t    maxChars;
+    char       text[LCD_UI_MAX_TEXT];
+    char       pendingText[LCD_UI_MAX_TEXT];
+
+    // Bar: filled width in pixels
+    uint16_t   fillPx;
+    uint16_t   pendingFillPx;
+};
+
+// ── State ──────────────────────────────────────────────────────────────
+// Everything here is read by ui_render_strip() from the DMA interrupt
+// while a rectangle streams. It's only written by lcd_ui_tick() and
+// lcd_ui_reset() while the LCD is idle (setters only touch the
+// pending fields).
+
+static Widget   widgets[LCD_UI_MAX_WIDGETS];
+static uint8_t  widgetCount = 0;
+static uint16_t screenBg = 0;      // Pre-swapped
+
+static UiRect   dirty[LCD_UI_MAX_DIRTY];
+static uint8_t  dirtyCount = 0;
+
+static UiRect   sending;           // Rectangle currently streaming
+
+// ── Rectangle helpers ──────────────────────────────────────────────────
+
+static inline uint32_t rect_area(const UiRect& r)
+{
+    return (uint32_t)r.w * r.h;
+}
+
+static UiRect rect_union(const UiRect& a, const UiRect& b)
+{
+    uint16_t x0 = a.x < b.x ? a.x : b.x;
+    uint16_t y0 = a.y < b.y ? a.y : b.y;
+    uint16_t x1 = (a.x + a.w) > (b.x + b.w) ? (a.x + a.w) : (b.x + b.w);
+    uint16_t y1 = (a.y + a.h) > (b.y + b.h) ? (a.y + a.h) : (b.y + b.h);
+    return { x0, y0, (uint16_t)(x1 - x0), (uint16_t)(y1 - y0) };
+}
+
+static void add_dirty(UiRect r)
+{
+    if (r.w == 0 || r.h == 0) return;
+
+    // Keep merging until nothing else is close enough — absorbing one
+    // rectangle can make the result close to another.
+    bool merged = true;
+    while (merged) {
+        merged = false;
+        for (uint8_t i = 0; i < dirtyCount; i++) {
+            UiRect u = rect_union(dirty[i], r);
+            if (rect_area(u) <= rect_area(dirty[i]) + rect_area(r) + MERGE_SLACK_PX) {
+                r = u;
+                dirty[i] = dirty[--dirtyCount];    // Remove, re-add merged
+                merged = true;
+                break;
+            }
+        }
+    }
+
+    if (dirtyCount < LCD_UI_MAX_DIRTY) {
+        dirty[dirtyCount++] = r;
+        return;
+    }
+
+    // Queue full — fold into whichever rectangle grows the least
+    uint8_t best = 0;
+    uint32_t bestGrowth = UINT32_MAX;
+    for (uint8_t i = 0; i < dirtyCount; i++) {
+        uint32_t growth = rect_area(rect_union(dirty[i], r)) - rect_area(dirty[i]);
+        if (growth < bestGrowth) {
+            bestGrowth = growth;
+            best = i;
+        }
+    }
+    dirty[best] = rect_union(dirty[best], r);
+}
+
+// ── Rendering (DMA interrupt context) ──────────────────────────────────
+
+static void label_render_row(const Widget& w, uint16_t* out, uint16_t sy,
+                             uint16_t xs, uint16_t xe)
+{
+    // Which of the 8 font rows this screen line falls in (row 7 is the
+    // gap between lines, so always background)
+    uint8_t fontRow = (sy - w.rect.y) / w.scale;
+
+    // Walk across the span with counters rather than a divide per pixel
+    uint16_t lx = xs - w.rect.x;
+    uint8_t sub = lx % w.scale;
+    uint16_t cx = lx / w.scale;
+    uint8_t charIdx = cx / FONT_TOTAL_CHAR_WIDTH;
+    uint8_t col = cx % FONT_TOTAL_CHAR_WIDTH;
+
+    for (uint16_t x = xs; x < xe; x++) {
+        bool on = fontRow < FONT_CHAR_HEIGHT && col < FONT_CHAR_WIDTH &&
+                  ((font_5x7_column(w.text[charIdx], col) >> fontRow) & 1);
+        *out++ = on ? w.fg : w.bg;
+
+        if (++sub == w.scale) {
+            sub = 0;
+            if (++col == FONT_TOTAL_CHAR_WIDTH) {
+                col = 0;
+                charIdx++;
+            }
+        }
+    }
+}
+
+static void bar_render_row(const Widget& w, uint16_t* out, uint16_t xs, uint16_t xe)
+{
+    uint16_t fillEnd = w.rect.x + w.fillPx;
+    for (uint16_t x = xs; x < xe; x++) {
+        *out++ = x < fillEnd ? w.fg : w.bg;
+    }
+}
+
+static void ui_render_strip(uint16_t* out, uint16_t y0, uint16_t lines)
+{
+    const uint16_t rx0 = sending.x;
+    const uint16_t rx1 = sending.x + sending.w;
+
+    for (uint16_t i = 0; i < lines; i++) {
+        uint16_t sy = sending.y + y0 + i;
+        uint16_t* row = out + (uint32_t)i * sending.w;
+
+        for (uint16_t x = 0; x < sending.w; x++) row[x] = screenBg;
+
+        for (uint8_t n = 0; n < widgetCount; n++) {
+            const Widget& w = widgets[n];
+            if (sy < w.rect.y || sy >= w.rect.y + w.rect.h) continue;
+
+            uint16_t xs = w.rect.x > rx0 ? w.rect.x : rx0;
+            uint16_t xe = (w.rect.x + w.rect.w) < rx1 ? (w.rect.x + w.rect.w) : rx1;
+            if (xs >= xe) continue;
+
+            uint16_t* seg = row + (xs - rx0);
+            if (w.type == WIDGET_LABEL) label_render_row(w, seg, sy, xs, xe);
+            else                        bar_render_row(w, seg, xs, xe);
+        }
+    }
+}
+
+// ── Commit pending changes (main loop, LCD idle) ───────────────────────
+
+static void commit_widget(Widget& w)
+{
+    if (w.type == WIDGET_LABEL) {
+        // Only the characters that actually changed
+        int first = -1, last = -1;
+        for (uint8_t i = 0; i < w.maxChars; i++) {
+            if (w.text[i] != w.pendingText[i]) {
+                if (first < 0) first = i;
+                last = i;
+            }
+            w.text[i] = w.pendingText[i];
+        }
+        if (first >= 0) {
+            uint16_t cellW = FONT_TOTAL_CHAR_WIDTH * w.scale;
+            add_dirty({ (uint16_t)(w.rect.x + first * cellW), w.rect.y,
+                        (uint16_t)((last - first + 1) * cellW), w.rect.h });
+        }
+    } else {
+        // Only the columns between the old and new fill level
+        uint16_t lo = w.fillPx < w.pendingFillPx ? w.fillPx : w.pendingFillPx;
+        uint16_t hi = w.fillPx < w.pendingFillPx ? w.pendingFillPx : w.fillPx;
+        w.fillPx = w.pendingFillPx;
+        add_dirty({ (uint16_t)(w.rect.x + lo), w.rect.y, (uint16_t)(hi - lo), w.rect.h });
+    }
+    w.changed = false;
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// Public API
+// ═══════════════════════════════════════════════════════════════════════
+
+void lcd_ui_reset(uint16_t background)
+{
+    // Widgets are read by the DMA interrupt — wait out a rectangle of
+    // ours that's still streaming. Dashboard rectangles are a couple of 
+    // ms at most; only a reset straight after a reset waits for a whole 
+    // screen. Someone else's transfer (the fire, a clear) doesn't read 
+    // them, so doesn't need waiting for.
+    while (lcd_streaming(ui_render_strip)) {}
+
+    widgetCount = 0;
+    dirtyCount = 0;
+    screenBg = __builtin_bswap16(background);
+    add_dirty({ 0, 0, LCD_WIDTH, LCD_HEIGHT });
+}
+
+static Widget* widget_alloc(UiRect r, uint16_t fg, uint16_t bg)
+{
+    if (widgetCount >= LCD_UI_MAX_WIDGETS) return nullptr;
+    if (r.w == 0 || r.h == 0) return nullptr;
+    if (r.x + r.w > LCD_WIDTH || r.y + r.h > LCD_HEIGHT) return nullptr;
+
+    Widget& w = widgets[widgetCount];
+    w = {};
+    w.rect = r;
+    w.fg = __builtin_bswap16(fg);
+    w.bg = __builtin_bswap16(bg);
+    add_dirty(r);                  // First draw
+    return &w;
+}
+
+int8_t lcd_ui_add_label(uint16_t x, uint16_t y, uint8_t maxChars, uint8_t scale,
+                        uint16_t fg, uint16_t bg)
+{
+    if (scale == 0 || maxChars == 0) return -1;
+    if (maxChars > LCD_UI_MAX_TEXT) maxChars = LCD_UI_MAX_TEXT;
+
+    UiRect r = { x, y, (uint16_t)(maxChars * FONT_TOTAL_CHAR_WIDTH * scale),
+                 (uint16_t)((FONT_CHAR_HEIGHT + 1) * scale) };
+    Widget* w = widget_alloc(r, fg, bg);
+    if (w == nullptr) return -1;
+
+    w->type = WIDGET_LABEL;
+    w->scale = scale;
+    w->maxChars = maxChars;
+    memset(w->text, ' ', sizeof(w->text));
+    memset(w->pendingText, ' ', sizeof(w->pendingText));
+    return (int8_t)widgetCount++;
+}
+
+int8_t lcd_ui_add_bar(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+                      uint16_t fg, uint16_t bg)
+{
+    Widget* w = widget_alloc({ x, y, width, height }, fg, bg);
+    if (w == nullptr) return -1;
+
+    w->type = WIDGET_BAR;
+    return (int8_t)widgetCount++;
+}
+
+void lcd_ui_set_text(int8_t id, const char* text)
+{
+    if (id < 0 || id >= widgetCount || widgets[id].type != WIDGET_LABEL) return;
+    Widget& w = widgets[id];
+
+    for (uint8_t i = 0; i < w.maxChars; i++) {
+        char c = (text != nullptr && *text) ? *text++ : ' ';
+        if (w.pendingText[i] != c) {
+            w.pendingText[i] = c;
+            w.changed = true;
+        }
+    }
+}
+
+void lcd_ui_set_value(int8_t id, int32_t value, int32_t maxValue)
+{
+    if (id < 0 || id >= widgetCount || widgets[id].type != WIDGET_BAR) return;
+    Widget& w = widgets[id];
+
+    if (maxValue <= 0) maxValue = 1;
+    if (value < 0) value = 0;
+    if (value > maxValue) value = maxValue;
+
+    uint16_t fill = (uint16_t)(((int64_t)value * w.rect.w) / maxValue);
+    if (fill != w.pendingFillPx) {
+        w.pendingFillPx = fill;
+        w.changed = true;
+    }
+}
+
+void lcd_ui_tick()
+{
+    if (lcd_frame_busy()) return;
+
+    for (uint8_t i = 0; i < widgetCount; i++) {
+        if (widgets[i].changed) commit_widget(widgets[i]);
+    }
+
+    if (dirtyCount == 0) return;
+
+    sending = dirty[--dirtyCount];
+    if (!lcd_stream_rect_async(sending.x, sending.y, sending.w, sending.h,
+                               ui_render_strip)) {
+        dirtyCount++;              // Try again next tick
+    }
+}
+
+bool lcd_ui_pending()
+{
+    if (dirtyCount > 0) return true;
+    for (uint8_t i = 0; i < widgetCount; i++) {
+        if (widgets[i].changed) return true;
+    }
+    return false;
+}
@@ -1,6 +1,7 @@
 // leds.cpp — LED drawing functions implementation
 
 #include "leds.h"
+#include <OctoWS2811.h>
 
 // This is the actual DEFINITION of the array (allocates memory).
 // Other files see the 'extern' declaration in leds.h and know 
@@ -46,4 +47,112 @@ void draw_bars_3(int pos, CRGB C1, CRGB C2, CRGB C3)
             fill_gradient_RGB(leds, 0, C2, barPos, C3);
             break;
     }
-}
\ No newline at end of file
+}
+
+
+// ════════════════════════════════════════════════════════════════════════
+// Output
+// ════════════════════════════════════════════════════════════════════════
+//
+// WS2812 LEDs have no clock line: bits are encoded as pulse widths 
+// (~0.4 vs ~0.8µs high in each 1.25µs slot) and the timing has to be 
+// exact. FastLED.show() meets it by bit-banging with interrupts OFF 
+// for the whole frame — 24 LEDs × 24 bits × 1.25µs ≈ 0.72ms every tick
+// in which the encoder, nav switch and timers can't be serviced.
+//
+// On Teensy 4, OctoWS2811 generates the same waveform with DMA feeding
+// a FlexPWM/XBAR timed GPIO, on any pin. show() copies our drawing 
+// buffer into the DMA buffer, starts the transfer and returns.
+//
+// The colour correction and brightness that FastLED applied inside 
+// show() are applied here while copying, and the frame is only sent 
+// when leds[] differs from what the ring is already showing. In 
+// Python terms:
+//
+//   if leds != last_sent and not octo.busy():
+//       octo.pixels = [scale(c) for c in leds]; octo.show()
+//       last_sent = leds.copy()
+
+// OctoWS2811 wants 3 bytes per LED, expressed as ints. The DMA buffer 
+// goes in DMAMEM (RAM2), which the DMA engine reads without fighting 
+// the CPU's tightly coupled memory.
+constexpr uint8_t LED_OUT_PINS = 1;
+static DMAMEM int ledDmaBuffer[NUM_LEDS * LED_OUT_PINS * 3 / 4];
+static int        ledDrawBuffer[NUM_LEDS * LED_OUT_PINS * 3 / 4];
+static const uint8_t ledPinList[LED_OUT_PINS] = { LED_PIN };
+
+static OctoWS2811 ledOut(NUM_LEDS, ledDmaBuffer, ledDrawBuffer,
+                         WS2811_GRB | WS2811_800kHz, LED_OUT_PINS, ledPinList);
+
+static CRGB lastSent[NUM_LEDS];
+static bool lastSentValid = false;
+
+// Per-channel output scale: correction × brightness, as FastLED's
+// computeAdjustment() works it out.
+static uint8_t brightness = BRIGHTNESS;
+static uint8_t adjustR, adjustG, adjustB;
+
+static uint8_t channel_adjust(uint8_t correction)
+{
+    return (uint8_t)(((uint32_t)(correction + 1) * 256 * brightness) >> 16);
+}
+
+static void update_adjust()
+{
+    adjustR = channel_adjust(LED_CORRECTION_R);
+    adjustG = channel_adjust(LED_CORRECTION_G);
+    adjustB = channel_adjust(LED_CORRECTION_B);
+}
+
+static inline uint8_t scale_channel(uint8_t value, uint8_t adjust)
+{
+    return (uint8_t)(((uint16_t)value * (adjust + 1)) >> 8);
+}
+
+void leds_init()
+{
+    update_adjust();
+
+    ledOut.begin();
+    lastSentValid = false;
+}
+
+bool leds_busy()
+{
+    return ledOut.busy();
+}
+
+void leds_set_brightness(uint8_t value)
+{
+    if (value == brightness) return;
+    brightness = value;
+    update_adjust();
+    lastSentValid = false;      // Same leds[], different output — resend
+}
+
+uint8_t leds_brightness()
+{
+    return brightness;
+}
+
+bool leds_show()
+{
+    if (lastSentValid && memcmp(lastSent, leds, sizeof(lastSent)) == 0) {
+        return false;   // Ring already shows this frame
+    }
+
+    // A transfer still running means the last frame is under 1ms old —
+    // try again next tick rather than wait for it
+    if (ledOut.busy()) return false;
+
+    for (uint8_t i = 0; i < NUM_LEDS; i++) {
+        ledOut.setPixel(i, scale_channel(leds[i].r, adjustR),
+                           scale_channel(leds[i].g, adjustG),
+                           scale_channel(leds[i].b, adjustB));
+    }
+    ledOut.show();
+
+    memcpy(lastSent, leds, sizeof(lastSent));
+    lastSentValid = true;
+    return true;
+}
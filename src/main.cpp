@@ -4,7 +4,9 @@
 // This file handles:
 //   1. Defining global variables (the "real" copies that extern points to)
 //   2. setup() — one-time hardware initialization
-//   3. loop() — the 60Hz main tick that orchestrates everything
+//   3. The scheduler tasks — one 60Hz control task that owns the
+//      state machines, plus a render task per display (scheduler.h)
+//   4. loop() — just runs the scheduler
 //
 // The loop now has TWO layers of state:
 //
@@ -36,7 +38,7 @@
 
 #include <Arduino.h>
 #include <Encoder.h>
-#include <EEPROM.h>
+#include <Wire.h>
 #include "FastLED.h"
 
 #include "config.h"
@@ -44,39 +46,59 @@
 #include "leds.h"
 #include "motor.h"
 #include "pressure.h"
+#include "sensor_channels.h"
+#include "heartbeat.h"
 #include "buttons.h"
 #include "modes.h"
 #include "state.h"
 #include "serial_report.h"
 #include "oleddisplay.h"
 #include "nav_switch.h"
+#include "input_events.h"
+#include "session_recorder.h"
+#include "session_replay.h"
+#include "settings.h"
 #include "HT1632C_Display.h"
 #include "menu.h"
 #include "colour_lcd.h"
 #include "fire_effect.h"
+#include "lcd_ui.h"
+#include "i2c_bus.h"
 #include "matrix_graph.h"
 #include "sim_session.h"
 #include "alphanum_display.h"
+#include "scheduler.h"
+#include "frame_coordinator.h"
+#include "profiler.h"
+#include "power.h"
+#include "memory_diag.h"
 
 // ============================================================
 // File-scope objects
 // ============================================================
-HT1632C_Display ledMatrix;
+// Built on first use rather than at startup: a global object's 
+// constructor always runs, which would keep the matrix's buffers in a 
+// hardware profile without one (Displays in config.h). As a function 
+// static, it goes with the last call to it.
+static HT1632C_Display& matrix()
+{
+    static HT1632C_Display display;
+    return display;
+}
+
+// The settings screen's matrix label. A named array rather than a 
+// literal at the call site so registerScrollText() and scrollText() 
+// are guaranteed the same pointer.
+static const char SETTINGS_MATRIX_TEXT[] = "SETTINGS";
 
-// Convert operational mode constant to a display string for the LED matrix.
-static const char* mode_to_string(uint8_t mode)
+// Pre-render every message the matrix scrolls, so a mode change is a 
+// strip lookup instead of a font pass.
+static void matrix_register_messages()
 {
-    switch (mode) {
-        case MANUAL:        return "MANUAL";
-        case AUTO:          return "AUTO";
-        case OPT_SPEED:     return "SPEED";
-        case OPT_RAMPSPD:   return "RAMP";
-        case OPT_BEEP:      return "BEEP";
-        case OPT_PRES:      return "PRES";
-        case OPT_USER_MODE: return "MODE";
-        case STANDBY:       return "STANDBY";
-        default:            return "STANDBY";
+    for (uint8_t mode = STANDBY; mode <= OPT_USER_MODE; mode++) {
+        matrix().registerScrollText(mode_label(mode));
     }
+    matrix().registerScrollText(SETTINGS_MATRIX_TEXT);
 }
 
 // ── Alphanumeric display helper ────────────────────────────────────────
@@ -90,7 +112,7 @@ static const char* mode_to_string(uint8_t mode)
 //   AUTO:          "d" + pressure delta (what triggers edge detection)
 //   OPT_SPEED:     "S" + current max speed setting (0-255)
 //   OPT_PRES:      "P" + raw pressure reading
-//   OPT_USER_MODE: "U" + current user mode number (1-6)
+//   OPT_USER_MODE: "U" + current user mode number (1-7)
 //   Other:         "----"
 //
 // In Python terms, this is like a dictionary dispatch:
@@ -135,7 +157,7 @@ static void alphanum_update_running(uint8_t mode)
         {
             // Raw pressure — useful when adjusting the trimpot.
             // Divides by 4 to fit in 3 digits (max ~1023).
-            int rawDisplay = analogRead(BUTTPIN) / 4;
+            int rawDisplay = read_pressure_raw() / 4;
             alphanum_show_labeled('P', rawDisplay);
             break;
         }
@@ -150,6 +172,102 @@ static void alphanum_update_running(uint8_t mode)
     }
 }
 
+// ── Colour LCD running dashboard ───────────────────────────────────────
+// Live session numbers on the LCD while APP_RUNNING. Built from lcd_ui 
+// widgets, so each tick only the digits or bar columns that changed 
+// go over SPI — typically a few hundred pixels, not 67,200.
+//
+//   MOTOR            (small grey caption)
+//   42%              (big value)
+//   ████████░░░░░░   motor bar, 0..MOT_MAX
+//   DELTA
+//   117
+//   ██████████░░░░   delta bar, 0..pressureLimit (full = about to cut)
+//   LIMIT 600
+//   MODE  AUTO
+
+static int8_t dashMotorText = -1;
+static int8_t dashMotorBar  = -1;
+static int8_t dashDeltaText = -1;
+static int8_t dashDeltaBar  = -1;
+static int8_t dashLimitText = -1;
+static int8_t dashModeText  = -1;
+
+static void lcd_dashboard_begin()
+{
+    constexpr uint16_t BG      = RGB565(0x00, 0x00, 0x00);
+    constexpr uint16_t CAPTION = RGB565(0x80, 0x80, 0x80);
+    constexpr uint16_t VALUE   = RGB565(0xFF, 0xFF, 0xFF);
+    constexpr uint16_t TRACK   = RGB565(0x20, 0x20, 0x20);
+
+    lcd_ui_reset(BG);
+
+    int8_t caption = lcd_ui_add_label(8, 8, 5, 2, CAPTION, BG);
+    lcd_ui_set_text(caption, "MOTOR");
+    dashMotorText = lcd_ui_add_label(8, 28, 4, 4, VALUE, BG);
+    dashMotorBar  = lcd_ui_add_bar(8, 64, 224, 16, RGB565(0x00, 0xC0, 0x40), TRACK);
+
+    caption = lcd_ui_add_label(8, 96, 5, 2, CAPTION, BG);
+    lcd_ui_set_text(caption, "DELTA");
+    dashDeltaText = lcd_ui_add_label(8, 116, 5, 4, VALUE, BG);
+    dashDeltaBar  = lcd_ui_add_bar(8, 152, 224, 16, RGB565(0xFF, 0x60, 0x00), TRACK);
+
+    caption = lcd_ui_add_label(8, 188, 5, 2, CAPTION, BG);
+    lcd_ui_set_text(caption, "LIMIT");
+    dashLimitText = lcd_ui_add_label(80, 188, 5, 2, VALUE, BG);
+
+    caption = lcd_ui_add_label(8, 216, 4, 2, CAPTION, BG);
+    lcd_ui_set_text(caption, "MODE");
+    dashModeText = lcd_ui_add_label(80, 216, 7, 2, VALUE, BG);
+}
+
+static void lcd_dashboard_update(uint8_t mode)
+{
+    char buf[12];
+    int delta = pressure - averagePressure;
+
+    snprintf(buf, sizeof(buf), "%d%%", (int)(motorSpeed / MOT_MAX * 100));
+    lcd_ui_set_text(dashMotorText, buf);
+    lcd_ui_set_value(dashMotorBar, (int32_t)motorSpeed, MOT_MAX);
+
+    snprintf(buf, sizeof(buf), "%d", delta);
+    lcd_ui_set_text(dashDeltaText, buf);
+    lcd_ui_set_value(dashDeltaBar, delta, pressureLimit);
+
+    snprintf(buf, sizeof(buf), "%d", pressureLimit);
+    lcd_ui_set_text(dashLimitText, buf);
+
+    lcd_ui_set_text(dashModeText, mode_label(mode));
+
+    lcd_ui_tick();
+}
+
+// ── Heart signals ──────────────────────────────────────────────────────
+// What the displays pulse and count with. When an ECG is fitted and 
+// the detector (heartbeat.h) has a steady lock, that's the wearer's 
+// real heart; otherwise the simulation's. Updated once per control 
+// tick, so heartBeat is true for exactly one tick per beat either way 
+// — just like sim_beat.
+static int  heartBpm = 0;
+static bool heartBeat = false;
+
+static void update_heart()
+{
+    static uint32_t beatCursor = 0;
+
+    // Always poll, so a lock arriving mid-demo doesn't flash a 
+    // backlog of old beats
+    bool liveBeat = heartbeat_poll(beatCursor);
+
+    if (heartbeat_locked()) {
+        heartBpm = heartbeat_bpm();
+        heartBeat = liveBeat;
+    } else {
+        heartBpm = sim_bpm;
+        heartBeat = sim_beat;
+    }
+}
+
 // ── Alphanumeric demo mode display helper ──────────────────────
 // Alternates between two "pages" on the 4-digit display:
 //
@@ -157,7 +275,7 @@ static void alphanum_update_running(uint8_t mode)
 //   Page 2 (3 seconds):  "H" + BPM + dot on beat    e.g. "H 72" → "H 72."
 //
 // The dot on the last digit flashes for exactly one tick (1/60th 
-// second) when a simulated heartbeat occurs — a tiny visual pulse, 
+// second) on each heartbeat (heartBeat, above) — a tiny visual pulse, 
 // like the LED on a heart rate monitor.
 //
 // The alternation uses a simple tick counter. At 60Hz and 3 seconds 
@@ -176,7 +294,7 @@ static void alphanum_demo_tick()
     demoDisplayTick++;
 
     // ── Smoothed BPM for display ───────────────────────────────────
-    // The raw sim_bpm jitters by ±1-2 each tick, which makes the 
+    // The raw BPM jitters by ±1-2 each tick, which makes the 
     // number bounce distractingly on a 4-digit display. We smooth 
     // it with an exponential moving average (EMA) — the same idea 
     // as the pressure running average, but much simpler to implement.
@@ -193,7 +311,7 @@ static void alphanum_demo_tick()
     // (which happen over seconds, not milliseconds).
     //
     // The equivalent in Python would be:
-    //   smoothed_bpm = 0.065 * sim_bpm + 0.935 * smoothed_bpm
+    //   smoothed_bpm = 0.065 * bpm + 0.935 * smoothed_bpm
     //
     // Unlike a simple moving average (which needs a buffer of N past 
     // values), an EMA needs just one float. The tradeoff is that older 
@@ -205,16 +323,16 @@ static void alphanum_demo_tick()
     // On first call, seed the EMA with the current value so it 
     // doesn't have to "ramp up" from zero.
     if (demoDisplayTick == 0) {
-        smoothedBpm = (float)sim_bpm;
+        smoothedBpm = (float)heartBpm;
     } else {
-        smoothedBpm = BPM_ALPHA * sim_bpm + (1.0 - BPM_ALPHA) * smoothedBpm;
+        smoothedBpm = BPM_ALPHA * heartBpm + (1.0 - BPM_ALPHA) * smoothedBpm;
     }
 
     // 3 seconds per page at 60Hz = 180 ticks per page.
     constexpr unsigned int TICKS_PER_PAGE = 180;
     unsigned int page = (demoDisplayTick / TICKS_PER_PAGE) % 2;
 
-    if (sim_beat) {
+    if (heartBeat) {
         alphanum_set_dot(0);
     }
 
@@ -227,18 +345,18 @@ static void alphanum_demo_tick()
     {
         // ── Page 2: Heart rate with beat indicator ─────────────────
         // Show "H" + 3-digit BPM, then layer the dot on beat frames.
-        // alphanum_show_labeled writes all 4 digits and flushes.
-        // alphanum_set_dot adds the dot on top and re-flushes.
-        // Two I2C writes per beat frame (~0.4ms total) is negligible.
+        // alphanum_show_labeled writes all 4 digits, alphanum_set_dot
+        // adds the dot on top, and render_alphanum() commits both as 
+        // one frame — which is only sent when it actually changes.
         alphanum_show_labeled('H', (int)(smoothedBpm + 0.5));  // Round to nearest int
     }
     // ── Beat dot persistence ───────────────────────────────────────
-    // sim_beat is only true for one tick, but the dot needs to stay 
+    // heartBeat is only true for one tick, but the dot needs to stay 
     // visible long enough to actually see. We use a countdown: beat 
     // sets it to N, then every tick we re-apply dots until it expires.
     static int beatDotTimer = 0;
 
-    if (sim_beat) {
+    if (heartBeat) {
         beatDotTimer = 4;
     }
 
@@ -258,8 +376,8 @@ static void add_heat() {
 
     static float beatHeat = 0.0f;
 
-    // When the sim pulses a beat, inject heat
-    if (sim_beat) {
+    // On every heartbeat, inject heat
+    if (heartBeat) {
         beatHeat += 6.0f;           // The "bump" — tune this for visual punch
     }
 
@@ -300,7 +418,7 @@ int pressureLimit = 600;
 
 int rampUp = 10;
 int userMode = 6;
-int userModeTotal = 6;
+int userModeTotal = 7;
 int pressureStep = 1;
 
 int cooldown = 120;
@@ -310,93 +428,87 @@ int maxCooldown = 180;
 int minimumcooldown = 1;
 
 // ============================================================
-// Setup
+// App state
 // ============================================================
-void setup()
+// These used to be static locals inside loop(). They're file-scope 
+// now because the control task writes them and the render tasks 
+// read them.
+
+// ── Top-level app state ────────────────────────────────────────────────
+// This is the "which screen" variable. It starts at APP_MENU so 
+// the device boots into the main menu rather than immediately 
+// entering operational mode.
+static AppState appState = APP_MENU;
+static AppState prevAppState = APP_MENU;
+
+// ── Operational state (only matters when appState == APP_RUNNING) ──────
+static uint8_t operationalState = STANDBY;
+
+// ── Nav input ──────────────────────────────────────────────────────────
+// The direction currently held down, kept up to date from the press 
+// and release events (the OLED shows it). Actions don't use this — 
+// they run once per press event, in handle_nav_press().
+static NavDirection navDir = NAV_NONE;
+
+// ── LCD clear requested by a state change ──────────────────────────────
+// The clear is a DMA fill, which can't start while a fire frame is 
+// still streaming out — so the control task just asks, and render_lcd 
+// starts it as soon as the LCD is free.
+static bool lcdClearPending = false;
+
+// ── Boot progress ──────────────────────────────────────────────────────
+// Which displays have finished coming up (see "Staged boot" below).
+enum BootStage : uint8_t {
+    BOOT_LCD,
+    BOOT_MATRIX,
+    BOOT_OLED,
+    BOOT_ALPHANUM,
+    BOOT_I2C_BUS,       // OLED + alphanumeric now driven from the I2C interrupt
+    BOOT_RECORDER,
+    BOOT_STAGE_COUNT
+};
+
+// Stages for displays this profile doesn't have start out done, so 
+// nothing ever waits on them
+constexpr uint8_t BOOT_ABSENT =
+      (Displays::lcd      ? 0 : 1u << BOOT_LCD)
+    | (Displays::matrix   ? 0 : 1u << BOOT_MATRIX)
+    | (Displays::oled     ? 0 : 1u << BOOT_OLED)
+    | (Displays::alphanum ? 0 : 1u << BOOT_ALPHANUM)
+    | (Displays::anyI2c   ? 0 : 1u << BOOT_I2C_BUS);
+
+static uint8_t  bootDone = BOOT_ABSENT;  // Bit per BootStage
+static uint32_t bootStartMs = 0;
+
+static inline bool booted(BootStage stage)
 {
-    button_init();
-    motor_init();
-    pressure_init();
-    nav_init();
-    menu_init();
-
-    pinMode(BUTTPIN, INPUT);
-    analogReadResolution(12);
-
-    delay(3000);  // Recovery delay for FastLED
-
-    Serial.begin(115200);
-
-    FastLED.addLeds<LED_TYPE, LED_PIN, COLOR_ORDER>(leds, NUM_LEDS)
-        .setCorrection(TypicalLEDStrip);
-    FastLED.setBrightness(BRIGHTNESS);
-
-    display_init();
-    ledMatrix.begin();
-    matrix_graph_init();
-    // sim_arousal_init();
-    lcd_init();
-    fire_init();    // Seed the fire buffer
-    alphanum_init();  // Quad alphanumeric display (I2C 0x70)
-
-    // Recall saved settings from EEPROM
-    sensitivity = EEPROM.read(SENSITIVITY_ADDR);
-    maxMotorSpeed = min(EEPROM.read(MAX_SPEED_ADDR), MOT_MAX);
-
-    beep_motor(1047, 1396, 2093);  // Power-on beep
+    return bootDone & (1u << stage);
 }
 
-// ============================================================
-// Main loop — runs at 60Hz
-// ============================================================
-void loop()
+static inline void boot_mark(BootStage stage)
 {
-    // ── Top-level app state ────────────────────────────────────────────
-    // This is the "which screen" variable. It starts at APP_MENU so 
-    // the device boots into the main menu rather than immediately 
-    // entering operational mode.
-    static AppState appState = APP_MENU;
-
-    // ── Operational state (only matters when appState == APP_RUNNING) ──
-    static uint8_t operationalState = STANDBY;
-
-    // -- Set up previousAppState and declare it to be APP_MENU
-    static AppState prevAppState = APP_MENU;
-
-    // ── Shared loop state ──────────────────────────────────────────────
-    static int sampleTick = 0;
-    static unsigned long lastTick = 0;
-    static NavDirection lastNavDir = NAV_NONE;
-
-    // ── 60Hz tick gate ─────────────────────────────────────────────────
-    if (millis() - lastTick < UPDATE_PERIOD_MS) return;
-    lastTick = millis();
-    sampleTick++;
-
-    // Read the nav switch (debounced by the nav module)
-    NavDirection navDir = nav_read();
-
-    // Edge detection: did the direction just change this tick?
-    // This prevents held directions from firing repeatedly.
-    bool navChanged = (navDir != lastNavDir);
+    bootDone |= (1u << stage);
+}
 
+// ── Nav presses ────────────────────────────────────────────────────────
+// Called once for every press event the input queue delivers (see 
+// input_events.h), so a tap shorter than a tick still counts and a 
+// held direction never repeats. Each case is like a separate "screen" 
+// with its own input handling.
 
-    // ── Dispatch based on app state ────────────────────────────────────
-    // Each case is like a separate "screen" or "scene" with its own 
-    // input handling, display updates, and peripheral control.
+static void handle_nav_press(NavDirection dir)
+{
     switch (appState)
     {
         // ────────────────────────────────────────────────────────────────
         // MAIN MENU
         // ────────────────────────────────────────────────────────────────
         // The menu module handles its own cursor movement and selection.
-        // We just pass it the nav input and check if it wants to 
+        // We just pass it the press and check if it wants to 
         // transition to a different app state.
         case APP_MENU:
         {
-            AppState nextAppState = menu_update(navDir);
-            menu_render();
-            alphanum_show_text("MENU");
+            AppState nextAppState = menu_update(dir);
 
             // If the menu told us to go somewhere, set up for it
             if (nextAppState != APP_MENU)
@@ -409,173 +521,551 @@ void loop()
                 if (appState == APP_RUNNING)
                 {
                     operationalState = STANDBY;
-                    motorSpeed = 0;
-                    motor_write(0);
+                    state_enter(operationalState);
                 }
             }
             break;
         }
 
         // ────────────────────────────────────────────────────────────────
-        // OPERATIONAL MODE (the existing state machine)
+        // OPERATIONAL MODE
         // ────────────────────────────────────────────────────────────────
-        // This is where all the original protogasm functionality lives.
         // NAV_LEFT/RIGHT cycles through modes, NAV_CENTER → STANDBY,
-        // and NAV_UP is our escape hatch back to the menu.
+        // and NAV_UP is our escape hatch back to the menu. A transition 
+        // only runs the enter/exit hooks (state.h) — the new mode's 
+        // first tick is the control task's usual one, later this tick.
         case APP_RUNNING:
-        {
-            // ── NAV_UP: return to main menu ────────────────────────────
-            // Safety first — stop the motor before leaving operational 
-            // mode. We don't want the vibrator running unattended while 
-            // the user is browsing the menu.
-            if (navDir == NAV_UP && navChanged)
+            switch (dir) {
+                case NAV_UP:
+                    // Safety first — stop the motor before leaving 
+                    // operational mode. We don't want the vibrator 
+                    // running unattended while the user is browsing 
+                    // the menu.
+                    state_exit(operationalState);
+                    motorSpeed = 0;
+                    motor_write(0);
+                    menu_reset_cursor();
+                    appState = APP_MENU;
+                    break;
+
+                case NAV_LEFT:
+                    operationalState = state_transition(operationalState,
+                                                        get_previous_state(operationalState));
+                    break;
+
+                case NAV_RIGHT:
+                    operationalState = state_transition(operationalState,
+                                                        get_next_state(operationalState));
+                    break;
+
+                case NAV_CENTER:
+                    operationalState = state_transition(operationalState, STANDBY);
+                    break;
+
+                default:
+                    break;
+            }
+            break;
+
+        // ────────────────────────────────────────────────────────────────
+        // SETTINGS (placeholder) and DEMO
+        // ────────────────────────────────────────────────────────────────
+        // NAV_UP returns to the menu; nothing else does anything yet.
+        case APP_SETTINGS:
+        case APP_DEMO:
+            if (dir == NAV_UP)
             {
-                motorSpeed = 0;
-                motor_write(0);
                 menu_reset_cursor();
                 appState = APP_MENU;
-                break;  // Skip the rest of this tick
             }
+            break;
+    }
+}
 
-            // ── Pressure sensing ───────────────────────────────────────
-            update_pressure(sampleTick);
+// ============================================================
+// Control task — 60Hz
+// ============================================================
+// Input, pressure, state machines and motor. Everything that decides 
+// what the device DOES. Drawing happens in the render tasks below, 
+// which the scheduler only runs when there's time left over.
 
-            // ── LED fade (creates trailing light effect) ───────────────
-            fadeToBlackBy(leds, NUM_LEDS, 20);
+static void control_tick()
+{
+    profiler_frame_mark();
 
-            // ── Run current operational mode ───────────────────────────
-            run_state_machine(operationalState);
+    // ── Input events ───────────────────────────────────────────────────
+    // Drain everything the pin interrupts queued since the last tick, 
+    // oldest first. Two quick taps between ticks are two presses.
+    input_service();
 
-            // ── Handle nav for mode cycling ────────────────────────────
-            // This is the same logic that was in the old main.cpp, just 
-            // using the shared navChanged flag instead of comparing to 
-            // a separate lastNavDir.
-            if (navChanged)
-            {
-                uint8_t nextState;
-                switch (navDir) {
-                    case NAV_LEFT:
-                        nextState = get_previous_state(operationalState);
-                        operationalState = nextState;
-                        run_state_machine(operationalState);
-                        break;
-
-                    case NAV_RIGHT:
-                        nextState = get_next_state(operationalState);
-                        operationalState = nextState;
-                        run_state_machine(operationalState);
-                        break;
-
-                    case NAV_CENTER:
-                        operationalState = STANDBY;
-                        run_state_machine(operationalState);
-                        break;
-
-                    default:
-                        break;
-                }
-            }
+    InputEvent ev;
+    while (input_next_event(ev))
+    {
+        if (ev.source == INPUT_ENC_BUTTON) {
+            button_handle_event(ev);
+            continue;
+        }
 
-            // ── Update outputs ─────────────────────────────────────────
-            FastLED.show();
-            ledMatrix.scrollText(mode_to_string(operationalState));
-            display_update(operationalState, motorSpeed, pressure, averagePressure, navDir);
-            alphanum_update_running(operationalState);
+        if (ev.pressed) {
+            navDir = ev.dir;
+            handle_nav_press(ev.dir);
+        } else if (ev.dir == navDir) {
+            navDir = NAV_NONE;
+        }
+    }
 
-            // Warn if pressure sensor is railing (trimpot needs adjustment)
-            if (pressure > 4030) beep_motor(2093, 2093, 2093);
+    // A replay has the mode code's globals, so it can't outlast the 
+    // menu — not even for the one tick before the state change below
+    if (appState != APP_MENU) replay_cancel();
 
-            // Report data over USB
-            report_serial();
+    // ── Per-tick work for the current app state ────────────────────────
+    switch (appState)
+    {
+        // ────────────────────────────────────────────────────────────────
+        // MAIN MENU
+        // ────────────────────────────────────────────────────────────────
+        // The motor is stopped here, so this is where replays asked for 
+        // over serial ('R' / 'S') get to run.
+        case APP_MENU:
+            replay_service();
             break;
-        }
 
         // ────────────────────────────────────────────────────────────────
-        // SETTINGS (placeholder)
+        // OPERATIONAL MODE (the existing state machine)
         // ────────────────────────────────────────────────────────────────
-        // For now, just shows a "coming soon" message. NAV_UP returns 
-        // to the menu. This will eventually become its own submenu 
-        // with configurable options.
-        case APP_SETTINGS:
+        // This is where all the original protogasm functionality lives.
+        case APP_RUNNING:
         {
-            if (navDir == NAV_UP && navChanged)
+            // ── Pressure sensing ───────────────────────────────────────
             {
-                menu_reset_cursor();
-                appState = APP_MENU;
-                break;
+                ProfileScope prof(PROF_UPDATE_PRESSURE);
+                update_pressure();
             }
-            display_message("SETTINGS", "Coming soon...");
-            ledMatrix.scrollText("SETTINGS");
-            alphanum_show_text("SET");
+
+            // ── LED fade (creates trailing light effect) ───────────────
+            fadeToBlackBy(leds, NUM_LEDS, 20);
+
+            // ── Run current operational mode ───────────────────────────
+            {
+                ProfileScope prof(PROF_STATE_MACHINE);
+                run_state_machine(operationalState);
+            }
+
+            // ── Log this tick's samples and control values ─────────────
+            recorder_capture(operationalState);
+
+            // Warn if pressure sensor is railing (trimpot needs adjustment)
+            if (pressure > 4030) beep_motor(2093, 2093, 2093);
             break;
         }
 
         // ────────────────────────────────────────────────────────────────
         // DEMO / ATTRACT MODE
         // ────────────────────────────────────────────────────────────────
-        // Will eventually run a simulated session across all displays 
-        // and outputs. For now, just a placeholder screen.
+        // Runs a simulated session across all displays. The sim and 
+        // the fire heat advance here at a steady 60Hz; the render 
+        // tasks draw whatever the latest values are.
         case APP_DEMO:
         {
-            if (navDir == NAV_UP && navChanged)
-            {
-                menu_reset_cursor();
-                appState = APP_MENU;
-                break;
-            }
-
-            // display_message("DEMO", "Watch the screens...");
-            display_demo_water(sim_gsr);
-            
-            // Show arousal value on OLED, deprecated for alphanumeric display
-            // char arousal[32];
-            // sprintf(arousal, "Arousal: %d", simDelta);
-            alphanum_demo_tick();
-            // Feed simulated arousal data to the matrix graph
-            matrix_graph_tick(sim_arousal, sim_pressure_limit, ledMatrix);
-            
             // Advance the simulation by one tick
             sim_tick();
+            update_heart();
 
-            // Render fire to LCD
-            add_heat();
-            fire_tick();
+            // Feed the beat/arousal into the fire's intensity
+            if constexpr (Displays::lcd) add_heat();
             break;
         }
+
+        default:
+            break;
     }
 
     // --- Detect change of state and take one-time actions
     if (appState != prevAppState)
+    {
+        // ── On-leave actions for the OLD state ─────────────────────
+        if (prevAppState == APP_RUNNING)
+            recorder_stop();
+
         // ── On-enter actions for the NEW state ─────────────────────
         switch (appState)
         {
             case APP_MENU:
-                ledMatrix.clear();
-                ledMatrix.flush();
-                SPI.beginTransaction(SPISettings(24000000, MSBFIRST, SPI_MODE3));
-                lcd_fill(0x0001);
-                SPI.endTransaction();
+                if constexpr (Displays::matrix) {
+                    if (booted(BOOT_MATRIX)) {
+                        matrix().clear();
+                        matrix().flush();
+                    }
+                }
+                lcdClearPending = Displays::lcd;
                 break;
 
             case APP_RUNNING:
-                // could reset displays here too
+                if constexpr (Displays::lcd) lcd_dashboard_begin();
+                recorder_start();
                 break;
 
             case APP_DEMO:
-                // reinit the sim, clear displays, etc.
+                // The matrix was showing text — graph redraws it all
+                if constexpr (Displays::matrix) matrix_graph_invalidate();
                 break;
 
             default:
                 break;
         }
+    }
     
     // -- Update prevAppState to be current appState
     prevAppState = appState;
 
-    // ── Update edge detection state ────────────────────────────────────
-    // This MUST happen after all the switch cases, so every case can 
-    // use the navChanged flag consistently. If we updated lastNavDir 
-    // inside the cases, later cases in the same tick might see stale data.
-    // (Not an issue with switch/break, but good practice for maintainability.)
-    lastNavDir = navDir;
-}
\ No newline at end of file
+    // Nothing much to draw on the menu or in STANDBY — slow the CPU 
+    // down (power.h). Full speed again the tick anything starts, a 
+    // replay included.
+    power_set_low_clock((appState == APP_MENU && !replay_active()) ||
+                        (appState == APP_RUNNING && operationalState == STANDBY));
+}
+
+// ============================================================
+// Render tasks
+// ============================================================
+// One per output device. Each draws the current app state and 
+// returns. They never change state — if the control task moved us 
+// to another screen, the next render just draws that screen instead.
+//
+// The displays don't get a task each: they're Displays 
+// (frame_coordinator.h), and the "frames" task shares out the time 
+// before the next control tick between them. Each one's wants_*() 
+// says whether it has anything to draw — not booted yet, or nothing 
+// to show on this screen, means no.
+
+static bool wants_leds()     { return appState == APP_RUNNING; }
+static bool wants_alphanum() { return booted(BOOT_I2C_BUS); }
+
+static void render_leds(uint32_t)
+{
+    ProfileScope prof(PROF_LEDS_SHOW);
+    leds_show();
+}
+
+static void render_alphanum(uint32_t)
+{
+    switch (appState) {
+        case APP_MENU:     alphanum_show_text("MENU");                break;
+        case APP_RUNNING:
+        {
+            ProfileScope prof(PROF_ALPHANUM);
+            alphanum_update_running(operationalState);
+            break;
+        }
+        case APP_SETTINGS: alphanum_show_text("SET");                 break;
+        case APP_DEMO:     alphanum_demo_tick();                      break;
+    }
+
+    // One write per tick at most, and none when the text is unchanged
+    alphanum_commit();
+}
+
+// The matrix shows nothing on the menu screen
+static bool wants_matrix()
+{
+    return booted(BOOT_MATRIX) && appState != APP_MENU;
+}
+
+static void render_matrix(uint32_t)
+{
+    switch (appState) {
+        case APP_RUNNING:
+        {
+            ProfileScope prof(PROF_MATRIX_SCROLL);
+            matrix().scrollText(mode_label(operationalState));
+            break;
+        }
+        case APP_SETTINGS:
+            matrix().scrollText(SETTINGS_MATRIX_TEXT);
+            break;
+        case APP_DEMO:
+            // Feed simulated arousal data to the matrix graph
+            matrix_graph_tick(sim_arousal, sim_pressure_limit, matrix());
+            break;
+        default:
+            break;
+    }
+}
+
+static bool wants_lcd()
+{
+    if (!booted(BOOT_LCD)) return false;
+    return lcdClearPending || appState == APP_RUNNING || appState == APP_DEMO;
+}
+
+static void render_lcd(uint32_t)
+{
+    // lcd_fill_async() returns false while DMA is busy — try next tick
+    if (lcdClearPending) {
+        if (lcd_fill_async(0x0001)) lcdClearPending = false;
+        return;
+    }
+
+    // Dashboard sends only what changed since last tick
+    if (appState == APP_RUNNING) {
+        lcd_dashboard_update(operationalState);
+        return;
+    }
+
+    // Fire pushes its frame by DMA and returns straight away
+    ProfileScope prof(PROF_FIRE_TICK);
+    fire_tick();
+}
+
+static void render_serial()
+{
+    // Console commands ('p' = profiler report) work on every screen
+    serial_poll_commands();
+
+    // Report data over USB
+    if (appState != APP_RUNNING) return;
+
+    ProfileScope prof(PROF_REPORT_SERIAL);
+    report_serial(operationalState);
+}
+
+// The OLED is split in two. render_oled() draws a frame into RAM and 
+// notes which tiles changed; render_oled_io() hands those tiles to the 
+// I2C bus manager, which sends them from its interrupt in the 
+// background. A new frame is only drawn once the last one has gone 
+// out, so the OLED runs as fast as the bus allows instead of at a 
+// fixed 20Hz, and nothing waits on I2C.
+static bool wants_oled()    { return booted(BOOT_I2C_BUS) && !display_pending(); }
+static bool wants_oled_io() { return booted(BOOT_I2C_BUS) && display_pending(); }
+
+static void render_oled(uint32_t)
+{
+    switch (appState) {
+        case APP_MENU:
+            menu_render();
+            break;
+        case APP_RUNNING:
+        {
+            ProfileScope prof(PROF_DISPLAY_UPDATE);
+            display_update(operationalState, motorSpeed, pressure, averagePressure, navDir);
+            break;
+        }
+        case APP_SETTINGS:
+            display_message("SETTINGS", "Coming soon...");
+            break;
+        case APP_DEMO:
+            display_demo_water(sim_gsr);
+            break;
+    }
+}
+
+// ============================================================
+// Staged boot
+// ============================================================
+// setup() only brings up what the control task needs — buttons, 
+// motor, ADC, LED ring, settings — and then starts the scheduler, so 
+// the device is live within a few milliseconds of power-on. The 
+// displays join as they come up, one stage at a time, from the "boot" 
+// task:
+//
+//   LCD      ~200ms of reset/sleep-out waits, stepped through on every 
+//            call so they overlap everything else
+//   matrix   bit-banged GPIO, independent of the buses
+//   OLED     → alphanumeric → I2C takeover, in that order: they share 
+//            Wire, and the bus manager can only take over once both 
+//            devices' libraries have finished their init
+//   SD       after the LCD, whose SPI setup it shares, and only while 
+//            idle — it's the big one (below)
+//
+// In Python terms it's a set of coroutines:
+//
+//   await asyncio.gather(lcd.init(), matrix.init(),
+//                        chain(oled.init, alnum.init, i2c.takeover))
+//   await sd.init()
+//
+// The OLED/alphanumeric/SD stages are single blocking library calls 
+// (a few to tens of ms each), so they run one per call. Boot always 
+// starts in APP_MENU with the motor off, so the odd late control tick 
+// while one runs costs nothing. Render tasks check booted() and skip 
+// their display until its stage is done.
+//
+// The SD stage is SD.begin() plus the FAT walk to pre-allocate the 
+// first session file (session_recorder.h): hundreds of ms, far past 
+// any budget the scheduler could plan around. A session can be started 
+// before it comes round, so it waits for the same idle test as the 
+// recorder's own file work — the menu, or STANDBY.
+
+// Nothing is driving the motor: the menu, or STANDBY
+static bool device_idle()
+{
+    return appState != APP_RUNNING || operationalState == STANDBY;
+}
+
+static void boot_service()
+{
+    constexpr uint8_t ALL_STAGES = (1u << BOOT_STAGE_COUNT) - 1;
+    if (bootDone == ALL_STAGES) return;
+
+    // The LCD's waits are timed, so poll it on every call whatever 
+    // else is happening
+    if constexpr (Displays::lcd) {
+        if (!booted(BOOT_LCD) && lcd_init_service()) boot_mark(BOOT_LCD);
+    }
+
+    // Then at most one blocking stage per call. Absent displays' 
+    // stages are already marked done, and their bodies compile away.
+    if (!booted(BOOT_MATRIX)) {
+        if constexpr (Displays::matrix) {
+            matrix().begin();
+            matrix_register_messages();
+            matrix_graph_init();
+        }
+        boot_mark(BOOT_MATRIX);
+    }
+    else if (!booted(BOOT_OLED)) {
+        if constexpr (Displays::oled) display_init();
+        boot_mark(BOOT_OLED);
+    }
+    else if (!booted(BOOT_ALPHANUM)) {
+        if constexpr (Displays::alphanum) alphanum_init();  // Quad alphanumeric display (I2C 0x70)
+        boot_mark(BOOT_ALPHANUM);
+    }
+    else if (!booted(BOOT_I2C_BUS)) {
+        // The I2C displays are set up — from here on the bus is run 
+        // from its interrupt and nothing calls Wire directly 
+        // (i2c_bus.h). The alphanumeric's begin() reset Wire to 
+        // 100kHz, so restore 400kHz.
+        if constexpr (Displays::anyI2c) {
+            Wire.setClock(400000);
+            i2c_bus_begin();
+        }
+        boot_mark(BOOT_I2C_BUS);
+    }
+    else if (booted(BOOT_LCD) && !booted(BOOT_RECORDER) && device_idle()) {
+        recorder_init();  // SD card shares the LCD's SPI bus
+        boot_mark(BOOT_RECORDER);
+    }
+
+    if (bootDone == ALL_STAGES) {
+        Serial.printf("[Boot] All displays up %lu ms after setup()\n",
+                      (unsigned long)(millis() - bootStartMs));
+    }
+}
+
+// ── Task table ─────────────────────────────────────────────────────────
+// Periods are in microseconds. Budgets are rough worst-case run times 
+// measured on the bench — the scheduler only starts a render task if 
+// its budget fits before the control task is next due.
+//
+// The displays all go through the one "frames" task. Their costs are 
+// starting guesses from the bench; the coordinator measures the real 
+// ones as it goes. They're registered cheapest/most important first, 
+// so ties go to the LEDs and small displays, and the slow OLED is the 
+// one that waits — for a few ticks at most (FRAMES_FORCE_AFTER).
+static void render_oled_io(uint32_t)
+{
+    display_service();
+}
+
+static const Display LEDS_DISPLAY     = { "leds",     wants_leds,     leds_busy,      render_leds,     1000 };
+static const Display ALPHANUM_DISPLAY = { "alphanum", wants_alphanum, nullptr,        render_alphanum, 600  };
+static const Display MATRIX_DISPLAY   = { "matrix",   wants_matrix,   nullptr,        render_matrix,   500  };
+static const Display LCD_DISPLAY      = { "lcd",      wants_lcd,      lcd_frame_busy, render_lcd,      3000 };
+static const Display OLED_DISPLAY     = { "oled",     wants_oled,     nullptr,        render_oled,     1500 };
+static const Display OLED_IO_DISPLAY  = { "oled_io",  wants_oled_io,  nullptr,        render_oled_io,  200  };
+
+// Settings only go to flash while nothing is running: the emulated 
+// EEPROM can stall the CPU for a sector erase.
+static void render_settings()
+{
+    settings_service(device_idle());
+}
+
+// Same for the recorder's file open and close (session_recorder.h)
+static void render_recorder()
+{
+    recorder_service(device_idle());
+}
+
+static void scheduler_setup()
+{
+    constexpr uint32_t RECORDER_PERIOD_US = 20000;   // 50Hz, up to 4 sectors each
+    constexpr uint32_t SETTINGS_PERIOD_US = 50000;   // 20Hz, a few bytes each
+
+    constexpr uint32_t BOOT_PERIOD_US = 2000;     // Fine enough for the LCD's 20ms waits
+
+    scheduler_add("control",  control_tick,    UPDATE_PERIOD_US, 2000,  TASK_CONTROL);
+
+    scheduler_add("boot",     boot_service,    BOOT_PERIOD_US,   300,   TASK_RENDER);
+
+    // Displays the hardware profile (config.h) doesn't have never 
+    // reach the coordinator — their render functions are never 
+    // referenced, so the linker drops them along with their drivers
+    frames_add(&LEDS_DISPLAY);
+    if constexpr (Displays::alphanum) frames_add(&ALPHANUM_DISPLAY);
+    if constexpr (Displays::matrix)   frames_add(&MATRIX_DISPLAY);
+    if constexpr (Displays::lcd)      frames_add(&LCD_DISPLAY);
+    if constexpr (Displays::oled) {
+        frames_add(&OLED_DISPLAY);
+        frames_add(&OLED_IO_DISPLAY);
+    }
+    scheduler_add("frames",   frames_run,      UPDATE_PERIOD_US, 300,   TASK_RENDER);
+
+    scheduler_add("serial",   render_serial,   UPDATE_PERIOD_US, 300,   TASK_RENDER);
+    scheduler_add("recorder", render_recorder, RECORDER_PERIOD_US, 1500, TASK_RENDER);
+    scheduler_add("settings", render_settings, SETTINGS_PERIOD_US, 400,   TASK_RENDER);
+}
+
+// ============================================================
+// Setup
+// ============================================================
+void setup()
+{
+    memory_init();     // Paint the stack before anything uses it
+    button_init();
+    motor_init();
+    pressure_init();   // Also starts the background ADC
+    sensors_init();    // ECG/GSR on the second ADC module
+    nav_init();
+    input_init();      // Pin interrupts for the nav switch and button
+    menu_init();
+
+    Serial.begin(115200);
+    profiler_init();
+    bootStartMs = millis();
+
+    leds_init();    // DMA output for the LED ring (no settle time needed)
+
+    // Recall saved settings (settings.h) — from here on they're saved 
+    // in the background whenever they change
+    settings_init();
+
+    if constexpr (Displays::lcd) {
+        fire_init();       // Seed the fire buffer (RAM only)
+        lcd_init_start();  // Reset begins now; the boot task finishes it
+    }
+
+    beep_motor(1047, 1396, 2093);  // Power-on beep (plays from loop())
+
+    // Control runs from the first pass of loop(); the displays join 
+    // from the boot task (see "Staged boot" above)
+    scheduler_setup();
+}
+
+// ============================================================
+// Main loop
+// ============================================================
+// All the timing lives in the scheduler now. Each pass runs whatever 
+// is due, then the core sleeps until the next task is (power.h) — 
+// or until an interrupt, whichever comes first.
+void loop()
+{
+    // Beep sequences run in the background — advance them on every 
+    // pass so note timing stays tight (the 1ms interrupts wake us 
+    // often enough for 250ms notes)
+    motor_tone_tick();
+
+    scheduler_run();
+
+    power_idle(scheduler_idle_us());
+}
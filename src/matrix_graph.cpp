@@ -82,14 +82,27 @@ constexpr uint8_t ROWS = HT1632C_HEIGHT;  // 8
 constexpr uint8_t DIM_ZONE_SIZE = COLS / 4;  // 6 columns per zone
 
 // ── Internal state ─────────────────────────────────────────────────────
-// history[] stores one bar height (0–ROWS) per column. Index 0 is 
-// the leftmost (oldest) column, index 23 is rightmost (newest).
+// history[] stores one bar height (0–ROWS) per column, as a circular 
+// buffer: historyHead is the index of the OLDEST (leftmost) column, 
+// and screen column c lives at history[(historyHead + c) % COLS]. 
+// A shift overwrites the oldest entry and moves the head on one — no 
+// memmove.
 //
-// In Python terms: it's a list of 24 ints that we treat like a deque,
-// shifting left and appending on the right.
+// In Python terms: a deque(maxlen=24), with append() on every shift.
+//
+// The rightmost (newest) column is live: between shifts it follows 
+// the smoothed value, and the shift freezes it and starts a new one.
 
 static uint8_t history[COLS];
+static uint8_t historyHead = 0;
 static unsigned long lastShiftTime = 0;
+static float smoothedDelta = 0.0f;
+static bool redrawAll = true;       // Next tick must draw every column
+
+// Screen column byte for every (height, age) pair, built once from 
+// build_column() so a redraw is 24 table lookups. Age fixes the 
+// column (col = 23 - age), so its even/odd dither phase too.
+static uint8_t columnLut[ROWS + 1][COLS];
 
 
 // ════════════════════════════════════════════════════════════════════════
@@ -219,15 +232,33 @@ static uint8_t build_column(uint8_t height, uint8_t age, uint8_t col)
 void matrix_graph_init()
 {
     memset(history, 0, sizeof(history));
-    lastShiftTime = millis();
-    // Can't reset the static from here directly, but we could 
-    // add a flag — or just let it settle naturally in ~400ms.
-    // For a clean reset, make smoothedDelta file-scope static instead.
+    historyHead = 0;
+    smoothedDelta = 0.0f;
+    lastShiftTime = hal_millis();
+    redrawAll = true;
+
+    for (uint8_t height = 0; height <= ROWS; height++) {
+        for (uint8_t age = 0; age < COLS; age++) {
+            columnLut[height][age] = build_column(height, age, (COLS - 1) - age);
+        }
+    }
+}
+
+uint8_t matrix_graph_column(uint8_t height, uint8_t age)
+{
+    if (height > ROWS) height = ROWS;
+    if (age >= COLS) age = COLS - 1;
+    return columnLut[height][age];
+}
+
+void matrix_graph_invalidate()
+{
+    redrawAll = true;
 }
 
 void matrix_graph_tick(int arousalDelta, int maxDelta, HT1632C_Display& display)
 {
-    unsigned long now = millis();
+    unsigned long now = hal_millis();
 
     // ── Smooth the input with an EMA ───────────────────────────────
     // The raw delta is noisy tick-to-tick (muscle contractions are 
@@ -247,8 +278,7 @@ void matrix_graph_tick(int arousalDelta, int maxDelta, HT1632C_Display& display)
     //
     // The alpha value (0.08) is the main tuning knob. If the display still looks a bit twitchy, drop it to 0.05 for a ~600ms window. If it feels too sluggish and doesn't react quickly enough to rising arousal, push it up to 0.12. The sweet spot is where you can see the bars building smoothly during a ramp but still see the drop after an edge within a second or two.
     //
-    // 'static' so it persists between calls, like a class attribute.
-    static float smoothedDelta = 0.0f;
+    // smoothedDelta is file-scope so matrix_graph_init() can reset it.
     constexpr float GRAPH_ALPHA = 0.08f;
 
     // Clamp negative deltas to zero before smoothing — we don't 
@@ -257,29 +287,44 @@ void matrix_graph_tick(int arousalDelta, int maxDelta, HT1632C_Display& display)
     float clampedDelta = (arousalDelta > 0) ? (float)arousalDelta : 0.0f;
     smoothedDelta = GRAPH_ALPHA * clampedDelta + (1.0f - GRAPH_ALPHA) * smoothedDelta;
 
+    uint8_t height = delta_to_height((int)(smoothedDelta + 0.5f), maxDelta);
+    uint8_t newest = (historyHead + COLS - 1) % COLS;
+
     // ── Shift & sample at the configured interval ──────────────────
+    // Overwrite the oldest slot and make it the newest. Every column 
+    // moves one place left, so the whole screen needs redrawing.
     if (now - lastShiftTime >= SHIFT_INTERVAL_MS)
     {
         lastShiftTime = now;
-        memmove(&history[0], &history[1], COLS - 1);
+        newest = historyHead;
+        historyHead = (historyHead + 1) % COLS;
+        history[newest] = height;
+        redrawAll = true;
+    }
 
-        // Sample the SMOOTHED value, not the raw one
-        history[COLS - 1] = delta_to_height((int)(smoothedDelta + 0.5f), maxDelta);
+    // ── Render ─────────────────────────────────────────────────────
+    // Nothing shifted: the only column that can change is the live 
+    // newest one, and only when the smoothed value crosses into a 
+    // different bar height. Most ticks, that's nothing at all.
+    if (!redrawAll)
+    {
+        if (history[newest] == height) return;
+        history[newest] = height;
+        display.setColumn(COLS - 1, columnLut[height][0]);
+        display.flush();
+        return;
     }
 
-    // ── Render all columns ─────────────────────────────────────────
-    // We rebuild the entire framebuffer every frame. This is fast — 
-    // 24 iterations of simple bitwise math, trivial for the Teensy's 
-    // 600MHz ARM core. The flush() at the end pushes all 48 bytes 
-    // to the display over bit-banged serial.
-    display.clear();
+    // Full redraw after a shift (or an invalidate): 24 lookups. 
+    // flush() then only sends the columns whose bytes changed.
     for (uint8_t col = 0; col < COLS; col++)
     {
         // Age: rightmost column (23) is newest (age 0),
         // leftmost column (0) is oldest (age 23).
         uint8_t age = (COLS - 1) - col;
 
-        display.setColumn(col, build_column(history[col], age, col));
+        display.setColumn(col, columnLut[history[(historyHead + col) % COLS]][age]);
     }
     display.flush();
-}
\ No newline at end of file
+    redrawAll = false;
+}
@@ -0,0 +1,107 @@
+// memory_diag.cpp — Linker sections, heap and stack painting
+//
+// ═══════════════════════════════════════════════════════════════════════
+// THE TEENSY 4 MEMORY MAP (imxrt1062.ld)
+// ═══════════════════════════════════════════════════════════════════════
+//
+//   ITCM 0x00000000  _stext ... _etext          code, padded to 32K banks
+//   DTCM 0x20000000  _sdata ... _edata          .data
+//                    _sbss  ... _ebss           .bss
+//                    _ebss  ... _estack         stack, growing down
+//   RAM  0x20200000  ...       _heap_start      DMAMEM (.dmabuffers)
+//                    _heap_start ... _heap_end  heap, __brkval = its top
+//
+// The symbols are addresses, not variables: &_ebss is the end of .bss.
+// _itcm_block_count and _flashimagelen are plain numbers dressed up as
+// addresses the same way.
+//
+// ── Painting ──────────────────────────────────────────────────────────
+// Only the part of the stack below the current stack pointer is
+// painted, less a margin for the painting loop itself and anything an
+// interrupt pushes meanwhile. An interrupt that lands during painting
+// just has its (already finished) frame painted over.
+
+#include "memory_diag.h"
+
+#if defined(__IMXRT1062__)
+#include <malloc.h>
+
+extern unsigned long _stext, _etext;
+extern unsigned long _sdata, _edata, _sbss, _ebss, _estack;
+extern unsigned long _heap_start, _heap_end;
+extern unsigned long _itcm_block_count, _flashimagelen;
+extern char* __brkval;                 // Top of the heap (the core's sbrk)
+#endif
+
+constexpr uint32_t STACK_PAINT = 0xC0FFEE55;
+constexpr uint32_t PAINT_MARGIN_BYTES = 256;
+constexpr uint32_t OCRAM_START = 0x20200000;
+
+static bool painted = false;
+
+static inline uint32_t addr(const void* p)
+{
+    return (uint32_t)(uintptr_t)p;
+}
+
+void memory_init()
+{
+#if defined(__IMXRT1062__)
+    uint32_t sp;
+    asm volatile("mov %0, sp" : "=r"(sp));
+
+    uint32_t* p = (uint32_t*)&_ebss;
+    uint32_t* end = (uint32_t*)(uintptr_t)(sp - PAINT_MARGIN_BYTES);
+    while (p < end) *p++ = STACK_PAINT;
+    painted = true;
+#endif
+}
+
+MemoryStats memory_stats()
+{
+    MemoryStats s = {};
+
+#if defined(__IMXRT1062__)
+    s.itcmBytes  = addr(&_itcm_block_count) * 32768;
+    s.codeBytes  = addr(&_etext) - addr(&_stext);
+    s.dataBytes  = addr(&_edata) - addr(&_sdata);
+    s.bssBytes   = addr(&_ebss) - addr(&_sbss);
+    s.stackBytes = addr(&_estack) - addr(&_ebss);
+
+    if (painted) {
+        // The first word that isn't paint is the deepest the stack got
+        const uint32_t* p = (const uint32_t*)&_ebss;
+        const uint32_t* top = (const uint32_t*)&_estack;
+        while (p < top && *p == STACK_PAINT) p++;
+        s.stackPeakBytes = addr(top) - addr(p);
+    }
+
+    struct mallinfo mi = mallinfo();
+    s.dmamemBytes   = addr(&_heap_start) - OCRAM_START;
+    s.heapUsedBytes = mi.uordblks;
+    s.heapFreeBytes = (addr(&_heap_end) - addr(__brkval)) + mi.fordblks;
+    s.flashBytes    = addr(&_flashimagelen);
+#endif
+
+    return s;
+}
+
+void memory_report(Print& out)
+{
+    MemoryStats s = memory_stats();
+
+    out.printf("[Memory] RAM1 code %lu of %luK ITCM  data %lu  bss %lu\n",
+               (unsigned long)s.codeBytes, (unsigned long)(s.itcmBytes / 1024),
+               (unsigned long)s.dataBytes, (unsigned long)s.bssBytes);
+    if (painted) {
+        out.printf("[Memory] RAM1 stack peak %lu of %lu (%lu free)\n",
+                   (unsigned long)s.stackPeakBytes, (unsigned long)s.stackBytes,
+                   (unsigned long)(s.stackBytes - s.stackPeakBytes));
+    } else {
+        out.printf("[Memory] RAM1 stack %lu (not painted)\n", (unsigned long)s.stackBytes);
+    }
+    out.printf("[Memory] RAM2 DMAMEM %lu  heap used %lu  free %lu\n",
+               (unsigned long)s.dmamemBytes, (unsigned long)s.heapUsedBytes,
+               (unsigned long)s.heapFreeBytes);
+    out.printf("[Memory] flash %lu\n", (unsigned long)s.flashBytes);
+}
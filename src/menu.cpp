@@ -48,47 +48,24 @@ static constexpr uint8_t MENU_ITEM_COUNT = sizeof(mainMenu) / sizeof(mainMenu[0]
 // ── Internal state ─────────────────────────────────────────────────────
 
 static uint8_t cursorPos = 0;           // Which item is highlighted (0-indexed)
-static NavDirection lastNavDir = NAV_NONE;  // For edge detection (act on press, not hold)
 
 // ── Initialisation ─────────────────────────────────────────────────────
 
 void menu_init()
 {
     cursorPos = 0;
-    lastNavDir = NAV_NONE;
 }
 
 // ── Input handling ─────────────────────────────────────────────────────
 //
-// Edge detection: we only act when the direction CHANGES. If you hold 
-// DOWN, you get one cursor move, not 60 per second. You have to release 
-// and press again. This matches how the operational mode nav works in 
-// main.cpp and feels natural on a 5-way switch.
-//
-// The pattern is:
-//   if (dir != lastDir) {
-//       // This is a NEW press — do something
-//   }
-//   lastDir = dir;
-//
-// In Python GUI terms, this is like binding to on_press rather than 
-// on_hold — you only fire once per press/release cycle.
+// Called once per PRESS event from the input queue (input_events.h), so
+// there's no edge detection to do here: holding DOWN is one press and 
+// gives one cursor move, not 60 per second. You have to release and 
+// press again. In Python GUI terms, this is binding to on_press rather 
+// than on_hold.
 
 AppState menu_update(NavDirection dir)
 {
-    // Only act on transitions (new presses)
-    if (dir == lastNavDir) {
-        return APP_MENU;  // No change, stay in menu
-    }
-
-    // NavDirection previousDir = lastNavDir;
-    lastNavDir = dir;
-
-    // Ignore releases (NAV_NONE) — we only care about new presses
-    if (dir == NAV_NONE) {
-        return APP_MENU;
-    }
-
     switch (dir) {
         case NAV_DOWN:
             if (cursorPos < MENU_ITEM_COUNT - 1) {
@@ -137,12 +114,8 @@ void menu_render()
 
 // ── Cursor reset ───────────────────────────────────────────────────────
 // Called when returning to the menu from another app state.
-// Resets both the cursor position AND the edge detection state,
-// so a held NAV_UP from the previous state doesn't immediately 
-// move the cursor when we arrive here.
 
 void menu_reset_cursor()
 {
     cursorPos = 0;
-    lastNavDir = NAV_NONE;
 }
\ No newline at end of file
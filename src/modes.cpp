@@ -7,7 +7,17 @@
 #include "motor.h"
 #include "buttons.h"    // for encLimitRead
 #include "pressure.h"
-
+#include "edge_guard.h"
+#include "fixed.h"
+#include "auto_policy.h"
+#include "state.h"
+
+// Each mode's LED ring colour is in its MODES[] row (state.cpp), so
+// the ring and the row can't disagree
+static inline CRGB mode_colour(uint8_t mode)
+{
+    return CRGB(mode_descriptor(mode).colour);
+}
 
 // --- Standby mode ---
 // Kills all motor output and enters a passive state ready to change modes.
@@ -29,87 +39,81 @@ void run_manual() {
         0, pressureLimit, 0, NUM_LEDS * 3
     );
     draw_bars_3(presDraw, CRGB::Green, CRGB::Yellow, CRGB::Red);
-    draw_cursor(knob, CRGB::Red);
+    draw_cursor(knob, mode_colour(MANUAL));
+}
+
+// Counted once per edge, not once per tick spent over the limit
+static uint32_t autoEdges = 0;
+static bool     overLimitLastTick = false;
+
+uint32_t auto_edge_count()
+{
+    return autoEdges;
+}
+
+// How long each userMode keeps the motor off after an edge, in ms 
+// (auto_policy.h), with the settings and per-edge state it steps on 
+// taken from and put back into the globals.
+static uint32_t cooldown_ms()
+{
+    AutoSettings settings = { rampUp, cooldown, maxCooldown, cooldownStep, pressureStep, maxMotorSpeed };
+    AutoEdgeState edge = { minimumcooldown, cooldownFlag, pressureLimit };
+
+    uint32_t ms = auto_cooldown_ms(userMode, settings, edge);
+
+    minimumcooldown = edge.minimumcooldown;
+    cooldownFlag    = edge.cooldownFlag;
+    pressureLimit   = edge.pressureLimit;
+    return ms;
 }
 
 // --- Automatic edging mode (Blue) ---
 // Motor ramps up linearly. If pressure spike detected (approaching 
 // orgasm), motor cuts immediately and waits through a cooldown 
 // before ramping again. Knob adjusts detection sensitivity.
+//
+// The ramp itself runs in the motor engine at 1kHz (motor.h). Each 
+// tick, this just decides where the motor should be heading and how 
+// fast, or cuts it for a cooldown; motorSpeed mirrors the engine's 
+// level for the displays and the recorder.
 void run_auto() {
-    // 'static' here means these persist between calls — like 
-    // instance variables on a Python class. They keep their value 
-    // from one 60Hz tick to the next.
-    static float motorIncrement = 0.0;
-    static float LimitSpeed = 0.0;
-
-    // Calculate how much to increment motor speed each tick to 
-    // reach maxMotorSpeed over rampUp seconds.
-    // e.g. 255 / (60Hz * 10s) = ~0.425 per tick
-    motorIncrement = ((float)maxMotorSpeed / ((float)FREQUENCY * (float)rampUp));
-
     // Knob controls sensitivity. Higher knob = lower pressureLimit = more sensitive.
     // The 3-revolution range (0 to 71) gives fine-grained control.
     int knob = encLimitRead(0, (3 * NUM_LEDS) - 1);
     sensitivity = knob * 4;
-    pressureLimit = map(knob, 0, 3 * (NUM_LEDS - 1), MAX_PRESSURE_LIMIT, 1);
+
+    // The threshold for this knob position, or in mode 7 from the 
+    // live noise statistics (auto_policy.h)
+    pressureLimit = auto_pressure_limit(userMode, knob, edge_guard_noise());
+
+    // Hand the live threshold to the ISR-side guard. It checks every 
+    // ADC sample and has usually cut the motor already by the time we 
+    // get here — this tick's job is just the cooldown bookkeeping.
+    edge_guard_arm(pressureLimit);
 
     // --- EDGE DETECTED: pressure spike exceeds threshold ---
-    if (pressure - averagePressure > pressureLimit)
+    // Either the guard tripped between ticks, or this tick's sample is 
+    // over the limit (belt and braces — same comparison as the ISR).
+    bool edgeDetected = edge_guard_take_event();
+    if (edgeDetected || pressure - averagePressure > pressureLimit)
     {
-        motor_write(0);  // Kill motor immediately
-
-        // Each userMode handles cooldown differently by setting motorSpeed 
-        // to a negative value. Since the motor only turns on when motorSpeed 
-        // exceeds MOT_MIN (~20), a negative motorSpeed means the ramp-up 
-        // has to "climb back from below zero" before the motor restarts.
-        // The more negative, the longer the effective cooldown.
-        //
-        // This is a clever trick: rather than using a separate timer, the 
-        // cooldown duration emerges naturally from how deep negative we go 
-        // and how fast motorIncrement brings us back up.
-        switch (userMode)
-        {
-            case 1:  // Half ramp-up time as cooldown
-                motorSpeed = -.5 * (float)rampUp * ((float)FREQUENCY * motorIncrement);
-                break;
-
-            case 2:  // Double ramp-up time as cooldown
-                motorSpeed = -2 * (float)rampUp * ((float)FREQUENCY * motorIncrement);
-                break;
-
-            case 3:  // Fixed cooldown (in seconds)
-                motorSpeed = -1 * (float)cooldown * ((float)FREQUENCY * motorIncrement);
-                break;
-
-            case 4:  // Slow creep — cooldown increases each edge
-                motorSpeed = -1 * (float)minimumcooldown * ((float)FREQUENCY * motorIncrement);
-                if (cooldownFlag == 1)
-                {
-                    cooldownFlag = 0;
-                    if (minimumcooldown <= maxCooldown)
-                        minimumcooldown += cooldownStep;
-                }
-                break;
-
-            case 5:  // More sensitive — lowers threshold each edge
-                motorSpeed = -1 * (float)cooldown * ((float)FREQUENCY * motorIncrement);
-                if (cooldownFlag == 1)
-                {
-                    cooldownFlag = 0;
-                    if (cooldown <= maxCooldown)
-                        pressureLimit = max(pressureLimit - pressureStep, 10);
-                }
-                break;
-
-            case 6:  // Clench-responsive — motor inversely tracks pressure
-                motorSpeed = -(.5 * (float)rampUp * ((float)FREQUENCY * motorIncrement) + 10);
-                break;
-        }
+        if (!overLimitLastTick) autoEdges++;
+        overLimitLastTick = true;
+
+        // Off now, and held off for the cooldown. Every tick spent 
+        // over the limit restarts the hold, so the cooldown is timed 
+        // from when the pressure comes back down.
+        motor_engine_cut(cooldown_ms());
     }
     // --- NO EDGE: ramp up toward target speed ---
     else
     {
+        overLimitLastTick = false;
+        q16_t maxSpeed = q16_from_int(maxMotorSpeed);
+
+        // Full speed in rampUp seconds
+        q16_t rise = q16_div_int(maxSpeed, max(rampUp, 1));
+
         if (userMode == 6)
         {
             // Mode 6 continuously adjusts the speed ceiling based on 
@@ -120,39 +124,34 @@ void run_auto() {
             //
             // The 1.15 multiplier makes the ceiling drop slightly faster 
             // than a pure linear relationship, adding a safety margin.
-            LimitSpeed = (float)maxMotorSpeed 
-                - (1.15 * (pressure - averagePressure) / pressureLimit * (float)maxMotorSpeed);
-            LimitSpeed = constrain(LimitSpeed, 0, (float)maxMotorSpeed);
-
-            if (motorSpeed < LimitSpeed)
-                motorSpeed += motorIncrement;           // Ramp up toward ceiling
-            else if (motorSpeed > LimitSpeed)
-                motorSpeed -= 3.5 * motorIncrement;    // Back off quickly if ceiling dropped
-        }
-        else if (motorSpeed < (float)maxMotorSpeed)
-        {
-            motorSpeed += motorIncrement;  // Standard linear ramp for modes 1-5
-        }
-
-        // Apply motor output
-        if (motorSpeed > MOT_MIN)
-        {
-            motor_write((int)motorSpeed);
+            // 1.15 × delta × max fits comfortably in 64 bits before the
+            // one divide by pressureLimit.
+            int32_t delta = pressure - averagePressure;
+            q16_t drop = q16_scale(q16(1.15f), delta * maxMotorSpeed, pressureLimit);
+            q16_t ceiling = q16_clamp(maxSpeed - drop, 0, maxSpeed);
+
+            // Back off quickly if the ceiling dropped
+            motor_engine_set(ceiling, rise, q16_mul(q16(3.5f), rise));
         }
         else
         {
-            motor_write(0);
-            cooldownFlag = 1;  // Signal that cooldown period has elapsed
+            motor_engine_set(maxSpeed, rise, rise);  // Standard linear ramp for modes 1-5 and 7
         }
 
+        // The motor has been off since the last edge: the next edge 
+        // may step modes 4 and 5 on
+        if (motor_engine_holding() || motor_engine_level() == 0) cooldownFlag = 1;
+
         // Draw pressure bar and sensitivity cursor
         int presDraw = map(
             constrain(pressure - averagePressure, 0, pressureLimit),
             0, pressureLimit, 0, NUM_LEDS * 3
         );
         draw_bars_3(presDraw, CRGB::Green, CRGB::Yellow, CRGB::Red);
-        draw_cursor_3(knob, CRGB(50, 50, 200), CRGB::Blue, CRGB::Purple);
+        draw_cursor_3(knob, CRGB(50, 50, 200), mode_colour(AUTO), CRGB::Purple);
     }
+
+    motorSpeed = q16_to_float(motor_engine_level());
 }
 
 // --- Max speed setting (Green) ---
@@ -169,7 +168,7 @@ void run_opt_speed()
     else visRamp = 0;
     draw_bars_3(
         map(visRamp, 0, (NUM_LEDS - 1) * FREQUENCY, 0, knob),
-        CRGB::Green, CRGB::Green, CRGB::Green
+        mode_colour(OPT_SPEED), mode_colour(OPT_SPEED), mode_colour(OPT_SPEED)
     );
 }
 
@@ -190,14 +189,14 @@ void run_opt_beep()
 // Useful for adjusting the analog gain trimpot.
 void run_opt_pres()
 {
-    int p = map(analogRead(BUTTPIN), 0, ADC_MAX, 0, NUM_LEDS - 1);
-    draw_cursor(p, CRGB::White);
+    int p = map(read_pressure_raw(), 0, ADC_MAX, 0, NUM_LEDS - 1);
+    draw_cursor(p, mode_colour(OPT_PRES));
 }
 
 // --- User mode selection ---
 void run_opt_userModeChange()
 {
     int position = encLimitRead(1, userModeTotal);
-    draw_cursor(position, CRGB::Red);
+    draw_cursor(position, mode_colour(OPT_USER_MODE));
     userMode = position;
 }
\ No newline at end of file
@@ -4,6 +4,74 @@
 #include "config.h"
 #include "globals.h"
 
+// Set from interrupt context by motor_emergency_cut(). While true, 
+// the PWM is held at 0 whatever the engine asks for — the main loop 
+// has to acknowledge the cut first (see edge_guard.cpp).
+static volatile bool cutLatched = false;
+
+// Replay in progress — see motor_set_dry_run()
+static volatile bool dryRun = false;
+
+// ── Tone sequencer ───────────────────────────────────────────────────
+//
+// beep_motor() used to play its three notes with delay(250) between 
+// them, freezing everything (displays, sampling, edge handling) for 
+// 750ms. Now notes go into a small queue and motor_tone_tick() moves 
+// on to the next one when the current note's time is up.
+//
+//   toneQueue:  [ 2093/250 | 2093/250 | 2093/250 |   |   | ... ]
+//                  ▲ toneTail (playing)              ▲ toneHead (next free)
+//
+// While a sequence is playing, tone() owns the pin. pwm_write() 
+// just remembers the requested PWM in restorePwm, and that goes back 
+// on the pin when the queue runs dry.
+//
+// In Python terms it's an asyncio task that awaits each note instead 
+// of calling time.sleep() on the main thread.
+
+struct ToneNote {
+    uint16_t freq;        // Hz, 0 = rest (silence for durationMs)
+    uint16_t durationMs;
+};
+
+constexpr uint8_t TONE_QUEUE_SIZE = 8;   // Must be a power of two
+constexpr uint8_t TONE_QUEUE_MASK = TONE_QUEUE_SIZE - 1;
+
+static ToneNote toneQueue[TONE_QUEUE_SIZE];
+static uint8_t  toneHead = 0;        // Next free slot
+static uint8_t  toneTail = 0;        // Note currently playing / next to play
+static uint32_t noteStartMs = 0;
+
+// Shared with the engine ISR, which writes the PWM through pwm_write()
+static volatile bool tonePlaying = false;
+static volatile int  restorePwm = 0;      // PWM to put back afterwards
+
+// Set by motor_emergency_cut() so the next tick abandons the sequence.
+static volatile bool toneCancel = false;
+
+static void engine_begin();
+
+// The single place the PWM is written (apart from the emergency cut).
+// Called from the engine's timer interrupt every millisecond, and from
+// the tone sequencer when a beep ends.
+static void pwm_write(int pwm)
+{
+    // During a beep sequence tone() owns the pin. Remember the PWM 
+    // and apply it when the sequence ends.
+    restorePwm = pwm;
+    if (tonePlaying || dryRun) return;
+
+    // Check-and-write must be atomic with respect to the edge guard 
+    // ISR. Otherwise the ISR could cut the motor between our latch 
+    // check and the analogWrite, and we'd switch it straight back on. 
+    // analogWrite is ~1us, so masking interrupts for it costs nothing 
+    // measurable.
+    __disable_irq();
+    if (cutLatched) pwm = 0;
+    analogWrite(MOTPIN, pwm);
+    __enable_irq();
+}
+
 void motor_init()
 {
     // Set PWM frequency to 31kHz — above human hearing so the 
@@ -20,23 +88,263 @@ void motor_init()
 
     pinMode(MOTPIN, OUTPUT);
     digitalWrite(MOTPIN, LOW);
+
+    engine_begin();
 }
 
-void beep_motor(int f1, int f2, int f3)
+static void tone_start_note(const ToneNote& note)
+{
+    if (note.freq > 0) {
+        tone(MOTPIN, note.freq);
+    } else {
+        noTone(MOTPIN);
+    }
+    noteStartMs = millis();
+}
+
+// Sequence finished (or cancelled): stop the tone and hand the pin 
+// back to PWM at whatever speed was last asked for.
+static void tone_finish()
 {
-    analogWrite(MOTPIN, 0);
-    tone(MOTPIN, f1);
-    delay(250);
-    tone(MOTPIN, f2);
-    delay(250);
-    tone(MOTPIN, f3);
-    delay(250);
     noTone(MOTPIN);
-    // Restore whatever speed the motor was at before the beep
-    analogWrite(MOTPIN, (int)motorSpeed);
+    toneTail = toneHead;
+    tonePlaying = false;
+    toneCancel = false;
+    pwm_write(restorePwm);
+}
+
+bool motor_tone_queue(uint16_t freq, uint16_t durationMs)
+{
+    if (((toneHead + 1) & TONE_QUEUE_MASK) == toneTail) {
+        return false;   // Full — drop the note rather than block
+    }
+    toneQueue[toneHead] = { freq, durationMs };
+    toneHead = (toneHead + 1) & TONE_QUEUE_MASK;
+    return true;
+}
+
+bool motor_tone_busy()
+{
+    return tonePlaying || toneHead != toneTail;
+}
+
+void motor_tone_tick()
+{
+    if (toneCancel) {
+        tone_finish();
+        return;
+    }
+
+    if (tonePlaying) {
+        const ToneNote& note = toneQueue[toneTail];
+        if (millis() - noteStartMs < note.durationMs) return;
+
+        // Current note is done — move on
+        toneTail = (toneTail + 1) & TONE_QUEUE_MASK;
+        if (toneTail == toneHead) {
+            tone_finish();
+            return;
+        }
+        tone_start_note(toneQueue[toneTail]);
+        return;
+    }
+
+    if (toneHead != toneTail) {
+        // New sequence: silence the PWM and start the first note.
+        // restorePwm keeps the last PWM written before the beep.
+        tonePlaying = true;
+        analogWrite(MOTPIN, 0);
+        tone_start_note(toneQueue[toneTail]);
+    }
+}
+
+void beep_motor(int f1, int f2, int f3)
+{
+    // Already beeping? Don't stack another copy on top. The pressure 
+    // railing warning calls this every tick while the sensor is high.
+    if (motor_tone_busy()) return;
+
+    motor_tone_queue(f1, 250);
+    motor_tone_queue(f2, 250);
+    motor_tone_queue(f3, 250);
+    motor_tone_tick();   // Start the first note now rather than next pass
+}
+
+void motor_emergency_cut()
+{
+    cutLatched = true;
+    if (dryRun) return;
+    analogWrite(MOTPIN, 0);    // Also takes the pin away from tone()
+    toneCancel = true;         // Sequencer cleans up on its next tick
+}
+
+void motor_release_cut()
+{
+    cutLatched = false;
+}
+
+void motor_set_dry_run(bool enable)
+{
+    if (enable) analogWrite(MOTPIN, 0);
+    dryRun = enable;
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// 1kHz OUTPUT ENGINE
+// ═══════════════════════════════════════════════════════════════════════
+//
+//   mode code (60Hz)                        engine ISR (1kHz)
+//   ────────────────                        ─────────────────
+//   motor_engine_set(target, rise, fall) ─→ target, riseStep, fallStep
+//   motor_engine_cut(holdMs)             ─→ holdLeft, level = 0
+//                                           holding?  level = 0
+//                                           else level → target by one step
+//                                           MOTOR_LUT[level] → PWM
+//   motor_engine_level()                 ◄─ level
+//
+// run_auto() used to add motorIncrement to motorSpeed once per 60Hz 
+// tick and write the result straight to the PWM — a staircase of 
+// ~0.4-level steps that stopped climbing whenever the loop stalled. 
+// Here the same ramp is 1/1000th of a second's worth per step, on a 
+// clock nothing in the loop can hold up.
+//
+// The main loop only ever writes the request (target, steps, hold), 
+// with interrupts masked so the ISR never sees half of one.
+
+constexpr uint32_t ENGINE_HZ = 1000;
+
+// Every IntervalTimer shares the one PIT interrupt, and with it one 
+// NVIC priority, so this has to match the sensor channels' timer 
+// (sensor_channels.cpp). It's still well below the pressure ADC, so the 
+// edge guard can always cut the motor mid-step.
+constexpr uint8_t ENGINE_IRQ_PRIORITY = 64;
+
+// Perceived intensity → PWM, at levels 0, 16, 32 … 256, interpolated 
+// in between. The motor doesn't turn at all below MOT_MIN, and its 
+// strength rises faster than its PWM at the bottom of the range, so 
+// the curve starts at MOT_MIN and climbs gently at first 
+// (MOT_MIN + (255 − MOT_MIN) × x^1.5). Re-measure with a new motor.
+static const uint8_t MOTOR_LUT[17] = {
+     20,  24,  30,  39,  49,  61,  74,  88,
+    103, 119, 136, 154, 173, 192, 212, 233, 255
+};
+static_assert(MOT_MIN == 20, "MOTOR_LUT starts at MOT_MIN — recalibrate it");
+
+static IntervalTimer engineTimer;
+
+static volatile q16_t    level = 0;
+static volatile uint32_t holdLeft = 0;       // ms still to hold off
+static q16_t target = 0;
+static q16_t riseStep = 0;                   // Per ms; 0 = jump
+static q16_t fallStep = 0;
+
+static uint8_t intensity_to_pwm(q16_t l)
+{
+    if (l <= 0) return 0;
+    if (l >= q16_from_int(MOT_MAX)) return MOTOR_LUT[16];
+
+    // 16 levels per table segment: the top bits pick the segment, the 
+    // next 8 are how far along it we are
+    uint32_t idx  = (uint32_t)l >> (Q16_SHIFT + 4);
+    uint32_t frac = ((uint32_t)l >> (Q16_SHIFT - 4)) & 0xFF;
+    int32_t lo = MOTOR_LUT[idx];
+    int32_t hi = MOTOR_LUT[idx + 1];
+    return (uint8_t)(lo + (((hi - lo) * (int32_t)frac + 128) >> 8));
+}
+
+static void engine_step()
+{
+    q16_t l = level;
+
+    if (cutLatched) {
+        l = 0;                               // Ramp back from off after a cut
+    } else if (holdLeft > 0) {
+        holdLeft = holdLeft - 1;
+        l = 0;
+    } else if (l < target) {
+        l = (riseStep == 0 || target - l <= riseStep) ? target : l + riseStep;
+    } else if (l > target) {
+        l = (fallStep == 0 || l - target <= fallStep) ? target : l - fallStep;
+    }
+
+    level = l;
+    pwm_write(intensity_to_pwm(l));
+}
+
+static void engine_isr()
+{
+    if (!dryRun) engine_step();
+}
+
+static void engine_begin()
+{
+    engineTimer.priority(ENGINE_IRQ_PRIORITY);
+    engineTimer.begin(engine_isr, 1000000.0f / ENGINE_HZ);
+}
+
+// A per-second rate as a per-step one. A slow ramp never rounds down 
+// to 0, which would mean "jump".
+static q16_t per_step(q16_t perSec)
+{
+    if (perSec <= 0) return 0;
+    q16_t step = q16_div_int(perSec, ENGINE_HZ);
+    return step > 0 ? step : 1;
+}
+
+void motor_engine_set(q16_t newTarget, q16_t risePerSec, q16_t fallPerSec)
+{
+    q16_t t = q16_clamp(newTarget, 0, q16_from_int(MOT_MAX));
+    q16_t rise = per_step(risePerSec);
+    q16_t fall = per_step(fallPerSec);
+
+    __disable_irq();
+    target = t;
+    riseStep = rise;
+    fallStep = fall;
+    __enable_irq();
+}
+
+void motor_engine_cut(uint32_t holdMs)
+{
+    // Hold first, then let go of any emergency latch, in one masked 
+    // block — the engine ISR can never run with neither holding the 
+    // output off
+    __disable_irq();
+    holdLeft = holdMs;
+    level = 0;
+    cutLatched = false;
+    __enable_irq();
+
+    pwm_write(0);       // Now, not on the next step
+}
+
+bool motor_engine_holding()
+{
+    return holdLeft > 0;
+}
+
+q16_t motor_engine_level()
+{
+    return level;
+}
+
+void motor_engine_advance(uint32_t ms)
+{
+    if (!dryRun) return;
+    while (ms--) engine_step();
 }
 
 void motor_write(int speed)
 {
-    analogWrite(MOTPIN, speed);
-}
\ No newline at end of file
+    q16_t l = q16_from_int(constrain(speed, 0, (int)MOT_MAX));
+
+    __disable_irq();
+    target = l;
+    level = l;
+    riseStep = 0;
+    fallStep = 0;
+    holdLeft = 0;
+    __enable_irq();
+
+    pwm_write(intensity_to_pwm(l));
+}
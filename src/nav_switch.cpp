@@ -13,32 +13,11 @@
 // but it's standard because pull-up resistors are built into most MCUs
 // while pull-downs often aren't.
 //
-// DEBOUNCING:
-// Mechanical switches don't make clean transitions — the metal contacts
-// literally bounce for a few milliseconds, producing rapid on-off-on
-// noise. We handle this with a simple approach: require the same reading
-// for DEBOUNCE_TICKS consecutive polls before accepting it. At 60Hz,
-// 3 ticks = 50ms, which filters out bounce without feeling laggy.
-//
-// In Python terms, it's like:
-//   if all(readings[-3:]) == same_value:
-//       confirmed_state = same_value
+// Debouncing and edge detection happen in input_events.cpp, which
+// watches these pins by interrupt. This file just sets them up and
+// names the directions.
 
 #include "nav_switch.h"
-#include "config.h"
-
-// How many consecutive identical readings before we accept a change.
-// At 60Hz: 3 ticks ≈ 50ms. Enough to filter bounce, fast enough
-// to feel instant to a human.
-constexpr uint8_t DEBOUNCE_TICKS = 3;
-
-// ── Internal state ─────────────────────────────────────────────────────
-// These are "file-scope" statics — visible only inside this .cpp file.
-// In Python terms, they're module-private variables (like _underscore).
-
-static NavDirection stableDirection = NAV_NONE;   // Last confirmed direction
-static NavDirection candidateDirection = NAV_NONE; // What we're currently seeing
-static uint8_t candidateCount = 0;                 // How many ticks we've seen it
 
 // ── Pin setup ──────────────────────────────────────────────────────────
 
@@ -57,49 +36,6 @@ void nav_init()
     pinMode(NAV_PIN_CENTER, INPUT_PULLUP);
 }
 
-// ── Read the raw switch state (no debouncing) ──────────────────────────
-// Checks each pin and returns the first one found pressed.
-// If multiple directions are pressed simultaneously (unlikely with a
-// 5-way nav switch, but possible), we just take the first one — this
-// is called "priority encoding."
-
-static NavDirection raw_read()
-{
-    // Remember: LOW = pressed (active low)
-    if (digitalRead(NAV_PIN_UP)     == LOW) return NAV_UP;
-    if (digitalRead(NAV_PIN_DOWN)   == LOW) return NAV_DOWN;
-    if (digitalRead(NAV_PIN_LEFT)   == LOW) return NAV_LEFT;
-    if (digitalRead(NAV_PIN_RIGHT)  == LOW) return NAV_RIGHT;
-    if (digitalRead(NAV_PIN_CENTER) == LOW) return NAV_CENTER;
-    return NAV_NONE;
-}
-
-// ── Debounced read ─────────────────────────────────────────────────────
-
-NavDirection nav_read()
-{
-    NavDirection current = raw_read();
-
-    if (current == candidateDirection)
-    {
-        // Same reading as last tick — increment the stability counter
-        if (candidateCount < DEBOUNCE_TICKS)
-            candidateCount++;
-
-        // Once we've seen the same value for enough ticks, accept it
-        if (candidateCount >= DEBOUNCE_TICKS)
-            stableDirection = candidateDirection;
-    }
-    else
-    {
-        // Reading changed — start counting again from this new value
-        candidateDirection = current;
-        candidateCount = 1;
-    }
-
-    return stableDirection;
-}
-
 // ── Human-readable direction names ─────────────────────────────────────
 // Returns a pointer to a string literal. These live in flash memory
 // and never need freeing — safe to pass around freely.
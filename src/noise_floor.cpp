@@ -0,0 +1,111 @@
+// noise_floor.cpp — Welford / exponentially weighted delta statistics
+//
+// ═══════════════════════════════════════════════════════════════════════
+// FIXED POINT
+// ═══════════════════════════════════════════════════════════════════════
+//
+// The mean and peak are Q16 like the baseline's EMA accumulator
+// (baseline_filter.cpp): a 12-bit delta is at most ±4095 << 16 ≈ 2^28.
+// The variance is in counts² and Q16, which needs up to 2^40, so it
+// lives in a uint64_t inside the ISR and is published as a 32-bit Q8
+// copy the main loop can read in one go.
+//
+// The step size a = 1/n during the first window makes the update
+// exactly Welford's (the true mean and population variance of what's
+// been seen). From then on a stays at 1/2^shift, so the update is a
+// shift and old samples fade out with a time constant of one window.
+// Either way variance += d × (a·d) is never negative: d and a·d have
+// the same sign.
+//
+// ── Outliers ──────────────────────────────────────────────────────────
+// A sample more than NOISE_OUTLIER_DEVIATIONS from the mean is skipped
+// by all three statistics. The comparison is done squared, so it needs
+// no square root in the ISR:
+//
+//   d² > k² × var
+//
+// The test starts a sixteenth of the way into the first window — by
+// then there's enough noise seen to judge by, and a clench in the
+// first few seconds can't settle into the statistics.
+//
+// The variance is floored at 1 count² for the test, or a dead-flat
+// input would make every later sample an outlier and the statistics
+// could never move again. A genuine rise in noise still gets through,
+// since most of it falls inside the old limit and widens it.
+
+#include "noise_floor.h"
+#include "config.h"
+#include <math.h>
+
+constexpr uint64_t OUTLIER_K2 = (uint64_t)NOISE_OUTLIER_DEVIATIONS * NOISE_OUTLIER_DEVIATIONS;
+constexpr uint64_t MIN_TEST_VAR_Q16 = 1ull << 16;     // 1 count²
+
+// Smallest s such that (1 << s) >= n
+static uint8_t ceil_shift(uint32_t n)
+{
+    uint8_t s = 0;
+    while ((1ul << s) < n && s < 24) s++;
+    return s;
+}
+
+NoiseFloor::NoiseFloor(uint32_t windowSamples)
+    : _shift(ceil_shift(windowSamples))
+{
+}
+
+void NoiseFloor::reset()
+{
+    _count = 0;
+    _varQ16 = 0;
+    _primed = false;
+    _meanQ16 = 0;
+    _peakQ16 = 0;
+    _varQ8 = 0;
+}
+
+void NoiseFloor::reset(uint32_t windowSamples)
+{
+    _shift = ceil_shift(windowSamples);
+    reset();
+}
+
+void NoiseFloor::update(int32_t delta)
+{
+    int32_t x = delta * 65536;
+    int32_t mean = _meanQ16;
+    int32_t d = x - mean;
+
+    if (_count >= (1ul << _shift) / 16) {
+        uint64_t testVar = _varQ16 > MIN_TEST_VAR_Q16 ? _varQ16 : MIN_TEST_VAR_Q16;
+        if ((uint64_t)((int64_t)d * d) > OUTLIER_K2 * (testVar << 16)) return;
+    }
+
+    // a = 1/n for the first window (Welford), 1/2^shift after
+    uint32_t window = 1ul << _shift;
+    bool warming = _count < window;
+    if (warming) _count++;
+
+    int32_t step = warming ? d / (int32_t)_count : d >> _shift;
+    mean += step;
+
+    _varQ16 += (uint64_t)(((int64_t)d * step) >> 16);
+    _varQ16 -= warming ? _varQ16 / _count : _varQ16 >> _shift;
+
+    // Peak: jumps up to a new high, decays toward the mean at the same
+    // rate the statistics forget
+    int32_t peak = _peakQ16;
+    if (_count == 1) peak = mean;
+    peak -= (peak - mean) >> _shift;
+    if (x > peak) peak = x;
+
+    _meanQ16 = mean;
+    _peakQ16 = peak;
+    uint64_t varQ8 = _varQ16 >> 8;
+    _varQ8 = varQ8 > 0xFFFFFFFFull ? 0xFFFFFFFFul : (uint32_t)varQ8;
+    if (_count >= window) _primed = true;
+}
+
+float NoiseFloor::deviation() const
+{
+    return sqrtf(_varQ8 / 256.0f);
+}
@@ -10,9 +10,41 @@
 // go when you call sendBuffer(). This uses ~1KB of RAM but avoids 
 // the complexity of page-based rendering. The Teensy 4.0 has 1MB 
 // of RAM so this is nothing.
+//
+// ═══════════════════════════════════════════════════════════════════════
+// PAGE DIFFING — ONLY SEND WHAT CHANGED
+// ═══════════════════════════════════════════════════════════════════════
+//
+// sendBuffer() pushes all 1024 bytes over I2C (~23ms at 400kHz) even 
+// if only the motor percentage moved. So the draw functions don't call 
+// it any more. Instead they finish with display_commit(), which:
+//
+//   1. compares the new frame against `shadow` — a copy of what the 
+//      panel is actually showing — one 8×8 tile at a time
+//   2. marks the tiles that differ in dirtyTiles[page] (one bit per 
+//      tile, 16 tiles across each of the 8 pages)
+//
+// display_service() then hands the dirty tiles to the shared I2C bus 
+// manager (i2c_bus.h) as 32-pixel chunks, copying each into `shadow` 
+// as it goes. Submitting doesn't wait for the bus — the interrupt 
+// sends them in the background — and it stops when the bus queue is 
+// full. Whatever's left goes in on the next call, so a frame that 
+// changed everywhere (the demo water) drains over a few ticks without 
+// ever blocking one.
+//
+// In Python terms:
+//   dirty |= {tile for tile in tiles if frame[tile] != shadow[tile]}
+//   while dirty and bus.has_room():
+//       bus.submit(dirty.pop()); shadow[tile] = frame[tile]
+//
+// U8g2 itself still talks to the panel (blocking, through Wire) for 
+// its init sequence in display_init(). After that the bus belongs to 
+// i2c_bus and U8g2 is only used for drawing into RAM.
 
 #include "oleddisplay.h"
 #include "config.h"
+#include "i2c_bus.h"
+#include "state.h"
 #include <U8g2lib.h>
 #include <Wire.h>
 
@@ -28,45 +60,24 @@
 // Most I2C SH1106 boards tie reset high internally.
 static U8G2_SH1106_128X64_NONAME_F_HW_I2C oleddisplay(U8G2_R0, U8X8_PIN_NONE);
 
-// ── Shared display throttle ────────────────────────────────────────────
-// All three display functions (display_update, display_menu, 
-// display_message) share this throttle. Since only ONE of them runs 
-// at any given time (the main loop picks based on AppState), they 
-// won't interfere with each other.
-//
-// Without throttling, a 60Hz main loop would hammer the I2C bus with 
-// display updates. Each full-frame I2C transfer takes ~10-30ms at 
-// 400kHz, which would eat into our 16ms tick budget. Throttling to 
-// 10Hz keeps updates snappy without starving other I/O.
-constexpr unsigned long DISPLAY_UPDATE_INTERVAL_MS = 50;  // 20Hz
-static unsigned long lastDisplayUpdate = 0;
-
-// Returns true if enough time has passed for a display refresh.
-// Updates the timestamp internally so callers can just do:
-//   if (!display_throttle_check()) return;
-static bool display_throttle_check()
-{
-    unsigned long now = millis();
-    if (now - lastDisplayUpdate < DISPLAY_UPDATE_INTERVAL_MS) return false;
-    lastDisplayUpdate = now;
-    return true;
-}
+// ── Page diff state ────────────────────────────────────────────────────
+constexpr uint8_t  OLED_PAGES = 8;          // 64 rows / 8 rows per page
+constexpr uint8_t  OLED_TILES = 16;         // 128 columns / 8 per tile
+constexpr uint16_t OLED_BUFFER_BYTES = 128 * OLED_PAGES;
 
-// Convert the numeric mode constant to a human-readable string.
-static const char* mode_to_string(uint8_t mode)
-{
-    switch (mode) {
-        case MANUAL:       return "Manual";
-        case AUTO:         return "Auto";
-        case OPT_SPEED:    return "Set Speed";
-        case OPT_RAMPSPD:  return "Set Ramp";
-        case OPT_BEEP:     return "Settings";
-        case OPT_PRES:     return "Pressure";
-        case OPT_USER_MODE: return "User Mode";
-        case STANDBY:      return "Standby";
-        default:           return "Unknown";
-    }
-}
+constexpr uint8_t  OLED_I2C_ADDR = 0x3C;
+constexpr uint8_t  OLED_CHUNK_TILES = 4;    // 32 pixels per transaction
+
+// The SH1106 has 132 columns of RAM for a 128-pixel panel, centred — 
+// U8g2's SH1106 NONAME driver uses the same 2-column offset.
+constexpr uint8_t  OLED_COLUMN_OFFSET = 2;
+
+static uint8_t  shadow[OLED_BUFFER_BYTES];  // What the panel is showing
+static uint16_t dirtyTiles[OLED_PAGES];     // Bit t = tile t needs sending
+
+// The OLED used to throttle itself here to 20Hz with a millis() check 
+// in every draw function. The rate is now set by the OLED render task 
+// in main.cpp (see scheduler.h), so these functions just draw.
 
 // ════════════════════════════════════════════════════════════════════════
 // Initialisation
@@ -79,6 +90,89 @@ void display_init()
     oleddisplay.clearBuffer();
     oleddisplay.drawStr(20, 32, "Nextgasm");
     oleddisplay.sendBuffer();
+
+    // The whole frame just went out, so the panel matches the buffer
+    memcpy(shadow, oleddisplay.getBufferPtr(), OLED_BUFFER_BYTES);
+    memset(dirtyTiles, 0, sizeof(dirtyTiles));
+}
+
+// ════════════════════════════════════════════════════════════════════════
+// Page diffing
+// ════════════════════════════════════════════════════════════════════════
+
+// Mark every tile of the new frame that differs from the panel.
+// Tiles already pending stay pending — they'll be sent from whatever 
+// the buffer holds when their turn comes.
+static void display_commit()
+{
+    const uint8_t* buf = oleddisplay.getBufferPtr();
+
+    for (uint8_t page = 0; page < OLED_PAGES; page++) {
+        const uint8_t* row = buf + page * 128;
+        const uint8_t* old = shadow + page * 128;
+        uint16_t mask = 0;
+
+        for (uint8_t tile = 0; tile < OLED_TILES; tile++) {
+            if (memcmp(row + tile * 8, old + tile * 8, 8) != 0) {
+                mask |= (uint16_t)1 << tile;
+            }
+        }
+        dirtyTiles[page] |= mask;
+    }
+}
+
+// Each chunk is ONE I2C transaction: three single commands to set the 
+// page and column (control byte 0x80 = "one command byte follows, 
+// then another control byte"), then 0x40 = "everything after this is 
+// pixel data".
+static bool send_chunk(uint8_t page, uint8_t firstTile, uint8_t tiles)
+{
+    uint8_t col = firstTile * 8 + OLED_COLUMN_OFFSET;
+    uint8_t msg[7 + OLED_CHUNK_TILES * 8];
+    msg[0] = 0x80; msg[1] = 0xB0 | page;          // Page address
+    msg[2] = 0x80; msg[3] = 0x10 | (col >> 4);    // Column, high nibble
+    msg[4] = 0x80; msg[5] = col & 0x0F;           // Column, low nibble
+    msg[6] = 0x40;
+
+    uint16_t offset = page * 128 + firstTile * 8;
+    memcpy(&msg[7], oleddisplay.getBufferPtr() + offset, tiles * 8);
+
+    if (i2c_write(OLED_I2C_ADDR, msg, 7 + tiles * 8, I2C_PRIO_DISPLAY) < 0) {
+        return false;      // Queue full — try again next call
+    }
+
+    // That's what the panel will show once the bus gets to it
+    memcpy(shadow + offset, &msg[7], tiles * 8);
+    return true;
+}
+
+bool display_service()
+{
+    for (uint8_t page = 0; page < OLED_PAGES; page++) {
+        while (dirtyTiles[page] != 0) {
+            // From the first dirty tile, take up to a chunk's worth — a 
+            // few clean tiles in the middle cost less than a second 
+            // transaction would.
+            uint16_t mask = dirtyTiles[page];
+            uint8_t first = __builtin_ctz(mask);
+            uint8_t last = 15 - __builtin_clz((uint32_t)mask << 16);
+            uint8_t tiles = last - first + 1;
+            if (tiles > OLED_CHUNK_TILES) tiles = OLED_CHUNK_TILES;
+
+            if (!send_chunk(page, first, tiles)) return true;
+
+            dirtyTiles[page] &= ~(uint16_t)(((1u << tiles) - 1) << first);
+        }
+    }
+    return false;
+}
+
+bool display_pending()
+{
+    for (uint8_t page = 0; page < OLED_PAGES; page++) {
+        if (dirtyTiles[page] != 0) return true;
+    }
+    return false;
 }
 
 // ════════════════════════════════════════════════════════════════════════
@@ -87,14 +181,12 @@ void display_init()
 
 void display_update(uint8_t mode, float motorSpeed, int pressure, int averagePressure, NavDirection navDir)
 {
-    if (!display_throttle_check()) return;
-
     // --- Build the frame ---
     oleddisplay.clearBuffer();
 
     // Mode name — large, top of screen
     oleddisplay.setFont(u8g2_font_7x14B_tr);
-    oleddisplay.drawStr(0, 12, mode_to_string(mode));
+    oleddisplay.drawStr(0, 12, mode_title(mode));
 
     // Nav direction indicator — top right corner
     if (navDir != NAV_NONE) {
@@ -130,8 +222,8 @@ void display_update(uint8_t mode, float motorSpeed, int pressure, int averagePre
     snprintf(buf, sizeof(buf), "Raw: %4d  Avg: %4d", pressure, averagePressure);
     oleddisplay.drawStr(0, 58, buf);
 
-    // --- Send to hardware ---
-    oleddisplay.sendBuffer();
+    // --- Queue whatever changed (display_service() sends it) ---
+    display_commit();
 }
 
 // ════════════════════════════════════════════════════════════════════════
@@ -160,8 +252,6 @@ void display_update(uint8_t mode, float motorSpeed, int pressure, int averagePre
 
 void display_menu(const char* title, const char* items[], uint8_t itemCount, uint8_t cursorPos)
 {
-    if (!display_throttle_check()) return;
-
     oleddisplay.clearBuffer();
 
     // ── Title ──────────────────────────────────────────────────────────
@@ -216,7 +306,7 @@ void display_menu(const char* title, const char* items[], uint8_t itemCount, uin
         }
     }
 
-    oleddisplay.sendBuffer();
+    display_commit();
 }
 
 // ════════════════════════════════════════════════════════════════════════
@@ -238,8 +328,6 @@ void display_menu(const char* title, const char* items[], uint8_t itemCount, uin
 
 void display_message(const char* title, const char* message)
 {
-    if (!display_throttle_check()) return;
-
     oleddisplay.clearBuffer();
 
     // Title — bold, centred vertically and horizontally
@@ -258,13 +346,41 @@ void display_message(const char* title, const char* message)
     oleddisplay.setFont(u8g2_font_5x7_tr);
     oleddisplay.drawStr(36, 63, "UP = Back to menu");
 
-    oleddisplay.sendBuffer();
+    display_commit();
 }
 
-// 4×4 Bayer threshold matrix, stored in program memory.
-// 'static constexpr' means it's computed at compile time and lives 
-// in flash, not RAM. Same as a Python module-level tuple of tuples 
-// that never changes.
+// ═══════════════════════════════════════════════════════════════════════
+// DEMO WATER — TABLE-DRIVEN
+// ═══════════════════════════════════════════════════════════════════════
+//
+// The water surface is three standing/travelling waves summed per 
+// column, and everything under it is filled with Bayer-dithered 
+// "translucent" water fading to solid. The demo also runs the LCD 
+// fire, the matrix graph and the simulation, so the OLED's share of 
+// the frame has to be small. Two tables make each column a handful of 
+// integer operations:
+//
+//   SINE[256]            sin() over one turn, Q14. Angles are "binary 
+//                        degrees": a uint16_t where 65536 is a full 
+//                        turn, so they wrap for free and the top 8 
+//                        bits are the table index.
+//
+//   DITHER[x & 3][off]   every page byte the dither band can produce. 
+//                        A page starts 8 rows at a time, so its byte 
+//                        only depends on where the surface sits 
+//                        relative to its top row (off) and on which 
+//                        Bayer column the screen column falls in.
+//
+// So per column: three sine lookups for the surface, then one store 
+// per page — 0x00 above the water, a DITHER byte in the band, 0xFF 
+// below it. Nothing per pixel and no floats. In Python terms:
+//
+//   y = base + sum(a * SINE[(x * k + phase) >> 8] for a, k in waves)
+//   for page in range(8):
+//       off = page * 8 - y
+//       buf[page][x] = 0 if off < -7 else 0xFF if off >= DEPTH else DITHER[x % 4][off + 7]
+
+// 4×4 Bayer threshold matrix
 static constexpr uint8_t BAYER4[4][4] = {
     {  0,  8,  2, 10 },
     { 12,  4, 14,  6 },
@@ -274,154 +390,154 @@ static constexpr uint8_t BAYER4[4][4] = {
 
 // How many pixels below the surface before the fill becomes 
 // fully solid. Larger = more gradual fade-in = more visible 
-// translucency. 20px gives a nice band of dithering that's 
-// clearly visible on a 64px tall display.
-constexpr int DITHER_DEPTH = 15;
+// translucency.
+constexpr int DITHER_DEPTH = 16;
 
-// Display water effect in demo mode
-// Use full-buffer mode to reduce overhead of per-pixel drawing with the standard driver
-void display_demo_water(float gsr)
+// ── Sine table ───────────────────────────────────────────────────────
+// Built by the compiler from a Taylor series (constexpr can't call 
+// sinf), so it lands in flash ready-made.
+struct SineTable { int16_t v[256]; };
+
+static constexpr SineTable make_sine()
 {
-    if (!display_throttle_check()) return;
-
-    static float phase = 0.0f;
-    phase += 0.15f;
-
-    static constexpr uint8_t BAYER4[4][4] = {
-        {  0,  8,  2, 10 },
-        { 12,  4, 14,  6 },
-        {  3, 11,  1,  9 },
-        { 15,  7, 13,  5 }
-    };
-    // Depth of the dithered area
-    constexpr int DITHER_DEPTH = 16;
-
-    // Get a raw pointer to U8g2's internal framebuffer.
-    // This is safe because we're in full-buffer ("F") mode — the 
-    // entire 1024-byte framebuffer lives in RAM and won't change 
-    // until we call sendBuffer().
-    //
-    // In Python terms, this is like getting a memoryview into a 
-    // bytearray — direct access, no copies, no overhead.
-    uint8_t* buf = oleddisplay.getBufferPtr();
+    SineTable t = {};
+    constexpr double PI = 3.14159265358979323846;
+    for (int i = 0; i < 256; i++) {
+        double a = 2.0 * PI * i / 256.0;
+        if (a > PI) a -= 2.0 * PI;           // Series converges fastest near 0
+        double term = a, sum = a;
+        for (int n = 1; n < 12; n++) {
+            term *= -a * a / ((2 * n) * (2 * n + 1));
+            sum += term;
+        }
+        double q = sum * 16384.0;
+        t.v[i] = (int16_t)(q < 0 ? q - 0.5 : q + 0.5);
+    }
+    return t;
+}
 
-    // Clear the buffer manually — faster than clearBuffer() since 
-    // we already have the pointer. memset writes 1024 zeros in a 
-    // single burst on ARM (it uses optimised word-width stores).
-    memset(buf, 0, 1024);
+static constexpr SineTable SINE = make_sine();
 
-    for (int x = 0; x < 128; x++)
-    {
-        float baseY = 52.0f - (gsr * 35.0f);
+// Angle steps in binary degrees: radians × 65536 / 2π
+static constexpr uint16_t bam(double radians)
+{
+    return (uint16_t)(radians * 65536.0 / (2.0 * 3.14159265358979323846) + 0.5);
+}
 
-        // ── Edge damping envelope ──────────────────────────────────
-        // Taper amplitude near the "container walls" so waves don't 
-        // just scroll off the edges. The min() picks whichever edge 
-        // is closer, then we normalise to 0.0–1.0.
-        //
-        // In Python: envelope = min(min(x, 127 - x) / 20.0, 1.0)
-        float distFromEdge = fminf((float)x, 127.0f - (float)x);
-        float envelope = fminf(distFromEdge / 20.0f, 1.0f);
-
-        // ── Standing wave components ───────────────────────────────
-        // 
-        // Each wave is sin(spatial) * cos(temporal) — the shape stays 
-        // in place while the height oscillates. Different temporal 
-        // frequencies for each layer so they don't all peak together.
-        //
-        // Layer 1: broad, slow swell — the main "slosh"
-        // Always present, like the fundamental mode of a bathtub.
-        float wave1 = sinf(x * 0.05f) * cosf(phase * 0.8f)
-                    * (2.0f + gsr * 6.0f);
-
-        // Layer 2: medium standing wave — adds complexity as GSR rises.
-        // Offset the spatial frequency so nodes don't align with wave1.
-        float wave2 = sinf(x * 0.11f) * cosf(phase * 1.4f)
-                    * (gsr * 5.0f);
-
-        // Layer 3: fast ripple — turbulence at high GSR.
-        // This one stays as a TRAVELLING wave: sin(kx + wt).
-        // A small amount of horizontal drift in the chop layer 
-        // prevents the surface from looking too symmetrical and 
-        // "frozen". It's like the difference between a pool with 
-        // a gentle breeze (some drift) vs a perfectly still basin.
-        float wave3 = sinf(x * 0.25f + phase * 2.5f)
-                    * (fmaxf(0, gsr - 0.4f) * 4.0f);
-
-        // Combine with envelope damping.
-        // The broad waves get full damping (they "respect" the walls).
-        // The fine ripple gets less damping — choppy turbulence can 
-        // splash right up to the edges, which looks natural.
-        float surface = (wave1 + wave2) * envelope
-                    + wave3 * fminf(envelope * 2.0f, 1.0f);
-
-        int surfaceY = constrain((int)(baseY + surface), 0, 63);
-
-        // ── Fill column with dithered water, one page at a time ──
-        // 
-        // Instead of calling drawPixel 40+ times per column, we 
-        // process 8 rows at once (one "page"). For each page, we 
-        // build a byte where each bit = one pixel, then write the 
-        // whole byte in one shot.
-        //
-        // Three cases per page:
-        //   1. Entirely above surface → skip (byte stays 0x00)
-        //   2. Entirely below surface AND past dither zone → 0xFF
-        //   3. Partially in the dither zone → compute per-bit
+static inline int32_t sin_q14(uint16_t angle) { return SINE.v[angle >> 8]; }
+static inline int32_t cos_q14(uint16_t angle) { return SINE.v[(uint16_t)(angle + 16384) >> 8]; }
 
-        for (int page = 0; page < 8; page++)
-        {
-            int pageTopY = page * 8;    // First row in this page
-            int pageBotY = pageTopY + 7; // Last row in this page
-
-            // Case 1: whole page is above the waterline — nothing to draw
-            if (pageBotY < surfaceY) continue;
-
-            // Case 2: whole page is deep underwater (past dither zone)
-            // — solid fill, just write 0xFF. No per-pixel math needed.
-            if (pageTopY >= surfaceY + DITHER_DEPTH)
-            {
-                buf[page * 128 + x] = 0xFF;
-                continue;
-            }
+// ── Pre-packed dither bytes ──────────────────────────────────────────
+// DITHER[col][off + 7] is the page byte for a page whose top row is 
+// `off` rows below the surface (−7 … DITHER_DEPTH−1), in Bayer column 
+// `col`. Bit b is row b of the page; a page starts on a multiple of 
+// 8 rows, so its Bayer row is just b & 3.
+constexpr int DITHER_OFFSETS = DITHER_DEPTH + 7;
 
-            // Case 3: this page straddles the surface or dither zone.
-            // Build the byte bit by bit.
-            uint8_t columnByte = 0;
-
-            for (int bit = 0; bit < 8; bit++)
-            {
-                int y = pageTopY + bit;
-
-                // Above the surface — pixel stays off
-                if (y < surfaceY) continue;
-
-                int depth = y - surfaceY;
-
-                if (depth >= DITHER_DEPTH)
-                {
-                    // Past dither zone — this bit and all below are solid.
-                    // Fill remaining bits in one go with a bitmask.
-                    //
-                    // (0xFF << bit) sets all bits from 'bit' upward.
-                    // e.g. if bit=3: 0xFF << 3 = 0b11111000
-                    //
-                    // In Python: column_byte |= (0xFF << bit) & 0xFF
-                    columnByte |= (0xFF << bit);
-                    break;  // No need to check remaining bits
-                }
+struct DitherTable { uint8_t v[4][DITHER_OFFSETS]; };
 
-                // In the dither zone — check against Bayer threshold
+static constexpr DitherTable make_dither()
+{
+    DitherTable t = {};
+    for (int col = 0; col < 4; col++) {
+        for (int off = -7; off < DITHER_DEPTH; off++) {
+            uint8_t byte = 0;
+            for (int bit = 0; bit < 8; bit++) {
+                int depth = off + bit;
+                if (depth < 0) continue;                          // Above the surface
                 int brightness = (depth + 1) * 15 / DITHER_DEPTH;
-                if (brightness > BAYER4[y & 3][x & 3])
-                {
-                    columnByte |= (1 << bit);
+                if (depth >= DITHER_DEPTH || brightness > BAYER4[bit & 3][col]) {
+                    byte |= (uint8_t)(1 << bit);
                 }
             }
+            t.v[col][off + 7] = byte;
+        }
+    }
+    return t;
+}
+
+static constexpr DitherTable DITHER = make_dither();
+
+// ── Edge damping envelope ────────────────────────────────────────────
+// Taper amplitude near the "container walls" so waves don't just 
+// scroll off the edges: min(distance to the nearer wall / 20, 1), in 
+// Q8. The fine ripple gets twice the envelope (capped), so choppy 
+// turbulence can splash right up to the edges, which looks natural.
+struct EnvelopeTable { uint16_t broad[128]; uint16_t ripple[128]; };
 
-            buf[page * 128 + x] = columnByte;
+static constexpr EnvelopeTable make_envelope()
+{
+    EnvelopeTable t = {};
+    for (int x = 0; x < 128; x++) {
+        int dist = x < 127 - x ? x : 127 - x;
+        int e = dist * 256 / 20;
+        t.broad[x]  = (uint16_t)(e < 256 ? e : 256);
+        t.ripple[x] = (uint16_t)(2 * e < 256 ? 2 * e : 256);
+    }
+    return t;
+}
+
+static constexpr EnvelopeTable ENVELOPE = make_envelope();
+
+// Display water effect in demo mode. Writes straight into U8g2's 
+// full-frame buffer.
+void display_demo_water(float gsr)
+{
+    // ── Standing wave components ───────────────────────────────────
+    // Each of the slow layers is sin(spatial) * cos(temporal) — the 
+    // shape stays in place while the height oscillates, at different 
+    // temporal rates so they don't all peak together:
+    //
+    //   Layer 1: broad, slow swell — the main "slosh", always there, 
+    //            like the fundamental mode of a bathtub
+    //   Layer 2: medium standing wave, offset so its nodes don't line 
+    //            up with layer 1's — adds complexity as GSR rises
+    //   Layer 3: fast ripple — turbulence at high GSR. A TRAVELLING 
+    //            wave, sin(kx + wt), so the surface drifts a little 
+    //            instead of looking frozen
+    //
+    // The phase used to be a float advanced by 0.15 radians a frame; 
+    // each layer now keeps its own angle, advanced by its share.
+    static uint16_t phase1 = 0, phase2 = 0, phase3 = 0;
+    phase1 += bam(0.15 * 0.8);
+    phase2 += bam(0.15 * 1.4);
+    phase3 += bam(0.15 * 2.5);
+
+    constexpr uint16_t K1 = bam(0.05);      // Spatial steps per column
+    constexpr uint16_t K2 = bam(0.11);
+    constexpr uint16_t K3 = bam(0.25);
+
+    // Per-frame amplitudes in Q8 pixels, with layer 1 and 2's cosine 
+    // folded in — the only float maths left, once a frame
+    int32_t g = (int32_t)(constrain(gsr, 0.0f, 1.0f) * 256.0f);
+    int32_t amp1 = ((512 + g * 6) * cos_q14(phase1)) >> 14;
+    int32_t amp2 = ((g * 5) * cos_q14(phase2)) >> 14;
+    int32_t amp3 = max<int32_t>(0, g - 102) * 4;
+    int32_t baseY = 52 * 256 - g * 35;
+
+    uint8_t* buf = oleddisplay.getBufferPtr();
+
+    uint16_t a1 = 0, a2 = 0, a3 = phase3;
+    for (int x = 0; x < 128; x++, a1 += K1, a2 += K2, a3 += K3)
+    {
+        // Q8 pixels × Q14 sine × Q8 envelope → Q8 pixels
+        int32_t broad  = (amp1 * sin_q14(a1) + amp2 * sin_q14(a2)) >> 14;
+        int32_t ripple = (amp3 * sin_q14(a3)) >> 14;
+        int32_t surface = (broad * ENVELOPE.broad[x] + ripple * ENVELOPE.ripple[x]) >> 8;
+
+        int surfaceY = constrain((baseY + surface) >> 8, 0, 63);
+        const uint8_t* dither = DITHER.v[x & 3];
+
+        for (int page = 0; page < OLED_PAGES; page++)
+        {
+            int off = page * 8 - surfaceY;
+            uint8_t byte;
+            if (off < -7)                 byte = 0x00;    // Above the waterline
+            else if (off >= DITHER_DEPTH) byte = 0xFF;    // Deep water
+            else                          byte = dither[off + 7];
+            buf[page * 128 + x] = byte;
         }
     }
 
-    oleddisplay.sendBuffer();
+    display_commit();
 }
\ No newline at end of file
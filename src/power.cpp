@@ -0,0 +1,106 @@
+// power.cpp — WFI idle and CPU clock switching
+//
+// ═══════════════════════════════════════════════════════════════════════
+// WHY WFI IS SAFE HERE
+// ═══════════════════════════════════════════════════════════════════════
+//
+// The i.MX RT's clock controller decides what WFI actually does. In
+// its RUN setting (CCM_CLPCR.LPM = 0, the core's default) WFI only
+// stops the core until the next interrupt — every peripheral clock,
+// PLL and DMA channel carries on. So the ADCs keep sampling, the edge
+// guard keeps watching and the motor engine keeps stepping while the
+// core sleeps; they were always interrupt-driven. We set the RUN
+// setting explicitly rather than trusting whoever ran before us.
+//
+// Interrupts are masked around the WFI. A masked interrupt still wakes
+// the core, but can't run until they're unmasked again — so there's no
+// window where the wake timer fires after we've checked it and before
+// we sleep, leaving us asleep with nothing left to wake us.
+//
+// ── Clock ─────────────────────────────────────────────────────────────
+// set_arm_clock() also re-picks the peripheral bus (IPG) divider, and
+// the PWM, the LED ring's timing and the ADCs are all clocked from
+// that bus. A multiple of 150MHz keeps IPG at 150MHz, so nothing but
+// the core changes speed. micros() scales by F_CPU_ACTUAL, and the
+// profiler converts each count to full-speed cycles as it records it
+// (profiler.cpp), so both follow the change.
+
+#include "power.h"
+#include "config.h"
+
+constexpr int32_t MIN_SLEEP_US = 50;     // Shorter gaps: just go round again
+constexpr int32_t WAKE_EARLY_US = 10;    // Be awake when the task comes due
+
+static_assert(POWER_IDLE_CPU_HZ == 0 ||
+              (POWER_IDLE_CPU_HZ % 150000000 == 0 && POWER_IDLE_CPU_HZ <= F_CPU),
+              "POWER_IDLE_CPU_HZ must be a multiple of 150MHz (keeps the IPG bus at 150MHz)");
+
+static IntervalTimer wakeTimer;
+static volatile bool wakeFired = false;
+static bool lowClock = false;
+#if defined(__IMXRT1062__)
+static bool runModeSet = false;
+#endif
+
+static uint32_t windowStartUs = 0;
+static uint32_t windowSleptUs = 0;
+
+static void wake_isr()
+{
+    wakeTimer.end();           // One-shot
+    wakeFired = true;
+}
+
+void power_idle(int32_t us)
+{
+    if (!POWER_SLEEP_ENABLED || us < MIN_SLEEP_US) return;
+
+#if defined(__IMXRT1062__)
+    if (!runModeSet) {
+        CCM_CLPCR &= ~CCM_CLPCR_LPM(3);    // WFI = core sleep only
+        runModeSet = true;
+    }
+#endif
+
+    wakeFired = false;
+    wakeTimer.begin(wake_isr, (float)(us - WAKE_EARLY_US));
+
+    uint32_t start = micros();
+    __disable_irq();
+    if (!wakeFired) {
+#if defined(__IMXRT1062__)
+        asm volatile("dsb\n\twfi" ::: "memory");
+#endif
+    }
+    __enable_irq();
+    windowSleptUs += micros() - start;
+
+    // Woken early by something else — don't leave the timer to fire
+    // into the next pass
+    if (!wakeFired) wakeTimer.end();
+}
+
+void power_set_low_clock(bool low)
+{
+    if (POWER_IDLE_CPU_HZ == 0) return;
+    if (low == lowClock) return;
+
+    lowClock = low;
+    set_arm_clock(low ? POWER_IDLE_CPU_HZ : F_CPU);
+}
+
+uint8_t power_sleep_percent()
+{
+    uint32_t now = micros();
+    uint32_t window = now - windowStartUs;
+    uint8_t pct = window ? (uint8_t)min<uint64_t>((uint64_t)windowSleptUs * 100 / window, 100) : 0;
+
+    windowStartUs = now;
+    windowSleptUs = 0;
+    return pct;
+}
+
+uint32_t power_cpu_mhz()
+{
+    return F_CPU_ACTUAL / 1000000;
+}
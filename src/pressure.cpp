@@ -1,41 +1,86 @@
-// pressure.cpp — Pressure reading and running average
+// pressure.cpp — Pressure reading and baseline
 
 #include "pressure.h"
 #include "config.h"
 #include "globals.h"
-#include "RunningAverage.h"
+#include "pressure_sampler.h"
+#include "sim_session.h"
+#include "edge_guard.h"
 
-// The RunningAverage object lives here since this module "owns" 
-// pressure averaging. No other file needs direct access to it.
-// In Python terms, this is a module-private variable — like 
-// prefixing with underscore: _ra_pressure
-static RunningAverage raPressure(RA_FREQUENCY * RA_HIST_SECONDS);
+// The baseline used to be a RunningAverage object living here, fed at
+// 6Hz from the main loop. It now lives next to the ADC interrupt
+// (see pressure_sampler.cpp) and is updated for every sample, so all
+// this module does is copy the latest values into the globals.
 
-// Called from setup() to initialize the running average buffer
+// Called from setup() to start sampling
 void pressure_init()
 {
-    raPressure.clear();
+    pressure_sampler_init();
 }
 
+// Oversampling used to happen here with analogRead() + delay(1), 
+// blocking the loop for ~4ms. The ADC now averages in hardware and 
+// the sampler ISR decimates, so this is just a read of the latest value.
 int read_pressure_raw()
 {
-    int p = 0;
-    for (uint8_t i = OVERSAMPLE; i; --i) {
-        p += analogRead(BUTTPIN);
-        if (i) delay(1);
-    }
-    return p / OVERSAMPLE;  // Average instead of sum
+    return pressure_sampler_latest();
+}
+
+// ── Sources ────────────────────────────────────────────────────────────
+
+static bool live_read_tick(int& p, int& baseline)
+{
+    // Baseline is already up to date — the ISR folds in every sample
+    p = read_pressure_raw();
+    baseline = pressure_sampler_baseline();
+    return true;
 }
 
-void update_pressure(int sampleTick)
+// The simulation only produces one value per tick (call sim_tick() 
+// first), so the guard gets one sample per tick too.
+static bool sim_read_tick(int& p, int& baseline)
+{
+    p = sim_pressure;
+    baseline = sim_avg_pressure;
+    edge_guard_feed((uint16_t)p, (uint16_t)baseline);
+    return true;
+}
+
+const PressureSource PRESSURE_SOURCE_LIVE = { "live", live_read_tick };
+const PressureSource PRESSURE_SOURCE_SIM  = { "sim",  sim_read_tick  };
+
+static const PressureSource* currentSource = &PRESSURE_SOURCE_LIVE;
+
+void pressure_set_source(const PressureSource* source)
 {
-    // Read fresh pressure value into the global
-    pressure = read_pressure_raw();
-
-    // Update running average at a slower rate than the main loop.
-    // At 60Hz main loop and RA_TICK_PERIOD of 10, this runs at 6Hz.
-    if (sampleTick % RA_TICK_PERIOD == 0) {
-        raPressure.addValue(pressure);
-        averagePressure = raPressure.getAverage();
+    const PressureSource* next = source ? source : &PRESSURE_SOURCE_LIVE;
+    if (next == currentSource) return;
+
+    // A different signal has different noise. The live statistics are
+    // set aside for the length of a replay and picked up again after,
+    // and the sampler ISR is kept off the guard while they're swapped.
+    // The simulation feeds one sample per tick, the others one per ms.
+    pressure_sampler_feed_guard(false);
+    if (next == &PRESSURE_SOURCE_LIVE) {
+        edge_guard_restore_noise();
+    } else {
+        edge_guard_stash_noise(next == &PRESSURE_SOURCE_SIM ? FREQUENCY : PRESSURE_SAMPLE_HZ);
     }
-}
\ No newline at end of file
+    currentSource = next;
+    pressure_sampler_feed_guard(currentSource == &PRESSURE_SOURCE_LIVE);
+}
+
+const PressureSource* pressure_source()
+{
+    return currentSource;
+}
+
+bool update_pressure()
+{
+    int p, baseline;
+    if (!currentSource->read_tick(p, baseline)) return false;
+
+    pressure = p;
+    averagePressure = baseline;
+    return true;
+}
@@ -0,0 +1,162 @@
+// pressure_sampler.cpp — Timer-triggered ADC with interrupt decimation
+//
+// ═══════════════════════════════════════════════════════════════════════
+// SIGNAL CHAIN
+// ═══════════════════════════════════════════════════════════════════════
+//
+//   timer (2kHz) ──→ ADC conversion ──→ hardware average (×4)
+//                                            │
+//                    conversion-complete ISR ◄┘
+//                            │
+//                  decimate ×2 (box-car sum)
+//                            │
+//              ┌─────────────┼──────────────┐
+//              ▼             ▼              ▼
+//         edge guard   BaselineFilter   SampleRing (1kHz)
+//              ▲             │              │
+//              └─ baseline ──┤              ▼
+//                            ▼         update_pressure(), etc.
+//                     averagePressure
+//
+// We use the ADC library bundled with Teensyduino (pedvide/ADC). It
+// lets the ADC be triggered by a hardware timer instead of software,
+// so sample timing is set by a crystal-derived clock — it no longer
+// depends on how long the displays took to draw this frame.
+//
+// WHY AN INTERRUPT RATHER THAN DMA?
+// DMA would only batch the samples up and hand them over every N
+// conversions. At 2kHz the conversion-complete interrupt costs about
+// a microsecond, and handling each sample as it arrives gives the
+// edge guard (edge_guard.h) a per-sample hook with no batching
+// delay. The ring buffer gives the main loop the same "grab everything
+// since last time" view that a DMA buffer would.
+//
+// NOTE: the ADC library's adc0 is the same hardware the core's
+// analogRead() uses. Once the timer is running, nothing else may call
+// analogRead() on it — use read_pressure_raw() instead.
+
+#include "pressure_sampler.h"
+#include "config.h"
+#include "sample_ring.h"
+#include "edge_guard.h"
+#include "baseline_filter.h"
+#include <ADC.h>
+
+// ── ADC driver object ────────────────────────────────────────────────
+// Only adc0 is ours; adc1 belongs to the sensor channels.
+static ADC adc;
+
+// NVIC priority of the conversion interrupt (0 = highest, 255 = lowest).
+// The edge guard runs inside it, so it sits above the display DMA and 
+// USB interrupts — a busy bus must never delay a motor cut.
+constexpr uint8_t ADC_IRQ_PRIORITY = 16;
+
+// ── Decimated sample stream ──────────────────────────────────────────
+// 256 samples = 256ms of history at 1kHz. Plenty for a reader that
+// drains once per 60Hz tick (~17 samples per tick).
+static SampleRing<PressureSample, 256> sampleRing;
+
+// ── Baseline (averagePressure) ───────────────────────────────────────
+// Updated in the ISR for every decimated sample, so the edge guard and
+// the mode code both compare against a baseline that is at most 1ms
+// old instead of up to 166ms.
+static BaselineFilter baseline(BASELINE_MODE,
+                               (uint32_t)PRESSURE_SAMPLE_HZ * BASELINE_WINDOW_SECONDS,
+                               BASELINE_MEDIAN_N);
+
+static volatile bool feedGuard = true;
+
+// ── Decimator state (ISR-private) ────────────────────────────────────
+static uint32_t decimSum = 0;
+static uint8_t  decimCount = 0;
+
+
+// ═══════════════════════════════════════════════════════════════════════
+// Conversion-complete interrupt
+// ═══════════════════════════════════════════════════════════════════════
+//
+// Runs ADC_SAMPLE_RATE_HZ times per second. Keep it tiny — no Serial,
+// no floats, no allocation. readSingle() also clears the ADC's
+// "conversion complete" flag so the interrupt doesn't re-fire.
+
+static void adc0_isr()
+{
+    decimSum += (uint16_t)adc.adc0->readSingle();
+
+    if (++decimCount >= ADC_DECIMATION) {
+        uint16_t sample = (uint16_t)(decimSum / ADC_DECIMATION);
+        decimSum = 0;
+        decimCount = 0;
+
+        // Edge detection runs here, per sample, not once per frame.
+        // Compare against the baseline BEFORE folding this sample in,
+        // so a spike can't pull its own reference point up.
+        uint16_t reference = baseline.value();
+        if (feedGuard) edge_guard_feed(sample, reference);
+        baseline.update(sample);
+
+        sampleRing.push({ sample, reference });
+    }
+
+    // Make sure the flag clear reaches the ADC before we return, or
+    // the NVIC can see the stale flag and call us again.
+#if defined(__IMXRT1062__)
+    asm("DSB");
+#endif
+}
+
+
+// ═══════════════════════════════════════════════════════════════════════
+// Public interface
+// ═══════════════════════════════════════════════════════════════════════
+
+void pressure_sampler_init()
+{
+    pinMode(BUTTPIN, INPUT);
+
+    adc.adc0->setResolution(12);
+    adc.adc0->setAveraging(OVERSAMPLE);  // Done in hardware, free for the CPU
+    adc.adc0->setConversionSpeed(ADC_CONVERSION_SPEED::MED_SPEED);
+    adc.adc0->setSamplingSpeed(ADC_SAMPLING_SPEED::MED_SPEED);
+
+    decimSum = 0;
+    decimCount = 0;
+    sampleRing.clear();
+    baseline.reset();   // First sample seeds it — no ramp up from zero
+
+    // Select the pin once, then let the timer re-trigger it forever.
+    adc.adc0->stopTimer();
+    adc.adc0->startSingleRead(BUTTPIN);
+    adc.adc0->enableInterrupts(adc0_isr, ADC_IRQ_PRIORITY);
+    adc.adc0->startTimer(ADC_SAMPLE_RATE_HZ);
+}
+
+uint16_t pressure_sampler_latest()
+{
+    return sampleRing.latest().raw;
+}
+
+uint16_t pressure_sampler_baseline()
+{
+    return baseline.value();
+}
+
+uint32_t pressure_sampler_count()
+{
+    return sampleRing.count();
+}
+
+uint16_t pressure_sampler_read(uint32_t& cursor, PressureSample* out, uint16_t maxCount)
+{
+    return sampleRing.read(cursor, out, maxCount);
+}
+
+ADC& adc_driver()
+{
+    return adc;
+}
+
+void pressure_sampler_feed_guard(bool enable)
+{
+    feedGuard = enable;
+}
@@ -0,0 +1,191 @@
+// profiler.cpp — DWT cycle statistics
+//
+// ═══════════════════════════════════════════════════════════════════════
+// PERCENTILES WITHOUT STORING EVERY SAMPLE
+// ═══════════════════════════════════════════════════════════════════════
+//
+// An exact p99 needs every sample sorted — far too much memory for a 
+// counter that fires thousands of times a second. Instead each sample 
+// goes into a log-scale histogram bucket: 4 buckets per power of two.
+//
+//   cycles   1  2  3 | 4 5 6 7 | 8 10 12 14 | 16 20 24 28 | 32 ...
+//   bucket   1  2  3 | 4 5 6 7 | 8  9 10 11 | 12 13 14 15 | 16 ...
+//
+// So any reading is known to within 25%, which is plenty to tell a 
+// 40us module from a 400us one. p99 is found by walking the buckets 
+// until 99% of the samples are behind us, and we report that bucket's 
+// upper edge (the pessimistic answer).
+//
+// 124 buckets × 4 bytes × 8 sections ≈ 4KB of RAM. When the profiler 
+// is disabled the arrays shrink to a single entry.
+
+#include "profiler.h"
+
+constexpr uint8_t HIST_BUCKETS = 124;
+
+// Shrink the tables to nothing when the profiler is compiled out
+constexpr uint8_t STAT_SLOTS = PROFILER_ENABLED ? PROF_SECTION_COUNT : 1;
+
+struct SectionStats {
+    uint32_t count;
+    uint32_t minCycles;
+    uint32_t maxCycles;
+    uint64_t sumCycles;
+    uint32_t hist[HIST_BUCKETS];
+};
+
+static SectionStats stats[STAT_SLOTS];
+
+static const char* const SECTION_NAMES[PROF_SECTION_COUNT] = {
+    "update_pressure",
+    "run_state_machine",
+    "leds_show",
+    "matrix.scrollText",
+    "display_update",
+    "alphanum_running",
+    "fire_tick",
+    "report_serial",
+};
+
+// ── Clock changes ────────────────────────────────────────────────────
+// The counter ticks at the CPU clock, and power.cpp drops that to 
+// POWER_IDLE_CPU_HZ on the menu and in STANDBY. So every count is 
+// scaled to F_CPU cycles as it's recorded ("reference cycles"), and 
+// the tables hold one unit of time whatever the clock was at the time. 
+// At full speed the scaling is a compare and nothing else.
+//
+// A frame gap that straddles a clock change can't be scaled either 
+// way, so that one gap is skipped.
+
+static uint32_t lastFrameCycles = 0;
+static uint32_t lastFrameHz = 0;
+static bool     haveLastFrame = false;
+static uint32_t frameCount = 0;
+static uint32_t frameOverruns = 0;
+static uint32_t worstFrameCycles = 0;
+
+
+// ═══════════════════════════════════════════════════════════════════════
+// Histogram helpers
+// ═══════════════════════════════════════════════════════════════════════
+
+static uint8_t bucket_for(uint32_t cycles)
+{
+    if (cycles < 4) return (uint8_t)cycles;
+    uint8_t msb = 31 - __builtin_clz(cycles);      // 2..31
+    uint8_t sub = (cycles >> (msb - 2)) & 3;       // next two bits
+    return (uint8_t)((msb - 1) * 4 + sub);
+}
+
+// Largest cycle count that still lands in `bucket`.
+static uint32_t bucket_upper(uint8_t bucket)
+{
+    if (bucket < 4) return bucket;
+    uint8_t msb = bucket / 4 + 1;
+    uint32_t sub = bucket % 4;
+    uint64_t lower = (uint64_t)(4 + sub) << (msb - 2);
+    uint64_t width = (uint64_t)1 << (msb - 2);
+    return (uint32_t)(lower + width - 1);
+}
+
+static uint32_t percentile_cycles(const SectionStats& s, uint8_t pct)
+{
+    if (s.count == 0) return 0;
+    uint32_t target = (uint32_t)(((uint64_t)s.count * pct + 99) / 100);
+    uint32_t seen = 0;
+    for (uint8_t b = 0; b < HIST_BUCKETS; b++) {
+        seen += s.hist[b];
+        if (seen >= target) return min(bucket_upper(b), s.maxCycles);
+    }
+    return s.maxCycles;
+}
+
+// Cycles at the current clock → reference cycles (F_CPU)
+static inline uint32_t to_ref_cycles(uint32_t cycles, uint32_t hz)
+{
+    if (hz == F_CPU) return cycles;
+    uint64_t ref = (uint64_t)cycles * F_CPU / hz;
+    return ref > 0xFFFFFFFFull ? 0xFFFFFFFFul : (uint32_t)ref;
+}
+
+static float cycles_to_us(uint32_t refCycles)
+{
+    return (float)refCycles / (F_CPU / 1000000.0f);
+}
+
+
+// ═══════════════════════════════════════════════════════════════════════
+// Public interface
+// ═══════════════════════════════════════════════════════════════════════
+
+void profiler_init()
+{
+    if constexpr (!PROFILER_ENABLED) return;
+
+    ARM_DEMCR |= ARM_DEMCR_TRCENA;
+    ARM_DWT_CTRL |= ARM_DWT_CTRL_CYCCNTENA;
+    profiler_reset();
+}
+
+void profiler_record(ProfileSection section, uint32_t cycles)
+{
+    if constexpr (!PROFILER_ENABLED) return;
+    if (section >= PROF_SECTION_COUNT) return;
+
+    cycles = to_ref_cycles(cycles, F_CPU_ACTUAL);
+
+    SectionStats& s = stats[section];
+    if (s.count == 0 || cycles < s.minCycles) s.minCycles = cycles;
+    if (cycles > s.maxCycles) s.maxCycles = cycles;
+    s.sumCycles += cycles;
+    s.count++;
+    s.hist[bucket_for(cycles)]++;
+}
+
+void profiler_frame_mark()
+{
+    if constexpr (!PROFILER_ENABLED) return;
+
+    uint32_t now = ARM_DWT_CYCCNT;
+    uint32_t hz = F_CPU_ACTUAL;
+    if (haveLastFrame && hz == lastFrameHz) {
+        constexpr uint32_t frameCycles = (uint32_t)((uint64_t)F_CPU * UPDATE_PERIOD_US / 1000000);
+        uint32_t gap = to_ref_cycles(now - lastFrameCycles, hz);
+        frameCount++;
+        if (gap > worstFrameCycles) worstFrameCycles = gap;
+        if (gap > frameCycles + frameCycles / 10) frameOverruns++;
+    }
+    lastFrameCycles = now;
+    lastFrameHz = hz;
+    haveLastFrame = true;
+}
+
+void profiler_reset()
+{
+    memset(stats, 0, sizeof(stats));
+    haveLastFrame = false;
+    frameCount = 0;
+    frameOverruns = 0;
+    worstFrameCycles = 0;
+}
+
+void profiler_report(Print& out)
+{
+    if constexpr (!PROFILER_ENABLED) {
+        out.println("[PROF] disabled (PROFILER_ENABLED in config.h)");
+        return;
+    }
+
+    out.println("[PROF] section              calls     min_us    avg_us    max_us    p99_us");
+    for (uint8_t i = 0; i < PROF_SECTION_COUNT; i++) {
+        const SectionStats& s = stats[i];
+        uint32_t avg = s.count ? (uint32_t)(s.sumCycles / s.count) : 0;
+        out.printf("[PROF] %-18s %8lu %10.1f %9.1f %9.1f %9.1f\n",
+                   SECTION_NAMES[i], (unsigned long)s.count,
+                   cycles_to_us(s.minCycles), cycles_to_us(avg),
+                   cycles_to_us(s.maxCycles), cycles_to_us(percentile_cycles(s, 99)));
+    }
+    out.printf("[PROF] frames %lu, overruns %lu, worst frame %.1f us (budget %lu us)\n",
+               (unsigned long)frameCount, (unsigned long)frameOverruns,
+               cycles_to_us(worstFrameCycles), (unsigned long)UPDATE_PERIOD_US);
+}
@@ -0,0 +1,156 @@
+// scheduler.cpp — Cooperative task scheduler
+//
+// ═══════════════════════════════════════════════════════════════════════
+// ONE PASS OF scheduler_run()
+// ═══════════════════════════════════════════════════════════════════════
+//
+//   now ──┬── control tasks due? ──→ run them all
+//         │
+//         ├── deadline = earliest nextDue of any control task
+//         │
+//         └── for each due render task (registration order):
+//                 budget fits before deadline?  ──→ run
+//                 waited a whole extra period
+//                 AND control just ran?         ──→ run (late)
+//                 otherwise                     ──→ defer
+//
+// All times are micros() and compared with unsigned subtraction, so
+// the ~71 minute wrap-around of micros() is harmless. (Same trick as
+// the "millis() - lastTick" checks elsewhere in the code.)
+
+#include "scheduler.h"
+
+static SchedulerTask tasks[SCHEDULER_MAX_TASKS];
+static uint8_t taskCount = 0;
+
+// Signed time from `now` until `t`. Negative = t is in the past.
+static inline int32_t us_until(uint32_t t, uint32_t now)
+{
+    return (int32_t)(t - now);
+}
+
+// Time from `now` until the next control task is due
+static int32_t control_slack(uint32_t now)
+{
+    int32_t slack = INT32_MAX;
+    for (uint8_t i = 0; i < taskCount; i++) {
+        const SchedulerTask& t = tasks[i];
+        if (t.taskClass != TASK_CONTROL) continue;
+        int32_t s = us_until(t.nextDueUs, now);
+        if (s < slack) slack = s;
+    }
+    return slack;
+}
+
+static void run_task(SchedulerTask& t)
+{
+    uint32_t start = micros();
+    t.fn();
+    uint32_t elapsed = micros() - start;
+
+    t.runs++;
+    t.deferred = false;
+    t.lastUs = elapsed;
+    if (elapsed > t.maxUs) t.maxUs = elapsed;
+    if (elapsed > t.budgetUs) t.overruns++;
+
+    // Fixed-rate: next due one period after the LAST due time, not
+    // after now, so the rate doesn't drift by however late we were.
+    t.nextDueUs += t.periodUs;
+
+    // Fell a whole period (or more) behind — drop the missed periods
+    // rather than running back-to-back to catch up.
+    uint32_t now = micros();
+    if (us_until(t.nextDueUs, now) < 0) {
+        uint32_t behind = now - t.nextDueUs;
+        t.skips += behind / t.periodUs + 1;
+        t.nextDueUs = now + t.periodUs - (behind % t.periodUs);
+    }
+}
+
+int8_t scheduler_add(const char* name, TaskFn fn, uint32_t periodUs,
+                     uint32_t budgetUs, TaskClass taskClass)
+{
+    if (taskCount >= SCHEDULER_MAX_TASKS || fn == nullptr || periodUs == 0) return -1;
+
+    SchedulerTask& t = tasks[taskCount];
+    t = {};
+    t.name = name;
+    t.fn = fn;
+    t.periodUs = periodUs;
+    t.budgetUs = budgetUs;
+    t.taskClass = taskClass;
+    t.nextDueUs = micros();    // Due straight away
+
+    return (int8_t)taskCount++;
+}
+
+void scheduler_run()
+{
+    uint32_t now = micros();
+
+    // ── Control first ─────────────────────────────────────────────────
+    bool ranControl = false;
+    for (uint8_t i = 0; i < taskCount; i++) {
+        SchedulerTask& t = tasks[i];
+        if (t.taskClass != TASK_CONTROL) continue;
+        if (us_until(t.nextDueUs, now) > 0) continue;
+        run_task(t);
+        ranControl = true;
+    }
+
+    // ── Deadline: when does the next control task want the CPU? ──────
+    int32_t slack = control_slack(micros());
+
+    // ── Render tasks, in priority order, while budget allows ─────────
+    for (uint8_t i = 0; i < taskCount; i++) {
+        SchedulerTask& t = tasks[i];
+        if (t.taskClass != TASK_RENDER) continue;
+
+        now = micros();
+        int32_t dueIn = us_until(t.nextDueUs, now);
+        if (dueIn > 0) continue;
+
+        bool fits = slack >= 0 && (int32_t)t.budgetUs <= slack;
+        bool starving = (uint32_t)(-dueIn) >= t.periodUs;
+
+        if (fits || (starving && ranControl)) {
+            uint32_t start = micros();
+            run_task(t);
+            slack -= (int32_t)(micros() - start);
+        } else if (!t.deferred) {
+            // Count once per period, not once per loop() pass
+            t.deferrals++;
+            t.deferred = true;
+        }
+    }
+}
+
+int32_t scheduler_slack_us()
+{
+    return control_slack(micros());
+}
+
+int32_t scheduler_idle_us()
+{
+    uint32_t now = micros();
+    int32_t idle = INT32_MAX;
+    for (uint8_t i = 0; i < taskCount; i++) {
+        const SchedulerTask& t = tasks[i];
+        int32_t dueIn = us_until(t.nextDueUs, now);
+        if (dueIn <= 0 && t.deferred) continue;
+        if (dueIn < idle) idle = dueIn;
+    }
+    return idle > 0 ? idle : 0;
+}
+
+uint8_t scheduler_task_count()
+{
+    return taskCount;
+}
+
+const SchedulerTask* scheduler_task(uint8_t index)
+{
+    if (index >= taskCount) return nullptr;
+    return &tasks[index];
+}
@@ -0,0 +1,218 @@
+// sensor_channels.cpp — Timer-driven sampling of the body sensors
+//
+// ═══════════════════════════════════════════════════════════════════════
+// HOW A TICK RUNS
+// ═══════════════════════════════════════════════════════════════════════
+//
+//   IntervalTimer (500Hz) ──→ which channels are due this tick?
+//            │                      (tick % divider == 0)
+//            ▼
+//   start conversion of the first due channel on adc1
+//            │
+//   conversion-complete ISR ──→ push to that channel's ring
+//            │                  (ECG: and the beat detector, heartbeat.h)
+//            │                  start the next due channel, if any
+//            ▼
+//          idle until the next tick
+//
+// So the conversions are chained from one interrupt to the next and
+// nothing ever waits on the ADC. Both interrupts run at the same NVIC
+// priority, so neither can preempt the other halfway through — the
+// "which channel are we on" state needs no locking.
+//
+// If a tick arrives while the previous chain is still converting
+// (ADC stuck, or an interrupt storm above us), the unfinished channels
+// repeat their last value instead of dropping the sample, so sample
+// numbers stay tied to time (see sensor_time_us()).
+
+#include "sensor_channels.h"
+#include "pressure_sampler.h"
+#include "sample_ring.h"
+#include "heartbeat.h"
+#include <ADC.h>
+
+static const SensorChannel CHANNELS[SENSOR_COUNT] = {
+    { "ecg", ECG_PIN, ECG_SAMPLE_HZ },
+    { "gsr", GSR_PIN, GSR_SAMPLE_HZ },
+};
+
+static_assert(SENSOR_TICK_HZ % ECG_SAMPLE_HZ == 0, "ECG rate must divide SENSOR_TICK_HZ");
+static_assert(SENSOR_TICK_HZ % GSR_SAMPLE_HZ == 0, "GSR rate must divide SENSOR_TICK_HZ");
+static_assert(SENSOR_COUNT <= 8, "Due channels are tracked in a uint8_t mask");
+
+// Below the pressure ADC (16), which runs the edge guard, and above
+// the display DMA and the I2C bus (144). The timer shares the PIT 
+// interrupt with the motor engine's (motor.cpp), which uses the same 
+// priority.
+constexpr uint8_t SENSOR_IRQ_PRIORITY = 64;
+
+static SampleRing<uint16_t, SENSOR_RING_LEN> rings[SENSOR_COUNT];
+static IntervalTimer sensorTimer;
+static uint32_t startUs = 0;
+
+// ── ISR-private state ────────────────────────────────────────────────
+static uint32_t tickCount = 0;
+static uint8_t  pendingMask = 0;    // Due this tick, not yet converted
+static int8_t   converting = -1;    // Channel on the ADC right now
+static uint16_t lastValue[SENSOR_COUNT];
+static volatile uint32_t overrunCount = 0;
+
+static inline uint16_t divider(uint8_t ch)
+{
+    return SENSOR_TICK_HZ / CHANNELS[ch].rateHz;
+}
+
+// Every sample a channel produces, measured or held, goes through here
+static inline void deliver(uint8_t ch, uint16_t v)
+{
+    rings[ch].push(v);
+    if (ch == SENSOR_ECG) heartbeat_feed(v);   // R-peak detection, per sample
+}
+
+static void start_next_conversion()
+{
+    converting = -1;
+    for (uint8_t ch = 0; ch < SENSOR_COUNT; ch++) {
+        if (!(pendingMask & (1u << ch))) continue;
+        converting = (int8_t)ch;
+        adc_driver().adc1->startSingleRead(CHANNELS[ch].pin);
+        return;
+    }
+}
+
+static void sensor_tick_isr()
+{
+    // Last tick's chain didn't finish — hold those channels' values
+    if (pendingMask) {
+        for (uint8_t ch = 0; ch < SENSOR_COUNT; ch++) {
+            if (!(pendingMask & (1u << ch))) continue;
+            deliver(ch, lastValue[ch]);
+            overrunCount++;
+        }
+        pendingMask = 0;
+    }
+
+    for (uint8_t ch = 0; ch < SENSOR_COUNT; ch++) {
+        if (tickCount % divider(ch) == 0) pendingMask |= (uint8_t)(1u << ch);
+    }
+    tickCount++;
+
+    if (pendingMask) start_next_conversion();
+}
+
+static void adc1_isr()
+{
+    uint16_t v = (uint16_t)adc_driver().adc1->readSingle();
+
+    if (converting >= 0) {
+        uint8_t ch = (uint8_t)converting;
+        lastValue[ch] = v;
+        deliver(ch, v);
+        pendingMask &= (uint8_t)~(1u << ch);
+        start_next_conversion();
+    }
+
+#if defined(__IMXRT1062__)
+    asm("DSB");
+#endif
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// Public interface
+// ═══════════════════════════════════════════════════════════════════════
+
+void sensors_init()
+{
+    for (uint8_t ch = 0; ch < SENSOR_COUNT; ch++) {
+        pinMode(CHANNELS[ch].pin, INPUT);
+        rings[ch].clear();
+        lastValue[ch] = 0;
+    }
+    tickCount = 0;
+    pendingMask = 0;
+    converting = -1;
+    heartbeat_reset();
+
+    ADC_Module* adc1 = adc_driver().adc1;
+    adc1->setResolution(12);
+    adc1->setAveraging(OVERSAMPLE);
+    adc1->setConversionSpeed(ADC_CONVERSION_SPEED::MED_SPEED);
+    adc1->setSamplingSpeed(ADC_SAMPLING_SPEED::MED_SPEED);
+    adc1->enableInterrupts(adc1_isr, SENSOR_IRQ_PRIORITY);
+
+    sensorTimer.priority(SENSOR_IRQ_PRIORITY);
+    startUs = micros();
+    sensorTimer.begin(sensor_tick_isr, 1000000.0f / SENSOR_TICK_HZ);
+}
+
+const SensorChannel& sensor_channel(SensorId id)
+{
+    return CHANNELS[id];
+}
+
+uint16_t sensor_latest(SensorId id)
+{
+    return rings[id].latest();
+}
+
+uint32_t sensor_count(SensorId id)
+{
+    return rings[id].count();
+}
+
+uint16_t sensor_read(SensorId id, uint32_t& cursor, uint16_t* out, uint16_t maxCount)
+{
+    return rings[id].read(cursor, out, maxCount);
+}
+
+uint32_t sensor_time_us(SensorId id, uint32_t index)
+{
+    // Wraps with micros(), so differences between timestamps stay right
+    return startUs + index * (1000000UL / CHANNELS[id].rateHz);
+}
+
+SensorView sensor_view(SensorId id, uint16_t outHz)
+{
+    uint16_t rate = CHANNELS[id].rateHz;
+    uint16_t factor = (outHz == 0 || outHz >= rate) ? 1 : rate / outHz;
+
+    SensorView v;
+    v.id = id;
+    v.factor = factor;
+    v.cursor = rings[id].count() / factor * factor;
+    return v;
+}
+
+uint16_t sensor_view_read(SensorView& view, uint16_t* out, uint16_t maxCount)
+{
+    const SampleRing<uint16_t, SENSOR_RING_LEN>& ring = rings[view.id];
+    const uint16_t f = view.factor;
+    uint32_t head = ring.count();
+
+    // Fell out of the ring: skip to the first whole block still held
+    // (same slot of slack as SampleRing::read)
+    if (head - view.cursor > SENSOR_RING_LEN - 1) {
+        uint32_t oldest = head - (SENSOR_RING_LEN - 1);
+        view.cursor = (oldest + f - 1) / f * f;
+    }
+
+    uint16_t n = 0;
+    uint16_t chunk[32];
+    while (n < maxCount && head - view.cursor >= f) {
+        uint32_t sum = 0;
+        uint16_t got = 0;
+        while (got < f) {
+            uint16_t want = (uint16_t)min<uint16_t>(f - got, 32);
+            uint16_t k = ring.read(view.cursor, chunk, want);
+            for (uint16_t i = 0; i < k; i++) sum += chunk[i];
+            got += k;
+        }
+        out[n++] = (uint16_t)(sum / f);
+    }
+    return n;
+}
+
+uint32_t sensor_overruns()
+{
+    return overrunCount;
+}
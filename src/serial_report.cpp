@@ -2,6 +2,23 @@
 
 #include "serial_report.h"
 #include "globals.h"
+#include "profiler.h"
+#include "scheduler.h"
+#include "telemetry.h"
+#include "i2c_bus.h"
+#include "session_recorder.h"
+#include "settings.h"
+#include "frame_coordinator.h"
+#include "sensor_channels.h"
+#include "heartbeat.h"
+#include "power.h"
+#include "edge_guard.h"
+#include "memory_diag.h"
+#include "session_replay.h"
+
+// Text reports are off by default in debug mode so they don't bury the 
+// debug prints. Either way it can be changed from the console.
+static ReportMode reportMode = DEBUG_MODE ? REPORT_OFF : REPORT_TEXT;
 
 // These two functions have the same name but different parameter 
 // types. C++ calls this "function overloading" — the compiler 
@@ -20,9 +37,21 @@ void debug_print(const char* label, float value)
     Serial.println(value, 2);  // 2 decimal places
 }
 
-void report_serial()
+void serial_set_report_mode(ReportMode mode)
+{
+    if (mode == REPORT_BINARY && reportMode != REPORT_BINARY) {
+        telemetry_start();   // Begin from "now", not the ring's backlog
+    }
+    reportMode = mode;
+}
+
+ReportMode serial_report_mode()
+{
+    return reportMode;
+}
+
+static void report_text()
 {
-    if (DEBUG_MODE) return; // Only output when not in debug mode
     // Format: motor:NNN,pres:NNN,avg:NNN,delta:NNN,limit:NNN,cooldown:NNN
     Serial.print("motor:");  Serial.print(motorSpeed);
     Serial.print(",");
@@ -35,4 +64,113 @@ void report_serial()
     Serial.print("limit:");  Serial.print(pressureLimit);
     Serial.print(",");
     Serial.print("cooldown:"); Serial.println(minimumcooldown);
-}
\ No newline at end of file
+}
+
+void report_serial(uint8_t mode)
+{
+    switch (reportMode) {
+        case REPORT_TEXT:   report_text();           break;
+        case REPORT_BINARY: telemetry_stream(mode);  break;
+        default:                                     break;
+    }
+}
+
+// Scheduler view of the same frame: how often each task ran, waited 
+// or fell behind. Complements the profiler's per-call timings.
+static void report_scheduler()
+{
+    Serial.println("[SCHED] task        runs  deferred  skipped  overrun  last_us  max_us");
+    for (uint8_t i = 0; i < scheduler_task_count(); i++) {
+        const SchedulerTask* t = scheduler_task(i);
+        Serial.printf("[SCHED] %-9s %7lu %9lu %8lu %8lu %8lu %7lu\n",
+                      t->name, (unsigned long)t->runs, (unsigned long)t->deferrals,
+                      (unsigned long)t->skips, (unsigned long)t->overruns,
+                      (unsigned long)t->lastUs, (unsigned long)t->maxUs);
+    }
+}
+
+static void report_frames()
+{
+    Serial.println("[FRAME] display     frames    missed  forced  cost_us");
+    FrameStats f;
+    for (uint8_t i = 0; frames_stats(i, f); i++) {
+        Serial.printf("[FRAME] %-9s %8lu %9lu %7lu %8lu\n",
+                      f.name, (unsigned long)f.frames, (unsigned long)f.missed,
+                      (unsigned long)f.forced, (unsigned long)f.costUs);
+    }
+}
+
+static void report_sensors()
+{
+    for (uint8_t i = 0; i < SENSOR_COUNT; i++) {
+        SensorId id = (SensorId)i;
+        const SensorChannel& ch = sensor_channel(id);
+        Serial.printf("[Sensor] %s %uHz  samples %lu  latest %u\n",
+                      ch.name, (unsigned)ch.rateHz, (unsigned long)sensor_count(id),
+                      (unsigned)sensor_latest(id));
+    }
+    Serial.printf("[Sensor] overruns %lu\n", (unsigned long)sensor_overruns());
+    Serial.printf("[Heart] beats %lu  bpm %u%s\n",
+                  (unsigned long)heartbeat_count(), (unsigned)heartbeat_bpm(),
+                  heartbeat_locked() ? "  (locked)" : "");
+}
+
+static void report_noise()
+{
+    const NoiseFloor& noise = edge_guard_noise();
+    Serial.printf("[Noise] mean %.1f  dev %.1f  peak %.1f  limit %d%s\n",
+                  noise.mean(), noise.deviation(), noise.peak(), pressureLimit,
+                  noise.primed() ? "" : "  (settling)");
+}
+
+void serial_poll_commands()
+{
+    // Serial.available() is how many bytes are already buffered, so 
+    // this never waits. In Python: while sys.stdin has data: ...
+    while (Serial.available() > 0) {
+        int c = Serial.read();
+        switch (c) {
+            case 'p':
+                profiler_report(Serial);
+                report_scheduler();
+                report_frames();
+                Serial.printf("[I2C] completed %lu  failed %lu  free slots %u\n",
+                              (unsigned long)i2c_completed(), (unsigned long)i2c_failures(),
+                              (unsigned)i2c_free_slots());
+                Serial.printf("[Recorder] %s  written %lu  dropped %lu sectors\n",
+                              recorder_active() ? "on" : "off",
+                              (unsigned long)recorder_sectors_written(),
+                              (unsigned long)recorder_sectors_dropped());
+                Serial.printf("[Settings] slot %d  saves %lu%s\n",
+                              (int)settings_slot(), (unsigned long)settings_saves(),
+                              settings_pending() ? "  (save pending)" : "");
+                report_sensors();
+                report_noise();
+                Serial.printf("[Power] asleep %u%% since last report  cpu %luMHz\n",
+                              (unsigned)power_sleep_percent(), (unsigned long)power_cpu_mhz());
+                memory_report(Serial);
+                break;
+            case 'r':
+                profiler_reset();
+                Serial.println("[PROF] reset");
+                break;
+            case 't':
+                serial_set_report_mode(REPORT_TEXT);
+                break;
+            case 'b':
+                serial_set_report_mode(REPORT_BINARY);
+                break;
+            case 'o':
+                serial_set_report_mode(REPORT_OFF);
+                break;
+            case 'R':
+                replay_request(REPLAY_SESSION);
+                break;
+            case 'S':
+                replay_request(REPLAY_SIM);
+                break;
+            default:
+                break;   // Ignore newlines and anything unknown
+        }
+    }
+}
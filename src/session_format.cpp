@@ -0,0 +1,120 @@
+// session_format.cpp — Sector checks and the session decoder
+//
+// The decoder keeps its own copy of the loaded sector, so the caller's
+// read buffer is free again as soon as load() returns. A record that 
+// would run past the end of the payload, or an opcode it doesn't know, 
+// means the rest of the sector can't be trusted: it's dropped and 
+// decoding goes on from the next sector's keyframe.
+
+#include "session_format.h"
+#include "crc16.h"
+
+static inline uint16_t get_u16(const uint8_t* p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+uint16_t session_sector_crc(const uint8_t* sector, uint16_t used)
+{
+    constexpr size_t HEADER_CRC_BYTES = sizeof(RecorderSectorHeader) - 2;
+
+    // crc16_ccitt() takes one run of bytes, so line the two parts up
+    uint8_t scratch[HEADER_CRC_BYTES + SESSION_PAYLOAD_BYTES];
+    if (used > SESSION_PAYLOAD_BYTES) used = SESSION_PAYLOAD_BYTES;
+    memcpy(scratch, sector, HEADER_CRC_BYTES);
+    memcpy(scratch + HEADER_CRC_BYTES, sector + sizeof(RecorderSectorHeader), used);
+    return crc16_ccitt(scratch, HEADER_CRC_BYTES + used);
+}
+
+bool session_sector_valid(const uint8_t* sector, RecorderSectorHeader* header)
+{
+    RecorderSectorHeader h;
+    memcpy(&h, sector, sizeof(h));
+    if (h.magic != RECORDER_MAGIC || h.used > SESSION_PAYLOAD_BYTES) return false;
+    if (session_sector_crc(sector, h.used) != h.crc) return false;
+
+    if (header) *header = h;
+    return true;
+}
+
+void SessionDecoder::reset()
+{
+    *this = SessionDecoder();
+}
+
+bool SessionDecoder::load(const uint8_t* sector)
+{
+    RecorderSectorHeader h;
+    if (!session_sector_valid(sector, &h)) {
+        _rejected++;
+        return false;
+    }
+
+    if (_haveSector && h.sector > _lastIndex + 1) _missing += h.sector - _lastIndex - 1;
+    _haveSector = true;
+    _lastIndex = h.sector;
+    _loaded++;
+
+    memcpy(_sector, sector, RECORDER_SECTOR_BYTES);
+    _pos = 0;
+    _used = h.used;
+
+    _pressure = h.pressure;
+    _baseline = h.baseline;
+    _limit    = h.limit;
+    _motorQ4  = h.motorQ4;
+    _mode     = h.mode;
+    _userMode = h.userMode;
+    return true;
+}
+
+bool SessionDecoder::next(SessionSample& out)
+{
+    while (true) {
+        if (_gapLeft > 0) {
+            _gapLeft--;
+            break;
+        }
+
+        if (_pos + 2 > _used) return false;
+        const uint8_t* p = _sector + sizeof(RecorderSectorHeader) + _pos;
+
+        if (p[0] != SESSION_ESCAPE) {
+            _pressure = (uint16_t)(_pressure + (int8_t)p[0]);
+            _baseline = (uint16_t)(_baseline + (int8_t)p[1]);
+            _pos += 2;
+            break;
+        }
+
+        uint8_t length = p[1] == SESSION_OP_SAMPLE_ABS ? 6
+                       : p[1] == SESSION_OP_CONTROL    ? 8
+                       : p[1] == SESSION_OP_EDGE || p[1] == SESSION_OP_GAP ? 4
+                       : 0;
+        if (length == 0 || _pos + length > _used) {
+            _pos = _used;       // Unreadable from here on
+            return false;
+        }
+        _pos += length;
+
+        if (p[1] == SESSION_OP_SAMPLE_ABS) {
+            _pressure = get_u16(p + 2);
+            _baseline = get_u16(p + 4);
+            break;
+        }
+        if (p[1] == SESSION_OP_CONTROL) {
+            _limit    = get_u16(p + 2);
+            _motorQ4  = (int16_t)get_u16(p + 4);
+            _mode     = p[6];
+            _userMode = p[7];
+        } else if (p[1] == SESSION_OP_EDGE) {
+            _edges++;
+        } else {
+            _gapLeft = get_u16(p + 2);
+        }
+    }
+
+    out.raw = _pressure;
+    out.baseline = _baseline;
+    _samples++;
+    return true;
+}
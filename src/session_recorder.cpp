@@ -0,0 +1,467 @@
+// session_recorder.cpp — Sector ring, delta encoder and SD writer
+//
+// ═══════════════════════════════════════════════════════════════════════
+// THE SECTOR RING
+// ═══════════════════════════════════════════════════════════════════════
+//
+//   ring[]:  [ written ][ written ][ full ][ full ][ filling ][ free ] …
+//                                   ↑ readSector          ↑ fillSector
+//
+// The control task appends records to the sector at fillSector. When
+// the next record might not fit, it seals that sector (fills in the
+// header and CRC) and moves on. The recorder task writes sealed
+// sectors from readSector onwards. Both run in the main loop, never
+// from an interrupt, so the indices need no locking.
+//
+// If the card falls so far behind that the ring fills up, the sector
+// being filled is thrown away and restarted rather than overwriting
+// one the card hasn't had yet. Its sector number is still used up, so
+// the gap shows in the file.
+//
+// ═══════════════════════════════════════════════════════════════════════
+// SHARING SPI WITH THE LCD
+// ═══════════════════════════════════════════════════════════════════════
+//
+// The card sits on the same SPI bus as the colour LCD, so a sector is
+// only written while no LCD DMA transfer is running, and only when the
+// card has finished programming the last one (isBusy() is false).
+// Either way the task just tries again next time instead of waiting —
+// the ring has ~30 seconds of slack.
+//
+// The two also want different bus settings (the card MODE0 at its own
+// clock, the LCD MODE3 at 30MHz). SdFat applies the card's for every
+// access, and the LCD driver applies its own at the start of each of
+// its operations (colour_lcd.cpp), so neither inherits the other's.
+
+#include "session_recorder.h"
+#include "config.h"
+#include "globals.h"
+#include "pressure_sampler.h"
+#include "edge_guard.h"
+#include "colour_lcd.h"      // lcd_frame_busy
+#include <SD.h>
+
+// Biggest single record (control: escape + opcode + 6 bytes). Seal the
+// sector when less than this is left, so records never straddle two.
+constexpr uint8_t MAX_RECORD_BYTES = 8;
+
+// Sealed sectors the task writes per run at most (~1.5ms on a good card)
+constexpr uint8_t SECTORS_PER_SERVICE = 4;
+
+// The ring lives in RAM2 (DMAMEM), which the strip renderer left free
+static DMAMEM uint8_t ring[RECORDER_RING_SECTORS][RECORDER_SECTOR_BYTES];
+static uint32_t fillSector = 0;    // Total sectors started (ring index = % N)
+static uint32_t readSector = 0;    // Total sectors written to the card
+static uint16_t fillUsed = 0;      // Payload bytes in the filling sector
+static uint32_t sessionSector = 0; // Sector number within the session
+
+enum RecorderState : uint8_t {
+    REC_OFF,            // No card, or the card is full
+    REC_IDLE,           // Card ready, next file not made yet
+    REC_READY,          // Next file open and pre-allocated
+    REC_RECORDING,
+    REC_CLOSING         // recorder_stop() called — draining the ring
+};
+
+static RecorderState state = REC_OFF;
+static bool     startPending = false;    // recorder_start() before READY
+static FsFile   sessionFile;
+static uint16_t nextSessionNumber = 1;
+static uint32_t bytesWritten = 0;
+static uint16_t unsynced = 0;            // Sectors written since the last sync()
+
+static uint32_t sectorsWritten = 0;
+static uint32_t sectorsDropped = 0;
+
+// ── Encoder state: the last values written, which deltas are taken from
+static uint32_t sampleCursor = 0;
+static uint16_t lastPressure = 0;
+static uint16_t lastBaseline = 0;
+static uint16_t lastLimit    = 0;
+static int16_t  lastMotorQ4  = 0;
+static uint8_t  lastMode     = 0;
+static uint8_t  lastUserMode = 0;
+static uint32_t lastTrips    = 0;
+
+static inline uint8_t* fill_ptr()
+{
+    return ring[fillSector % RECORDER_RING_SECTORS];
+}
+
+static int16_t motor_q4()
+{
+    float q = motorSpeed * 16.0f;
+    if (q >  32767.0f) q =  32767.0f;
+    if (q < -32768.0f) q = -32768.0f;
+    return (int16_t)q;
+}
+
+// Fill in the keyframe for a fresh sector. The first sample record in
+// it is relative to these values.
+static void begin_sector(uint32_t firstSample)
+{
+    RecorderSectorHeader* h = (RecorderSectorHeader*)fill_ptr();
+    h->magic       = RECORDER_MAGIC;
+    h->sector      = sessionSector++;
+    h->firstSample = firstSample;
+    h->timeMs      = millis();
+    h->pressure    = lastPressure;
+    h->baseline    = lastBaseline;
+    h->limit       = lastLimit;
+    h->motorQ4     = lastMotorQ4;
+    h->mode        = lastMode;
+    h->userMode    = lastUserMode;
+    fillUsed = 0;
+}
+
+// Close off the filling sector and start the next one.
+static void seal_sector(uint32_t nextSample)
+{
+    uint8_t* sector = fill_ptr();
+    RecorderSectorHeader* h = (RecorderSectorHeader*)sector;
+    h->used = fillUsed;
+    h->crc = session_sector_crc(sector, fillUsed);
+
+    if (fillSector + 1 - readSector >= RECORDER_RING_SECTORS) {
+        // No free sector — drop this one and refill it in place
+        sectorsDropped++;
+    } else {
+        fillSector++;
+    }
+    begin_sector(nextSample);
+}
+
+static inline void put_u8(uint8_t v)
+{
+    fill_ptr()[sizeof(RecorderSectorHeader) + fillUsed++] = v;
+}
+
+static inline void put_u16(uint16_t v)
+{
+    put_u8(v & 0xFF);
+    put_u8(v >> 8);
+}
+
+static void make_room(uint32_t nextSample)
+{
+    if (fillUsed + MAX_RECORD_BYTES > SESSION_PAYLOAD_BYTES) seal_sector(nextSample);
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// Session files
+// ═══════════════════════════════════════════════════════════════════════
+//
+// Creating and pre-allocating a file walks the FAT and can block for 
+// hundreds of ms, and so can the truncate and close at the end. None 
+// of that may happen while a mode could be driving the motor, so the 
+// next file is made ahead of time — at boot, and again after each 
+// session closes — and only while recorder_service() is told the 
+// device is idle. Starting a session is then just resetting the 
+// encoder; the FAT isn't touched again until it ends.
+
+// Create and pre-allocate SESSnnnn.BIN for the next session.
+//
+// Pre-allocated clusters hold whatever was on the card before, which 
+// can be an old session's sectors. The first one is zeroed and synced, 
+// so at boot a file whose first sector has no valid header was never 
+// recorded into, whatever its size says.
+static void prepare_file()
+{
+    static uint8_t blank[RECORDER_SECTOR_BYTES];
+    char name[16];
+    snprintf(name, sizeof(name), "SESS%04u.BIN", nextSessionNumber);
+    sessionFile = SD.sdfs.open(name, O_RDWR | O_CREAT | O_TRUNC);
+    if (!sessionFile || !sessionFile.preAllocate(RECORDER_PREALLOC_BYTES) ||
+        sessionFile.write(blank, sizeof(blank)) != sizeof(blank) ||
+        !sessionFile.sync() || !sessionFile.seekSet(0)) {
+        Serial.printf("[Recorder] Can't create %s — recording off\n", name);
+        if (sessionFile) sessionFile.close();
+        state = REC_OFF;
+        return;
+    }
+    bytesWritten = 0;
+    unsynced = 0;
+    state = REC_READY;
+}
+
+// Could `next` be the sector written after `prev` in the same session? 
+// Sector numbers only go up (a dropped one leaves a hole), and both 
+// clocks restart at boot, so an old session's leftovers in the 
+// pre-allocation won't line up with this one's.
+static bool follows(const RecorderSectorHeader& prev, const RecorderSectorHeader& next)
+{
+    return next.sector > prev.sector &&
+           next.sector - prev.sector <= RECORDER_RING_SECTORS &&
+           next.firstSample >= prev.firstSample &&
+           next.timeMs >= prev.timeMs &&
+           next.timeMs - prev.timeMs <= 60000;     // The ring only holds ~30s
+}
+
+// The power went during `name`'s session: its size is the last sync()'s 
+// and the pre-allocation is still attached. Carry on through the 
+// sectors after that for as long as they continue the session, write 
+// them back through the file so they count, and let the rest of the 
+// pre-allocation go.
+static void recover_session(FsFile& file)
+{
+    uint32_t first, last;
+    uint32_t sectors = (uint32_t)(file.fileSize() / RECORDER_SECTOR_BYTES);
+    uint32_t recovered = 0;
+    uint8_t buf[RECORDER_SECTOR_BYTES];
+    RecorderSectorHeader prev, next;
+
+    // Only a pre-allocated file is contiguous, and only it can be read 
+    // past its size. The last synced sector is where the search starts.
+    if (file.contiguousRange(&first, &last) && sectors > 0 &&
+        SD.sdfs.card()->readSector(first + sectors - 1, buf) &&
+        session_sector_valid(buf, &prev)) {
+        uint32_t limit = sectors + 2 * RECORDER_SYNC_SECTORS;
+        for (uint32_t k = sectors; k < limit && first + k <= last; k++) {
+            if (!SD.sdfs.card()->readSector(first + k, buf) ||
+                !session_sector_valid(buf, &next) || !follows(prev, next)) break;
+            if (!file.seekSet((uint64_t)k * RECORDER_SECTOR_BYTES) ||
+                file.write(buf, sizeof(buf)) != sizeof(buf)) break;
+            prev = next;
+            sectors = k + 1;
+            recovered++;
+        }
+    }
+
+    file.truncate((uint64_t)sectors * RECORDER_SECTOR_BYTES);
+    Serial.printf("[Recorder] Last session wasn't closed — kept %lu sectors (%lu unsynced)\n",
+                  (unsigned long)sectors, (unsigned long)recovered);
+}
+
+// Start recording into the prepared file, from now — not the backlog 
+// in the sampler.
+static void begin_session()
+{
+    sampleCursor  = pressure_sampler_count();
+    lastPressure  = pressure_sampler_latest();
+    lastBaseline  = pressure_sampler_baseline();
+    lastLimit     = (uint16_t)pressureLimit;
+    lastMotorQ4   = motor_q4();
+    lastMode      = 0xFF;     // Forces a control record first
+    lastUserMode  = (uint8_t)userMode;
+    lastTrips     = edge_guard_trip_count();
+    sessionSector = 0;
+    readSector    = fillSector;
+    begin_sector(sampleCursor);
+
+    Serial.printf("[Recorder] Recording to SESS%04u.BIN\n", nextSessionNumber);
+    nextSessionNumber++;
+    state = REC_RECORDING;
+}
+
+// ═══════════════════════════════════════════════════════════════════════
+// Public API
+// ═══════════════════════════════════════════════════════════════════════
+
+bool recorder_init()
+{
+    if (!SD.begin(RECORDER_SD_CS)) {
+        Serial.println("[Recorder] No SD card — recording off");
+        state = REC_OFF;
+        return false;
+    }
+
+    // Carry on numbering after the sessions already on the card
+    char name[16];
+    while (nextSessionNumber < 9999) {
+        snprintf(name, sizeof(name), "SESS%04u.BIN", nextSessionNumber);
+        if (!SD.exists(name)) break;
+        nextSessionNumber++;
+    }
+
+    // The newest file is one of three things. Prepared by the last boot 
+    // and never recorded into: its first sector is the blank one, so 
+    // reuse its number (O_TRUNC gives its clusters back). Recorded into 
+    // and closed: nothing to do. Recorded into when the power went: 
+    // still as long as the pre-allocation, which recover_session() 
+    // trims back to the session.
+    if (nextSessionNumber > 1) {
+        snprintf(name, sizeof(name), "SESS%04u.BIN", nextSessionNumber - 1);
+        FsFile last = SD.sdfs.open(name, O_RDWR);
+        uint8_t sector[RECORDER_SECTOR_BYTES];
+        if (last) {
+            if (last.read(sector, sizeof(sector)) != (int)sizeof(sector) ||
+                !session_sector_valid(sector)) {
+                nextSessionNumber--;
+            } else {
+                uint32_t first, end;
+                if (last.contiguousRange(&first, &end) &&
+                    (uint64_t)(end - first + 1) * RECORDER_SECTOR_BYTES >= RECORDER_PREALLOC_BYTES)
+                    recover_session(last);
+            }
+            last.close();
+        }
+    }
+
+    Serial.printf("[Recorder] SD ready, next session SESS%04u.BIN\n", nextSessionNumber);
+
+    // Boot is the one time we know the motor is off
+    prepare_file();
+    return state == REC_READY;
+}
+
+void recorder_start()
+{
+    if (state == REC_READY)     begin_session();
+    else if (state != REC_OFF)  startPending = true;   // Once the file's ready
+}
+
+void recorder_stop()
+{
+    startPending = false;
+    if (state == REC_RECORDING) {
+        if (fillUsed > 0) seal_sector(sampleCursor);
+        state = REC_CLOSING;
+    }
+}
+
+void recorder_capture(uint8_t mode)
+{
+    if (state != REC_RECORDING) return;
+
+    // ── Control values: once per tick, only when something moved ──────
+    int16_t motorQ4 = motor_q4();
+    if (pressureLimit != lastLimit || motorQ4 != lastMotorQ4 ||
+        mode != lastMode || userMode != lastUserMode) {
+        make_room(sampleCursor);
+        lastLimit    = (uint16_t)pressureLimit;
+        lastMotorQ4  = motorQ4;
+        lastMode     = mode;
+        lastUserMode = (uint8_t)userMode;
+
+        put_u8(SESSION_ESCAPE);
+        put_u8(SESSION_OP_CONTROL);
+        put_u16(lastLimit);
+        put_u16((uint16_t)lastMotorQ4);
+        put_u8(lastMode);
+        put_u8(lastUserMode);
+    }
+
+    uint32_t trips = edge_guard_trip_count();
+    if (trips != lastTrips) {
+        lastTrips = trips;
+        make_room(sampleCursor);
+        put_u8(SESSION_ESCAPE);
+        put_u8(SESSION_OP_EDGE);
+        put_u16((uint16_t)minimumcooldown);
+    }
+
+    // ── Every pressure sample since the last tick ──────────────────────
+    PressureSample batch[32];
+    uint16_t n;
+    do {
+        uint32_t expected = sampleCursor;
+        n = pressure_sampler_read(sampleCursor, batch, 32);
+        uint32_t first = sampleCursor - n;
+
+        // The sampler ring overran us — note how much is missing
+        if (first != expected) {
+            make_room(first);
+            put_u8(SESSION_ESCAPE);
+            put_u8(SESSION_OP_GAP);
+            uint32_t lost = first - expected;
+            put_u16(lost > 0xFFFF ? 0xFFFF : (uint16_t)lost);
+        }
+
+        for (uint16_t i = 0; i < n; i++) {
+            make_room(first + i);
+
+            int32_t dp = (int32_t)batch[i].raw - lastPressure;
+            int32_t db = (int32_t)batch[i].baseline - lastBaseline;
+            if (dp > -128 && dp <= 127 && db >= -128 && db <= 127) {
+                put_u8((uint8_t)(int8_t)dp);
+                put_u8((uint8_t)(int8_t)db);
+            } else {
+                put_u8(SESSION_ESCAPE);
+                put_u8(SESSION_OP_SAMPLE_ABS);
+                put_u16(batch[i].raw);
+                put_u16(batch[i].baseline);
+            }
+            lastPressure = batch[i].raw;
+            lastBaseline = batch[i].baseline;
+        }
+    } while (n == 32);
+}
+
+void recorder_service(bool idle)
+{
+    switch (state) {
+        case REC_OFF:
+            return;
+
+        case REC_IDLE:
+            if (idle) prepare_file();     // FAT work only while nothing runs
+            return;
+
+        case REC_READY:
+            if (startPending) {
+                startPending = false;
+                begin_session();
+            }
+            return;
+
+        case REC_RECORDING:
+        case REC_CLOSING:
+            break;
+    }
+
+    // ── Write sealed sectors while the bus and the card are free ───────
+    for (uint8_t i = 0; i < SECTORS_PER_SERVICE && readSector != fillSector; i++) {
+        if ((Displays::lcd && lcd_frame_busy()) || SD.sdfs.card()->isBusy()) break;
+
+        if (bytesWritten + RECORDER_SECTOR_BYTES > RECORDER_PREALLOC_BYTES ||
+            sessionFile.write(ring[readSector % RECORDER_RING_SECTORS],
+                              RECORDER_SECTOR_BYTES) != RECORDER_SECTOR_BYTES) {
+            sectorsDropped++;     // File full or card error — skip it
+        } else {
+            bytesWritten += RECORDER_SECTOR_BYTES;
+            sectorsWritten++;
+            unsynced++;
+        }
+        readSector++;
+    }
+
+    // ── Make what's written survive a power cut ────────────────────────
+    if (unsynced > 0 && (unsynced >= RECORDER_SYNC_SECTORS || idle) &&
+        !(Displays::lcd && lcd_frame_busy()) && !SD.sdfs.card()->isBusy()) {
+        sessionFile.sync();
+        unsynced = 0;
+    }
+
+    if (state == REC_CLOSING && readSector == fillSector && idle) {
+        // Give back the unused part of the pre-allocation. The next
+        // file is made on a later pass, if still idle by then.
+        sessionFile.truncate(bytesWritten);
+        sessionFile.close();
+        Serial.printf("[Recorder] Session closed, %lu sectors\n",
+                      (unsigned long)(bytesWritten / RECORDER_SECTOR_BYTES));
+        state = REC_IDLE;
+    }
+}
+
+bool recorder_latest_session(char* name, size_t len)
+{
+    if ((state != REC_IDLE && state != REC_READY) || nextSessionNumber <= 1) return false;
+
+    snprintf(name, len, "SESS%04u.BIN", nextSessionNumber - 1);
+    return SD.exists(name);
+}
+
+bool recorder_active()
+{
+    return state == REC_RECORDING || state == REC_CLOSING;
+}
+
+uint32_t recorder_sectors_written()
+{
+    return sectorsWritten;
+}
+
+uint32_t recorder_sectors_dropped()
+{
+    return sectorsDropped;
+}
@@ -0,0 +1,312 @@
+// session_replay.cpp — Session file decoder and the replay loop
+//
+// ═══════════════════════════════════════════════════════════════════════
+// DECODING A SESSION FILE
+// ═══════════════════════════════════════════════════════════════════════
+//
+// The file is read one 512-byte sector at a time and handed to a
+// SessionDecoder (session_format.h). A sector whose magic or CRC is
+// wrong is skipped and decoding picks up at the next sector's
+// keyframe. Gap records are played back as the last value held, so
+// time in the replay stays in step with time in the session.
+//
+// The control loop runs at FREQUENCY and the samples at
+// PRESSURE_SAMPLE_HZ, so each replay tick takes 16 or 17 samples
+// (1000/60 on average). All of them go to the edge guard, as the ADC
+// interrupt would have done, and the last one becomes this tick's
+// pressure.
+
+#include "session_replay.h"
+#include "session_recorder.h"
+#include "globals.h"
+#include "pressure.h"
+#include "state.h"
+#include "modes.h"
+#include "auto_policy.h"
+#include "motor.h"
+#include "edge_guard.h"
+#include "sim_session.h"
+#include <SD.h>
+
+// ── Decoder state ──────────────────────────────────────────────────────
+
+static FsFile   replayFile;
+static SessionDecoder decoder;
+static uint16_t followedLimit = 0;
+static uint32_t tickIndex = 0;
+
+// Turn a recorded pressureLimit back into the knob position the 
+// recorded userMode derived it from, and put the encoder there. In 
+// mode 7 that needs the noise statistics: the replay's own, which the 
+// edge guard has been building from these same samples.
+static void follow_limit(uint16_t limit)
+{
+    myEnc.write(auto_knob_for_limit(decoder.userMode(), limit, edge_guard_noise()) * 4);
+}
+
+// Next sample of the file, loading sectors as the decoder runs out
+static bool next_sample(SessionSample& s)
+{
+    uint8_t sector[RECORDER_SECTOR_BYTES];
+    while (!decoder.next(s)) {
+        do {
+            if (replayFile.read(sector, sizeof(sector)) != (int)sizeof(sector)) return false;
+        } while (!decoder.load(sector));
+    }
+
+    if (decoder.limit() != followedLimit) {
+        followedLimit = decoder.limit();
+        follow_limit(followedLimit);
+    }
+    return true;
+}
+
+// Pressure source over the open session file
+static bool session_read_tick(int& p, int& baseline)
+{
+    uint32_t from = (tickIndex * PRESSURE_SAMPLE_HZ) / FREQUENCY;
+    uint32_t to   = ((tickIndex + 1) * PRESSURE_SAMPLE_HZ) / FREQUENCY;
+    tickIndex++;
+
+    SessionSample s;
+    bool any = false;
+    for (uint32_t i = from; i < to; i++) {
+        if (!next_sample(s)) break;
+        edge_guard_feed(s.raw, s.baseline);
+        any = true;
+    }
+    if (!any) return false;
+
+    p = s.raw;
+    baseline = s.baseline;
+    return true;
+}
+
+static const PressureSource PRESSURE_SOURCE_SESSION = { "session", session_read_tick };
+
+// ═══════════════════════════════════════════════════════════════════════
+// Replay job
+// ═══════════════════════════════════════════════════════════════════════
+//
+// One request replays every userMode in turn. Each control tick runs 
+// as many replay ticks as fit in REPLAY_SLICE_US and then hands the 
+// loop back, so the menu keeps answering while a report builds. In 
+// Python terms:
+//
+//   for mode in range(1, userModeTotal + 1):
+//       run = begin(kind, mode)
+//       while not run.done:
+//           run.step_until(now + REPLAY_SLICE_US)
+//           yield                      # back to the main loop
+//       print_row(finish(run))
+//
+// Between slices the replay's state stays in place (dry-run motor, 
+// replay pressure source, the mode's globals), so nothing else may run 
+// the mode code until it's finished or cancelled.
+
+static ReplayKind pendingKind = REPLAY_NONE;
+
+static struct {
+    ReplayKind   kind;          // REPLAY_NONE when idle
+    int          mode;          // Being replayed now
+    ReplayResult result;
+    uint32_t     edgesBefore;
+    uint32_t     lastEdges;
+    uint32_t     cooldownRun;
+    bool         inCooldown;
+    uint32_t     msDone;
+    uint32_t     runUs;         // CPU time spent on this mode so far
+
+    // Everything the mode code writes, from before the run
+    float   motorSpeed;
+    int     pressure;
+    int     averagePressure;
+    int     pressureLimit;
+    int     sensitivity;
+    int     userMode;
+    int     minimumcooldown;
+    int     cooldownFlag;
+    int32_t encoder;
+} job = {};
+
+// Open the trace and put the replay's state in place of the live one
+static bool run_begin(ReplayKind kind, int mode)
+{
+    memset(&job.result, 0, sizeof(job.result));
+
+    const PressureSource* source;
+    if (kind == REPLAY_SESSION) {
+        char name[16];
+        if (!recorder_latest_session(name, sizeof(name))) return false;
+        replayFile = SD.sdfs.open(name, O_RDONLY);
+        if (!replayFile) return false;
+        decoder.reset();
+        followedLimit = 0;
+        tickIndex = 0;
+        source = &PRESSURE_SOURCE_SESSION;
+    } else if (kind == REPLAY_SIM) {
+        sim_reset(REPLAY_SIM_SEED);
+        source = &PRESSURE_SOURCE_SIM;
+    } else {
+        return false;
+    }
+
+    // ── Save everything the mode code writes ───────────────────────────
+    job.motorSpeed      = motorSpeed;
+    job.pressure        = pressure;
+    job.averagePressure = averagePressure;
+    job.pressureLimit   = pressureLimit;
+    job.sensitivity     = sensitivity;
+    job.userMode        = userMode;
+    job.minimumcooldown = minimumcooldown;
+    job.cooldownFlag    = cooldownFlag;
+    job.encoder         = myEnc.read();
+
+    motor_set_dry_run(true);
+    motor_write(0);             // Engine starts from rest, whatever it was doing
+    pressure_set_source(source);
+    userMode = mode;
+    motorSpeed = 0;
+    cooldownFlag = 0;
+
+    job.kind        = kind;
+    job.mode        = mode;
+    job.edgesBefore = auto_edge_count();
+    job.lastEdges   = job.edgesBefore;
+    job.cooldownRun = 0;
+    job.inCooldown  = false;
+    job.msDone      = 0;
+    job.runUs       = 0;
+    return true;
+}
+
+// One control tick of the replay. False once the trace has run out.
+static bool run_tick()
+{
+    ReplayResult& result = job.result;
+
+    if (job.kind == REPLAY_SIM) {
+        if (result.ticks >= REPLAY_SIM_TICKS) return false;
+        sim_tick();
+    }
+    if (!update_pressure()) return false;
+
+    run_state_machine(AUTO);
+    result.ticks++;
+
+    // The motor engine doesn't run off its timer in dry run — move 
+    // it on by this tick's share of real time (16 or 17ms)
+    uint32_t msNow = (uint32_t)((uint64_t)result.ticks * UPDATE_PERIOD_US / 1000);
+    motor_engine_advance(msNow - job.msDone);
+    job.msDone = msNow;
+
+    uint32_t edges = auto_edge_count();
+    if (edges != job.lastEdges) {
+        job.lastEdges = edges;
+        job.inCooldown = true;
+        job.cooldownRun = 0;
+    }
+
+    bool motorOn = motor_engine_level() > 0;
+    if (motorOn) result.motorOnTicks++;
+
+    if (job.inCooldown) {
+        if (motorOn) {
+            job.inCooldown = false;
+            if (job.cooldownRun > result.longestCooldownTicks) result.longestCooldownTicks = job.cooldownRun;
+        } else {
+            job.cooldownRun++;
+            result.cooldownTicks++;
+        }
+    }
+    return true;
+}
+
+// Put the live state back and close the trace
+static void run_end()
+{
+    job.result.edges = auto_edge_count() - job.edgesBefore;
+
+    edge_guard_disarm();
+    pressure_set_source(&PRESSURE_SOURCE_LIVE);
+    motor_set_dry_run(false);
+
+    motorSpeed      = job.motorSpeed;
+    pressure        = job.pressure;
+    averagePressure = job.averagePressure;
+    pressureLimit   = job.pressureLimit;
+    sensitivity     = job.sensitivity;
+    userMode        = job.userMode;
+    minimumcooldown = job.minimumcooldown;
+    cooldownFlag    = job.cooldownFlag;
+    myEnc.write(job.encoder);
+    motor_write(0);
+
+    if (job.kind == REPLAY_SESSION) replayFile.close();
+    else                            sim_reset();
+
+    job.kind = REPLAY_NONE;
+}
+
+static void print_row(int mode, const ReplayResult& r, uint32_t runUs)
+{
+    float minutes  = r.ticks / (60.0f * FREQUENCY);
+    float onPct    = r.ticks ? 100.0f * r.motorOnTicks / r.ticks : 0.0f;
+    float avgCool  = r.edges ? (float)r.cooldownTicks / r.edges / FREQUENCY : 0.0f;
+    float maxCool  = (float)r.longestCooldownTicks / FREQUENCY;
+    Serial.printf("[Replay] %4d %8.1f %6lu %10.1f %15.1f %15.1f %7lu\n",
+                  mode, minutes, (unsigned long)r.edges, onPct, avgCool, maxCool,
+                  (unsigned long)(runUs / 1000));
+}
+
+void replay_request(ReplayKind kind)
+{
+    pendingKind = kind;
+    Serial.println("[Replay] Queued — runs from the main menu");
+}
+
+bool replay_active()
+{
+    return job.kind != REPLAY_NONE || pendingKind != REPLAY_NONE;
+}
+
+void replay_cancel()
+{
+    if (job.kind == REPLAY_NONE) return;
+    run_end();
+    Serial.println("[Replay] Cancelled — left the main menu");
+}
+
+void replay_service()
+{
+    if (job.kind == REPLAY_NONE) {
+        if (pendingKind == REPLAY_NONE) return;
+        ReplayKind kind = pendingKind;
+        pendingKind = REPLAY_NONE;
+
+        Serial.printf("[Replay] %s, userModes 1-%d\n",
+                      kind == REPLAY_SESSION ? "latest session" : "simulation", userModeTotal);
+        Serial.println("[Replay] mode  minutes  edges  motor_on%  cooldown_avg_s  cooldown_max_s  run_ms");
+
+        if (!run_begin(kind, 1)) {
+            Serial.println("[Replay] Nothing to replay (no card or no session)");
+            return;
+        }
+    }
+
+    // ── This tick's slice ──────────────────────────────────────────────
+    uint32_t start = micros();
+    bool more = true;
+    while (more && micros() - start < REPLAY_SLICE_US) more = run_tick();
+    job.runUs += micros() - start;
+    if (more) return;
+
+    // ── That mode's done — report it, move on to the next ──────────────
+    ReplayKind kind = job.kind;
+    int mode = job.mode;
+    run_end();
+    print_row(mode, job.result, job.runUs);
+
+    if (mode < userModeTotal && !run_begin(kind, mode + 1))
+        Serial.println("[Replay] Trace went away — stopping");
+}
@@ -0,0 +1,264 @@
+// settings.cpp — Persistent settings with write-behind and wear levelling
+
+#include "settings.h"
+#include "config.h"
+#include "globals.h"
+#include "leds.h"
+#include "crc16.h"
+
+#include <EEPROM.h>
+
+// ── Slot layout ────────────────────────────────────────────────────────
+
+constexpr uint16_t SETTINGS_MAGIC = 0x534E;    // "NS" little-endian
+
+struct __attribute__((packed)) SettingsRecord {
+    uint16_t magic;
+    uint8_t  version;
+    uint16_t seq;                 // Newer records have higher (wrapping) numbers
+    Settings data;
+    uint16_t crc;                 // CRC-16/CCITT of everything above
+};
+
+static_assert(sizeof(SettingsRecord) <= SETTINGS_SLOT_BYTES,
+              "Settings no longer fit a slot — grow SETTINGS_SLOT_BYTES");
+static_assert((uint32_t)SETTINGS_SLOT_BYTES * SETTINGS_SLOT_COUNT <= 1080,
+              "Settings slots overrun the Teensy 4's emulated EEPROM");
+
+constexpr size_t RECORD_CRC_BYTES = sizeof(SettingsRecord) - sizeof(uint16_t);
+
+// Where builds before the slot ring kept their two settings, one byte
+// each. Both fall inside slot 0.
+constexpr uint16_t LEGACY_MAX_SPEED_ADDR   = 2;
+constexpr uint16_t LEGACY_SENSITIVITY_ADDR = 3;
+
+// ── State ──────────────────────────────────────────────────────────────
+
+static Settings saved;            // What the newest good slot holds
+static Settings lastSeen;         // Live values at the previous call
+static uint32_t lastChangeMs = 0;
+
+static int8_t   currentSlot = -1;
+static uint16_t currentSeq = 0;
+
+// The save in progress, if any
+static bool           writing = false;
+static SettingsRecord writeRec;
+static uint8_t        writeSlot;
+static uint8_t        writePos;
+
+static uint32_t saveCount = 0;
+
+// ════════════════════════════════════════════════════════════════════════
+// Settings ↔ globals
+// ════════════════════════════════════════════════════════════════════════
+
+static constexpr uint8_t DEFAULT_BRIGHTNESS = BRIGHTNESS;
+
+static Settings defaults()
+{
+    Settings s;
+    memset(&s, 0, sizeof(s));     // Padding too, so memcmp() is meaningful
+    s.sensitivity   = 0;
+    s.maxMotorSpeed = MOT_MAX;
+    s.rampUp        = 10;
+    s.userMode      = 6;
+    s.brightness    = DEFAULT_BRIGHTNESS;
+    s.cooldown      = 120;
+    s.cooldownStep  = 1;
+    s.maxCooldown   = 180;
+    s.pressureStep  = 1;
+    return s;
+}
+
+Settings settings_current()
+{
+    Settings s;
+    memset(&s, 0, sizeof(s));
+    s.sensitivity   = (int16_t)sensitivity;
+    s.maxMotorSpeed = (uint8_t)constrain(maxMotorSpeed, 0, MOT_MAX);
+    s.rampUp        = (uint8_t)constrain(rampUp, 1, 255);
+    s.userMode      = (uint8_t)userMode;
+    s.brightness    = leds_brightness();
+    s.cooldown      = (uint16_t)cooldown;
+    s.cooldownStep  = (uint8_t)cooldownStep;
+    s.maxCooldown   = (uint16_t)maxCooldown;
+    s.pressureStep  = (uint8_t)pressureStep;
+    return s;
+}
+
+void settings_apply(const Settings& s)
+{
+    // A record can pass its CRC and still hold values from an older
+    // build's idea of the ranges — clamp everything on the way in.
+    sensitivity   = constrain(s.sensitivity, 0, (3 * NUM_LEDS - 1) * 4);
+    maxMotorSpeed = constrain(s.maxMotorSpeed, 0, MOT_MAX);
+    rampUp        = s.rampUp > 0 ? s.rampUp : 1;
+    userMode      = constrain(s.userMode, 1, userModeTotal);
+    cooldown      = s.cooldown;
+    cooldownStep  = s.cooldownStep;
+    maxCooldown   = s.maxCooldown;
+    pressureStep  = s.pressureStep;
+    leds_set_brightness(s.brightness);
+}
+
+void settings_reset_defaults()
+{
+    settings_apply(defaults());
+}
+
+// ════════════════════════════════════════════════════════════════════════
+// Slots
+// ════════════════════════════════════════════════════════════════════════
+
+static bool read_slot(uint8_t slot, SettingsRecord& rec)
+{
+    uint8_t* bytes = (uint8_t*)&rec;
+    uint16_t base = (uint16_t)slot * SETTINGS_SLOT_BYTES;
+    for (size_t i = 0; i < sizeof(rec); i++) bytes[i] = EEPROM.read(base + i);
+
+    return rec.magic == SETTINGS_MAGIC
+        && rec.version == SETTINGS_VERSION
+        && crc16_ccitt(bytes, RECORD_CRC_BYTES) == rec.crc;
+}
+
+// A unit updated from a build before the slot ring has no good slot 
+// yet, but still has its old settings at the fixed addresses. Take 
+// what they hold over the defaults, the way that build read them. 
+// Erased flash reads 0xFF — that's a unit that never saved anything.
+static Settings legacy_settings()
+{
+    Settings s = defaults();
+    uint8_t maxSpeed = EEPROM.read(LEGACY_MAX_SPEED_ADDR);
+    uint8_t sens     = EEPROM.read(LEGACY_SENSITIVITY_ADDR);
+    if (maxSpeed == 0xFF && sens == 0xFF) return s;
+
+    s.sensitivity   = sens;
+    s.maxMotorSpeed = maxSpeed < MOT_MAX ? maxSpeed : MOT_MAX;
+    return s;
+}
+
+// Sequence numbers wrap, so "newer" is the signed difference — the
+// same trick as comparing millis() timestamps.
+static inline bool seq_newer(uint16_t a, uint16_t b)
+{
+    return (int16_t)(a - b) > 0;
+}
+
+void settings_init()
+{
+    SettingsRecord rec;
+    Settings best = defaults();
+
+    for (uint8_t slot = 0; slot < SETTINGS_SLOT_COUNT; slot++) {
+        if (!read_slot(slot, rec)) continue;
+        if (currentSlot < 0 || seq_newer(rec.seq, currentSeq)) {
+            currentSlot = (int8_t)slot;
+            currentSeq  = rec.seq;
+            best        = rec.data;
+        }
+    }
+
+    // No good slot: the first boot of a new unit, or of one updated 
+    // from the fixed-address build. The legacy values count as 
+    // unsaved, so they go into a slot on the first idle save and this 
+    // never happens again.
+    if (currentSlot < 0) {
+        best = legacy_settings();
+        saved = defaults();
+    } else {
+        saved = best;
+    }
+
+    settings_apply(best);
+
+    // What we loaded counts as saved, even after clamping. If clamping
+    // changed anything, the difference is saved like any other edit.
+    lastSeen = settings_current();
+    lastChangeMs = millis();
+}
+
+// ════════════════════════════════════════════════════════════════════════
+// Write-behind
+// ════════════════════════════════════════════════════════════════════════
+
+static void begin_save(const Settings& s)
+{
+    memset(&writeRec, 0, sizeof(writeRec));
+    writeRec.magic   = SETTINGS_MAGIC;
+    writeRec.version = SETTINGS_VERSION;
+    writeRec.seq     = currentSlot < 0 ? 0 : (uint16_t)(currentSeq + 1);
+    writeRec.data    = s;
+    writeRec.crc     = crc16_ccitt((const uint8_t*)&writeRec, RECORD_CRC_BYTES);
+
+    // Never the slot holding the newest good record — if this save is
+    // cut off, that one still loads. The very first save skips slot 0, 
+    // so a cut-off one can't take the legacy bytes with it either.
+    writeSlot = (uint8_t)((currentSlot + 1) % SETTINGS_SLOT_COUNT);
+    if (currentSlot < 0) writeSlot = 1;
+    writePos  = 0;
+    writing   = true;
+}
+
+// A few bytes per call. Bytes already holding the right value cost
+// nothing (EEPROM.update() skips them), so rewriting a slot with
+// similar contents is mostly reads.
+static void continue_save()
+{
+    const uint8_t* bytes = (const uint8_t*)&writeRec;
+    uint16_t base = (uint16_t)writeSlot * SETTINGS_SLOT_BYTES;
+
+    for (uint8_t n = 0; n < SETTINGS_BYTES_PER_CALL && writePos < sizeof(writeRec); n++) {
+        // The CRC goes last: until it lands, the slot reads as bad
+        EEPROM.update(base + writePos, bytes[writePos]);
+        writePos++;
+    }
+
+    if (writePos >= sizeof(writeRec)) {
+        writing     = false;
+        currentSlot = (int8_t)writeSlot;
+        currentSeq  = writeRec.seq;
+        saved       = writeRec.data;
+        saveCount++;
+    }
+}
+
+void settings_service(bool idle)
+{
+    Settings live = settings_current();
+    uint32_t now = millis();
+
+    if (memcmp(&live, &lastSeen, sizeof(live)) != 0) {
+        lastSeen = live;
+        lastChangeMs = now;
+    }
+
+    if (!idle) return;
+
+    if (writing) {
+        continue_save();
+        return;
+    }
+
+    if (memcmp(&live, &saved, sizeof(live)) != 0 &&
+        now - lastChangeMs >= SETTINGS_SETTLE_MS) {
+        begin_save(live);
+        continue_save();
+    }
+}
+
+bool settings_pending()
+{
+    Settings live = settings_current();
+    return writing || memcmp(&live, &saved, sizeof(live)) != 0;
+}
+
+uint32_t settings_saves()
+{
+    return saveCount;
+}
+
+int8_t settings_slot()
+{
+    return currentSlot;
+}
@@ -31,15 +31,16 @@
 // max, and everything drops together when an "edge" is detected.
 //
 // RANDOMNESS:
-// We use random() for jitter, which is fine for demo visuals.
-// The seed comes from an unconnected analog pin read in sim_reset(),
+// We use hal_random() for jitter, which is fine for demo visuals.
+// The seed comes from the microsecond clock in sim_reset(),
 // so each demo session looks different. In Python terms, this is 
 // like calling random.seed(os.urandom(4)) — not cryptographic, 
 // but plenty for visual variety.
 
 #include "sim_session.h"
 #include "config.h"
-#include "RunningAverage.h"
+#include "baseline_filter.h"
+#include "fixed.h"
 
 // ── Simulated pressure internals ───────────────────────────────────
 //
@@ -60,17 +61,23 @@
 //               muscles are jittery. Simulates the real sensor's 
 //               tick-to-tick variance.
 
-static float contractionFloat  = 0.0f;  // Current contraction intensity
-static float contractionTarget = 0.0f;  // What contractions are building toward
-static int   simTickCount      = 0;     // For RA sub-sampling at 6Hz
+//
+// The model runs in Q16.16 fixed point (see fixed.h) — it's all
+// adds, multiplies and clamps, none of which need a float.
+
+static q16_t contraction       = 0;    // Current contraction intensity
+static q16_t contractionTarget = 0;    // What contractions are building toward
 
-// Use the same RunningAverage library as the real pressure system,
-// with the same buffer size. This way any tuning changes to 
-// RA_HIST_SECONDS or RA_FREQUENCY in config.h automatically apply 
-// to the simulation too.
+// Use the same BaselineFilter as the real pressure system, with the
+// same mode and window in seconds — just sized for the 60Hz tick
+// instead of the 1kHz sample rate. This way any tuning changes to 
+// the BASELINE_* settings in config.h automatically apply to the 
+// simulation too.
 //
-// In Python: self.ra = RunningAverage(RA_FREQUENCY * RA_HIST_SECONDS)
-static RunningAverage simRA(RA_FREQUENCY * RA_HIST_SECONDS);
+// In Python: self.baseline = BaselineFilter(FREQUENCY * BASELINE_WINDOW_SECONDS)
+static BaselineFilter simBaseline(BASELINE_MODE,
+                                  (uint32_t)FREQUENCY * BASELINE_WINDOW_SECONDS,
+                                  BASELINE_MEDIAN_N);
 
 // ── Public state (defined here, declared extern in header) ─────────
 int   sim_arousal     = 0;
@@ -92,31 +99,31 @@ constexpr int   SIM_BASELINE        = 1024;
 // 0.02 at 60Hz means it takes ~50 ticks (~0.8s) to reach 63% of 
 // the target. In Python: contraction += 0.02 * (target - current)
 // This models the physiological lag of muscle recruitment.
-constexpr float CONTRACTION_ALPHA   = 0.02f;
+constexpr q16_t CONTRACTION_ALPHA   = q16(0.02f);
 
 // How much motor/arousal drives the contraction target.
 // At full motor (255) and full arousal fraction (1.0), the target 
 // contraction is ~1.0 × this value. Needs to be large enough that 
 // the resulting delta can reach pressureLimit (600) but not so 
 // large that it gets there too quickly.
-constexpr float CONTRACTION_GAIN    = 800.0f;
+constexpr int   CONTRACTION_GAIN    = 800;
 
 // Noise scales with contraction intensity — relaxed muscles are 
 // quiet, activated muscles are jittery. This multiplier sets how 
 // much random variation there is relative to contraction level.
-constexpr float CONTRACTION_NOISE   = 0.15f;
+constexpr q16_t CONTRACTION_NOISE   = q16(0.15f);
 
 // Post-edge relaxation speed. Muscles don't instantly relax — 
 // they release over several seconds. This controls how fast the 
 // contraction target drops during cooldown.
-constexpr float RELAXATION_RATE     = 0.04f;
+constexpr q16_t RELAXATION_KEEP     = q16(1.0f - 0.04f);   // Keep 96% per tick
 
 // ── Internal simulation state ──────────────────────────────────────
 // 'static' = file-private. These persist between tick() calls but 
 // aren't accessible from other modules.
 
 static float arousalFloat    = 0.0;  // Smooth float for gradual ramping
-static float motorFloat      = 0.0;  // Smooth motor ramp (independent of arousal drop)
+static q16_t motorLevel      = 0;    // Smooth motor ramp (independent of arousal drop)
 static int   edgeThreshold   = 0;    // Arousal level that triggers an "edge"
 static int   cooldownTicks   = 0;    // Ticks remaining in post-edge cooldown
 static bool edgeJustFired = false; // Did we just reach an edge?
@@ -153,8 +160,8 @@ constexpr int BPM_RESTING            = 62;
 constexpr int BPM_ELEVATED           = 97;
 
 // Motor follows arousal but with its own ramp characteristics.
-constexpr float MOTOR_RAMP_RATE      = 0.18;  // Slower than arousal ramp
-constexpr float MOTOR_BACKOFF_RATE   = 0.6;   // Fast drop when ceiling falls
+constexpr q16_t MOTOR_RAMP_RATE      = q16(0.18f);  // Slower than arousal ramp
+constexpr q16_t MOTOR_BACKOFF_RATE   = q16(0.6f);   // Fast drop when ceiling falls
 
 // Simulated sensitivity — a realistic mid-range knob position.
 // 200–300 is typical for a real session. This controls both when 
@@ -172,8 +179,8 @@ float sim_gsr         = 0.0;
 float sim_gsr_phasic  = 0.0;
 
 // ── Internal GSR state ─────────────────────────────────────────────
-static float gsrTonic   = 0.0;   // Slow-moving baseline
-static float gsrPhasic  = 0.0;   // Fast-attack, slow-decay spike
+static q16_t gsrTonic   = 0;     // Slow-moving baseline
+static q16_t gsrPhasic  = 0;     // Fast-attack, slow-decay spike
 
 // ── GSR tuning constants ───────────────────────────────────────────
 //
@@ -184,16 +191,20 @@ static float gsrPhasic  = 0.0;   // Fast-attack, slow-decay spike
 // How fast the tonic baseline tracks arousal.
 // 0.001 at 60Hz ≈ 17-second effective window — very sluggish,
 // like heating a cast-iron pan.
-constexpr float GSR_TONIC_ALPHA     = 0.001;
+//
+// A rate this small has a dead zone in Q16.16: once the baseline is
+// within ~0.008 of its target the per-tick step rounds to zero and it
+// stops creeping. That's well under a pixel on any GSR trace.
+constexpr q16_t GSR_TONIC_ALPHA     = q16(0.001f);
 
 // Tonic output range: even at rest there's some baseline
 // conductance, and it never quite reaches 1.0 from tonic alone.
-constexpr float GSR_TONIC_FLOOR     = 0.15;
-constexpr float GSR_TONIC_CEILING   = 0.70;
+constexpr q16_t GSR_TONIC_FLOOR     = q16(0.15f);
+constexpr q16_t GSR_TONIC_CEILING   = q16(0.70f);
 
 // How much a single edge event kicks the phasic component.
 // Think of this as the "startle response" magnitude.
-constexpr float GSR_PHASIC_KICK     = 0.25;
+constexpr q16_t GSR_PHASIC_KICK     = q16(0.25f);
 
 // Phasic decay rate per tick. 0.993 at 60Hz gives a half-life
 // of about 100 ticks ≈ 1.7 seconds. The tail lingers for ~10
@@ -203,10 +214,13 @@ constexpr float GSR_PHASIC_KICK     = 0.25;
 //     = -0.693 / -0.00702 ≈ 99 ticks
 //
 // In Python: import math; math.log(0.5) / math.log(0.993) → ~98.7
-constexpr float GSR_PHASIC_DECAY    = 0.993;
+//
+// (In fixed point the tail bottoms out at ~0.001 instead of reaching
+// zero — invisible once it's added to the tonic level.)
+constexpr q16_t GSR_PHASIC_DECAY    = q16(0.993f);
 
 // Tiny noise amplitude for organic texture
-constexpr float GSR_NOISE_RANGE     = 0.005;
+constexpr q16_t GSR_NOISE_RANGE     = q16(0.005f);
 
 
 // ── Helper: pick a new random edge threshold ───────────────────────
@@ -214,7 +228,14 @@ constexpr float GSR_NOISE_RANGE     = 0.005;
 // sessions where sensitivity shifts over time.
 static void pick_new_threshold()
 {
-    edgeThreshold = random(THRESHOLD_MIN, THRESHOLD_MAX + 1);
+    edgeThreshold = hal_random(THRESHOLD_MIN, THRESHOLD_MAX + 1);
+}
+
+// ── Helper: uniform noise in ±range ────────────────────────────────
+// In Python: random.randint(-100, 100) / 100 * range
+static q16_t noise(q16_t range)
+{
+    return q16_scale(range, hal_random(-100, 101), 100);
 }
 
 
@@ -222,24 +243,24 @@ static void pick_new_threshold()
 // Reset
 // ════════════════════════════════════════════════════════════════════
 
-void sim_reset()
+void sim_reset(uint32_t seed)
 {
-    // Seed the PRNG from an unconnected analog pin for variety.
-    // analogRead on a floating pin picks up electrical noise, giving 
+    // Seed the PRNG from the microsecond clock for variety. The time 
+    // at which the user enters demo mode is effectively random, giving 
     // us a different-ish seed each time. Not great entropy, but fine 
-    // for demo visuals.
+    // for demo visuals. (This used to be analogRead() on a floating 
+    // pin, but the ADC now belongs to the background pressure sampler.)
     //
-    // In Python: random.seed(int.from_bytes(os.urandom(2), 'big'))
-    randomSeed(analogRead(A9));
+    // In Python: random.seed(time.perf_counter_ns())
+    hal_random_seed(seed != 0 ? seed : hal_micros());
 
-    simRA.clear();
-    contractionFloat  = 0.0f;
-    contractionTarget = 0.0f;
+    simBaseline.reset(SIM_BASELINE);
+    contraction       = 0;
+    contractionTarget = 0;
     sim_pressure      = SIM_BASELINE;
     sim_avg_pressure  = SIM_BASELINE;
-    simTickCount      = 0;
     arousalFloat       = 0.0;
-    motorFloat         = 0.0;
+    motorLevel         = 0;
     sim_arousal        = 0;
     sim_bpm            = BPM_RESTING;
     sim_beat           = false;
@@ -247,8 +268,8 @@ void sim_reset()
     cooldownTicks      = 0;
     ticksSinceLastBeat = 0;
     gsrTonic           = GSR_TONIC_FLOOR;  // Start at resting baseline, not zero
-    gsrPhasic          = 0.0;
-    sim_gsr            = GSR_TONIC_FLOOR;
+    gsrPhasic          = 0;
+    sim_gsr            = q16_to_float(GSR_TONIC_FLOOR);
     sim_gsr_phasic     = 0.0;
 
     pick_new_threshold();
@@ -275,8 +296,6 @@ void sim_tick()
     // running average's lag, catch-up, and post-edge overshoot all 
     // emerge from the same maths the real device uses.
 
-    simTickCount++;
-
     // ── DERIVE DELTA (the emergent "arousal" value) ────────────────
     // This is now computed exactly the way the real display code does 
     // it, rather than being generated directly. All the natural lag 
@@ -287,16 +306,17 @@ void sim_tick()
     // Arousal fraction now scales against the sim's sensitivity, 
     // not the global maximum. This means 0.0 = no delta, 1.0 = at 
     // the edge threshold — same meaning as the real device.
-    float arousalFraction = constrain((float)delta / (float)sim_pressure_limit, 0.0f, 1.0f);
+    q16_t arousalFraction = q16_clamp(q16_scale(Q16_ONE, delta, sim_pressure_limit),
+                                      0, Q16_ONE);
 
     if (cooldownTicks > 0)
     {
         // Post-edge: muscles gradually relax, contraction target 
         // decays toward zero. Not instant — like a slowly unclenching fist.
         cooldownTicks--;
-        contractionTarget *= (1.0f - RELAXATION_RATE);
-        motorFloat -= MOTOR_BACKOFF_RATE;
-        if (motorFloat < 0) motorFloat = 0;
+        contractionTarget = q16_mul(contractionTarget, RELAXATION_KEEP);
+        motorLevel -= MOTOR_BACKOFF_RATE;
+        if (motorLevel < 0) motorLevel = 0;
     }
     else
     {
@@ -307,51 +327,46 @@ void sim_tick()
         //
         // The motor doesn't "know" about pressure at all — it just 
         // climbs. Pressure is what STOPS it (via edge detection).
-        motorFloat += MOTOR_RAMP_RATE;
-        if (motorFloat > MOT_MAX) motorFloat = MOT_MAX;
+        motorLevel += MOTOR_RAMP_RATE;
+        if (motorLevel > q16_from_int(MOT_MAX)) motorLevel = q16_from_int(MOT_MAX);
 
-        // NOW contractions can follow from the motor being active
-        float motorFraction = motorFloat / (float)MOT_MAX;
-        contractionTarget = motorFraction * CONTRACTION_GAIN;
+        // NOW contractions can follow from the motor being active:
+        // target = motor / MOT_MAX * CONTRACTION_GAIN
+        contractionTarget = q16_scale(motorLevel, CONTRACTION_GAIN, MOT_MAX);
 
         // Edge detection using the emergent delta
         if (delta >= (int)MAX_PRESSURE_LIMIT)
         {
-            cooldownTicks = random(COOLDOWN_MIN_TICKS, COOLDOWN_MAX_TICKS + 1);
-            motorFloat = 0;
+            cooldownTicks = hal_random(COOLDOWN_MIN_TICKS, COOLDOWN_MAX_TICKS + 1);
+            motorLevel = 0;
             edgeJustFired = true;
         }
     }
 
     // Contraction intensity chases the target with physiological lag.
     // In Python: contraction += alpha * (target - contraction)
-    contractionFloat += CONTRACTION_ALPHA * (contractionTarget - contractionFloat);
+    contraction += q16_mul(CONTRACTION_ALPHA, contractionTarget - contraction);
 
     // Noise proportional to contraction intensity.
     // Quiet when relaxed, jittery when clenching. The ±range scales 
     // with current contraction level, so noise is multiplicative.
-    float pNoise = (random(-100, 101) / 100.0f) * contractionFloat * CONTRACTION_NOISE;
+    q16_t pNoise = noise(q16_mul(contraction, CONTRACTION_NOISE));
 
     // Assemble the raw pressure reading
-    float rawPressure = SIM_BASELINE + contractionFloat + pNoise;
-    sim_pressure = constrain((int)rawPressure, 0, ADC_MAX);
+    int rawPressure = SIM_BASELINE + q16_to_int(contraction + pNoise);
+    sim_pressure = constrain(rawPressure, 0, ADC_MAX);
 
-    // Feed into running average at the same sub-frequency as the 
-    // real system (6Hz = every RA_TICK_PERIOD ticks).
-    // This is identical to how update_pressure() works in pressure.cpp.
-    if (simTickCount % RA_TICK_PERIOD == 0)
-    {
-        simRA.addValue(sim_pressure);
-        sim_avg_pressure = (int)simRA.getAverage();
-    }
+    // Feed the baseline every tick, the same way the sampler ISR
+    // feeds the real one every sample.
+    sim_avg_pressure = simBaseline.update(sim_pressure);
 
     // ── EDGE DETECTION ─────────────────────────────────────────
     // Edge detection — same logic as the real AUTO mode:
     //   if (pressure - averagePressure > pressureLimit)
     if (delta >= sim_pressure_limit)
     {
-        cooldownTicks = random(COOLDOWN_MIN_TICKS, COOLDOWN_MAX_TICKS + 1);
-        motorFloat = 0;
+        cooldownTicks = hal_random(COOLDOWN_MIN_TICKS, COOLDOWN_MAX_TICKS + 1);
+        motorLevel = 0;
         edgeJustFired = true;
     }
     // ── 2. HEART RATE ──────────────────────────────────────────────
@@ -363,8 +378,8 @@ void sim_tick()
     //   base = lerp(BPM_RESTING, BPM_ELEVATED, arousal / threshold)
     //   bpm = base + random.randint(-1, 1)
 
-    int baseBpm = BPM_RESTING + (int)(arousalFraction * (BPM_ELEVATED - BPM_RESTING));
-    sim_bpm = constrain(baseBpm + random(-1, 2), BPM_RESTING - 3, BPM_ELEVATED + 3);
+    int baseBpm = BPM_RESTING + q16_to_int(q16_mul_int(arousalFraction, BPM_ELEVATED - BPM_RESTING));
+    sim_bpm = constrain(baseBpm + hal_random(-1, 2), BPM_RESTING - 3, BPM_ELEVATED + 3);
 
     // ── 3. BEAT DETECTION ──────────────────────────────────────────
     //
@@ -406,9 +421,9 @@ void sim_tick()
     // something no other simulated channel captures.
 
     // Tonic: sluggishly track a target derived from arousal level.
-    float tonicTarget = GSR_TONIC_FLOOR 
-                      + arousalFraction * (GSR_TONIC_CEILING - GSR_TONIC_FLOOR);
-    gsrTonic += GSR_TONIC_ALPHA * (tonicTarget - gsrTonic);
+    q16_t tonicTarget = GSR_TONIC_FLOOR 
+                      + q16_mul(arousalFraction, GSR_TONIC_CEILING - GSR_TONIC_FLOOR);
+    gsrTonic += q16_mul(GSR_TONIC_ALPHA, tonicTarget - gsrTonic);
 
     // Phasic: spike on edge, then decay exponentially.
     // 'edgeJustFired' is set to true in the edge detection block above,
@@ -417,13 +432,12 @@ void sim_tick()
         gsrPhasic += GSR_PHASIC_KICK;
         edgeJustFired = false;  // Consume the event
     }
-    gsrPhasic *= GSR_PHASIC_DECAY;
+    gsrPhasic = q16_mul(gsrPhasic, GSR_PHASIC_DECAY);
 
     // Combine with noise and clamp
-    float gsrNoise = (random(-100, 101) / 100.0f) * GSR_NOISE_RANGE;
-    float gsrRaw = gsrTonic + gsrPhasic + gsrNoise;
+    q16_t gsrRaw = gsrTonic + gsrPhasic + noise(GSR_NOISE_RANGE);
 
-    // Publish
-    sim_gsr        = constrain(gsrRaw, 0.0f, 1.0f);
-    sim_gsr_phasic = constrain(gsrPhasic, 0.0f, 1.0f);
+    // Publish (as floats — the displays scale them to pixels)
+    sim_gsr        = q16_to_float(q16_clamp(gsrRaw, 0, Q16_ONE));
+    sim_gsr_phasic = q16_to_float(q16_clamp(gsrPhasic, 0, Q16_ONE));
 }
\ No newline at end of file
@@ -1,142 +1,122 @@
-// state.cpp — State machine implementation
+// state.cpp — Operational mode table, dispatcher and transitions
 
 #include "state.h"
 #include "config.h"
 #include "globals.h"
 #include "modes.h"
 #include "motor.h"
-#include "leds.h"
-
-#include <EEPROM.h>
-#include "FastLED.h"
-#include <list>
-
-const uint8_t modeList[] = {STANDBY, MANUAL, AUTO, OPT_SPEED, OPT_PRES, OPT_USER_MODE};
-const int modeCount = sizeof(modeList) / sizeof(modeList[0]);  // = 6
-
-void run_state_machine(uint8_t state) {
-    switch (state) {
-        case MANUAL:      run_manual();           break;
-        case AUTO:        run_auto();             break;
-        case OPT_SPEED:   run_opt_speed();        break;
-        case OPT_RAMPSPD: run_opt_rampspd();      break;
-        case OPT_BEEP:    run_opt_beep();         break;
-        case OPT_PRES:    run_opt_pres();         break;
-        case OPT_USER_MODE: run_opt_userModeChange(); break;
-        case STANDBY:     run_standby();          break;
-        default:          run_standby();          break;
-    }
+#include "edge_guard.h"
+
+// ════════════════════════════════════════════════════════════════════════
+// Enter / exit hooks
+// ════════════════════════════════════════════════════════════════════════
+// All the one-time setup that used to be scattered through main.cpp's
+// nav handling (and the old commented-out set_state()). The encoder
+// counts 4 pulses per click, and each mode reads it with encLimitRead()
+// in its own range — so "put the knob back" means writing the click
+// position × 4.
+
+static void stop_motor()
+{
+    motorSpeed = 0;
+    motor_write(0);
 }
 
-uint8_t get_next_state(uint8_t state) {
-    // Find current mode's index (like Python's list.index(value))
-    int currentIndex = 0;
-    for (int i = 0; i < modeCount; i++) {
-        if (modeList[i] == state) {
-            currentIndex = i;
-            break;
-        }
-    }
-
-    // Move to next
-    int nextIndex = (currentIndex + 1) % modeCount;
-    state = modeList[nextIndex];
-
-    return state;
+static void enter_manual()
+{
+    // Always start from zero — never jump straight to the speed the
+    // knob happened to be left at.
+    myEnc.write(0);
+    stop_motor();
 }
 
-uint8_t get_previous_state(uint8_t state) {
-    // Find current mode's index (like Python's list.index(value))
-    int currentIndex = 0;
-    for (int i = 0; i < modeCount; i++) {
-        if (modeList[i] == state) {
-            currentIndex = i;
-            break;
-        }
-    }
-
-    // Move to previous
-    int nextIndex = (currentIndex - 1 + modeCount) % modeCount;
-    state = modeList[nextIndex];
-
-    return state;
+static void enter_auto()
+{
+    // sensitivity is the raw encoder position run_auto() last used
+    myEnc.write(sensitivity);
+    stop_motor();
 }
 
-// uint8_t set_state(uint8_t state) {
-
-//     if (btnState == BTN_NONE) {
-//         return state;
-//     }
-
-//     // --- Very long press: power off ---
-//     if (btnState == BTN_V_LONG) {
-//         Serial.println("power off");
-//         fill_gradient_RGB(leds, 0, CRGB::Black, NUM_LEDS - 1, CRGB::Black);
-//         FastLED.show();
-//         motor_write(0);
-//         beep_motor(2093, 1396, 1047);
-//         motor_write(0);
-//         // Block until button is released, then wait for next press
-//         while (!digitalRead(ENC_SW)) delay(1);
-//         beep_motor(1047, 1396, 2093);
-//         return MANUAL;
-//     }
-
-//     // --- Short press: cycle between primary modes ---
-//     if (btnState == BTN_SHORT) {
-//         switch (state) {
-//             case MANUAL:
-//                 myEnc.write(sensitivity);
-//                 motorSpeed = 0;
-//                 return AUTO;
-
-//             case AUTO:
-//                 myEnc.write(0);
-//                 motorSpeed = 0;
-//                 EEPROM.update(SENSITIVITY_ADDR, sensitivity);
-//                 return MANUAL;
-
-//             case OPT_SPEED:
-//                 myEnc.write(0);
-//                 EEPROM.update(MAX_SPEED_ADDR, maxMotorSpeed);
-//                 motorSpeed = 0;
-//                 motor_write(0);
-//                 return OPT_PRES;
-
-//             case OPT_BEEP:
-//                 myEnc.write(0);
-//                 return OPT_PRES;
-
-//             case OPT_PRES:
-//                 myEnc.write(map(maxMotorSpeed, 0, 255, 0, 4 * NUM_LEDS));
-//                 return OPT_USER_MODE;
-
-//             case OPT_USER_MODE:
-//                 myEnc.write(map(userMode, 1, userModeTotal, 0, 4 * NUM_LEDS));
-//                 return OPT_SPEED;
-//         }
-//     }
-
-//     // --- Long press: enter/exit settings ---
-//     if (btnState == BTN_LONG) {
-//         switch (state) {
-//             case MANUAL:
-//             case AUTO:
-//                 myEnc.write(map(maxMotorSpeed, 0, 255, 0, 4 * NUM_LEDS));
-//                 return OPT_SPEED;
-
-//             case OPT_SPEED:
-//             case OPT_RAMPSPD:
-//             case OPT_BEEP:
-//             case OPT_PRES:
-//                 myEnc.write(0);
-//                 return MANUAL;
-
-//             case OPT_USER_MODE:
-//                 myEnc.write(map(userMode, 1, userModeTotal, 0, 4 * NUM_LEDS));
-//                 return AUTO;
-//         }
-//     }
-
-//     return MANUAL;
-// }
\ No newline at end of file
+static void exit_auto()
+{
+    // The ISR edge guard only belongs to AUTO. Any other mode gets it
+    // switched off so it can't cut a manually-set motor speed.
+    edge_guard_disarm();
+    stop_motor();
+}
+
+static void enter_opt_speed()
+{
+    // Inverse of run_opt_speed()'s map(), so the knob starts at the
+    // current setting instead of overwriting it
+    myEnc.write(map(maxMotorSpeed, 0, MOT_MAX, 0, NUM_LEDS - 1) * 4);
+}
+
+static void enter_opt_user_mode()
+{
+    myEnc.write(userMode * 4);
+}
+
+// ════════════════════════════════════════════════════════════════════════
+// The table
+// ════════════════════════════════════════════════════════════════════════
+// One row per mode constant, in constant order (the static_assert
+// below checks). The prev/next columns are the nav cycle:
+//
+//   STANDBY → MANUAL → AUTO → SPEED → PRES → USER MODE → (back round)
+//
+// RAMP and BEEP aren't implemented yet, so nothing links to them.
+
+static constexpr ModeDescriptor MODES[] = {
+    //  id             tick                    enter                 exit          label      title        colour    prev           next
+    { STANDBY,       run_standby,            stop_motor,           nullptr,      "STANDBY", "Standby",   0x000000, OPT_USER_MODE, MANUAL        },
+    { MANUAL,        run_manual,             enter_manual,         stop_motor,   "MANUAL",  "Manual",    0xFF0000, STANDBY,       AUTO          },
+    { AUTO,          run_auto,               enter_auto,           exit_auto,    "AUTO",    "Auto",      0x0000FF, MANUAL,        OPT_SPEED     },
+    { OPT_SPEED,     run_opt_speed,          enter_opt_speed,      stop_motor,   "SPEED",   "Set Speed", 0x008000, AUTO,          OPT_PRES      },
+    { OPT_RAMPSPD,   run_opt_rampspd,        nullptr,              nullptr,      "RAMP",    "Set Ramp",  0x008000, OPT_SPEED,     OPT_PRES      },
+    { OPT_BEEP,      run_opt_beep,           nullptr,              nullptr,      "BEEP",    "Settings",  0x008000, OPT_SPEED,     OPT_PRES      },
+    { OPT_PRES,      run_opt_pres,           nullptr,              nullptr,      "PRES",    "Pressure",  0xFFFFFF, OPT_SPEED,     OPT_USER_MODE },
+    { OPT_USER_MODE, run_opt_userModeChange, enter_opt_user_mode,  nullptr,      "MODE",    "User Mode", 0xFF0000, OPT_PRES,      STANDBY       },
+};
+
+constexpr uint8_t MODE_COUNT = sizeof(MODES) / sizeof(MODES[0]);
+
+constexpr bool modes_in_order(uint8_t i = 0)
+{
+    return i >= MODE_COUNT || (MODES[i].id == STANDBY + i && modes_in_order(i + 1));
+}
+static_assert(modes_in_order(), "MODES[] rows must be in mode-constant order, starting at STANDBY");
+
+// ════════════════════════════════════════════════════════════════════════
+// Public API
+// ════════════════════════════════════════════════════════════════════════
+
+const ModeDescriptor& mode_descriptor(uint8_t mode)
+{
+    uint8_t i = mode - STANDBY;     // Wraps to 255 for anything below STANDBY
+    return MODES[i < MODE_COUNT ? i : 0];
+}
+
+void run_state_machine(uint8_t state)
+{
+    mode_descriptor(state).tick();
+}
+
+void state_enter(uint8_t state)
+{
+    const ModeDescriptor& m = mode_descriptor(state);
+    if (m.enter) m.enter();
+}
+
+void state_exit(uint8_t state)
+{
+    const ModeDescriptor& m = mode_descriptor(state);
+    if (m.exit) m.exit();
+}
+
+uint8_t state_transition(uint8_t from, uint8_t to)
+{
+    state_exit(from);
+    state_enter(to);
+    return to;
+}
@@ -0,0 +1,130 @@
+// telemetry.cpp — Binary record builder and USB batcher
+//
+// ═══════════════════════════════════════════════════════════════════════
+// DOUBLE-BUFFERED STAGING
+// ═══════════════════════════════════════════════════════════════════════
+//
+//   sample ring ──→ [ batch A: filling ]      ← records are built here
+//                   [ batch B: waiting  ] ──→ Serial.write() (one call)
+//
+// Records go into the batch being filled. Once it's full (or at the 
+// end of the tick), it's handed over, and the other batch becomes the 
+// one being filled. The handed-over batch goes out in ONE 
+// Serial.write() as soon as the USB stack has room for all of it, so 
+// the host gets whole batches instead of a trickle of tiny packets.
+//
+// If the host stops reading, both batches fill up. We then throw away 
+// the waiting batch rather than block — a stalled serial monitor must 
+// never stall the device.
+
+#include "telemetry.h"
+#include "config.h"
+#include "globals.h"
+#include "pressure_sampler.h"
+#include "crc16.h"
+
+// 32 records × 22 bytes = 704 bytes per batch. A 60Hz tick produces 
+// ~17 records, so one batch usually covers a tick or two.
+constexpr uint8_t BATCH_RECORDS = 32;
+
+struct TelemetryBatch {
+    TelemetryRecord records[BATCH_RECORDS];
+    uint8_t count;
+};
+
+static TelemetryBatch batches[2];
+static uint8_t fillIndex = 0;        // Batch currently being filled
+static bool    sendPending = false;  // Other batch is waiting to go out
+
+static uint32_t sampleCursor = 0;
+static uint16_t seq = 0;
+static uint32_t dropped = 0;
+
+// Try to push the waiting batch out. Only writes when the whole batch 
+// fits, so it goes as one transfer and never blocks.
+static void try_send()
+{
+    if (!sendPending) return;
+
+    TelemetryBatch& b = batches[fillIndex ^ 1];
+    size_t bytes = b.count * sizeof(TelemetryRecord);
+    if ((size_t)Serial.availableForWrite() < bytes) return;
+
+    Serial.write((const uint8_t*)b.records, bytes);
+    b.count = 0;
+    sendPending = false;
+}
+
+// Current batch is ready — swap it over to the sending side.
+static void hand_over()
+{
+    if (batches[fillIndex].count == 0) return;
+
+    if (sendPending) {
+        // Previous batch still hasn't gone. Drop it to make room.
+        dropped += batches[fillIndex ^ 1].count;
+        batches[fillIndex ^ 1].count = 0;
+    }
+    fillIndex ^= 1;
+    sendPending = true;
+    try_send();
+}
+
+void telemetry_start()
+{
+    sampleCursor = pressure_sampler_count();
+    batches[0].count = 0;
+    batches[1].count = 0;
+    fillIndex = 0;
+    sendPending = false;
+}
+
+void telemetry_stream(uint8_t mode)
+{
+    // Flush anything left over from last tick first
+    try_send();
+
+    // Main-loop values, sampled once and repeated in every record
+    uint16_t limit    = (uint16_t)pressureLimit;
+    uint8_t  motor    = (uint8_t)constrain((int)motorSpeed, 0, 255);
+    uint16_t cooldown = (uint16_t)minimumcooldown;
+
+    PressureSample samples[BATCH_RECORDS];
+    while (true) {
+        uint32_t firstIndex = sampleCursor;
+        uint16_t n = pressure_sampler_read(sampleCursor, samples, BATCH_RECORDS);
+        if (n == 0) break;
+
+        // If we fell behind the ring, the cursor skipped forward.
+        // Work out the real index of the first sample we got.
+        uint32_t base = sampleCursor - n;
+        dropped += base - firstIndex;
+
+        for (uint16_t i = 0; i < n; i++) {
+            TelemetryBatch& b = batches[fillIndex];
+            TelemetryRecord& r = b.records[b.count];
+
+            r.sync     = TELEMETRY_SYNC;
+            r.seq      = seq++;
+            r.sample   = base + i;
+            r.pressure = samples[i].raw;
+            r.baseline = samples[i].baseline;
+            r.delta    = (int16_t)(samples[i].raw - samples[i].baseline);
+            r.limit    = limit;
+            r.motor    = motor;
+            r.mode     = mode;
+            r.cooldown = cooldown;
+            r.crc      = crc16_ccitt((const uint8_t*)&r, offsetof(TelemetryRecord, crc));
+
+            if (++b.count >= BATCH_RECORDS) hand_over();
+        }
+    }
+
+    // Send the partial batch too, so latency stays at one tick
+    hand_over();
+}
+
+uint32_t telemetry_dropped()
+{
+    return dropped;
+}
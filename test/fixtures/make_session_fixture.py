@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+"""Build the SESS fixture the native tests replay.
+
+Writes SESS0001.BIN next to this script, and the same bytes as a C
+array in test/test_native/session_fixture.h. The encoder below follows
+session_recorder.cpp record for record; the format is described in
+include/session_format.h.
+
+Eight seconds at 1kHz of a resting baseline with sensor noise, two
+clenches (one slow, one abrupt enough to need absolute samples), the
+knob moving the limit, an edge, a run of lost samples, a sector the
+card dropped and one sector damaged after it was sealed. Re-run it only
+to change the fixture; the golden values in test_session.cpp then need
+updating to match.
+
+    python3 test/fixtures/make_session_fixture.py
+"""
+
+import binascii
+import os
+import random
+import struct
+
+SECTOR = 512
+HEADER = struct.Struct("<IIIIHHHhBBHH")
+PAYLOAD = SECTOR - HEADER.size
+MAGIC = 0x3153584E
+MAX_RECORD = 8
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+
+class Encoder:
+    def __init__(self):
+        self.sectors = []
+        self.index = 0
+        self.pressure = self.baseline = 0
+        self.limit, self.motor_q4, self.mode, self.user_mode = 300, 0, 2, 3
+        self.sample = 0
+        self.begin()
+
+    def begin(self):
+        self.key = (self.pressure, self.baseline, self.limit, self.motor_q4,
+                    self.mode, self.user_mode)
+        self.first = self.sample
+        self.payload = bytearray()
+
+    def seal(self, drop=False):
+        p, b, l, m, mode, um = self.key
+        head = HEADER.pack(MAGIC, self.index, self.first, self.first, p, b, l, m,
+                           mode, um, len(self.payload), 0)
+        crc = binascii.crc_hqx(head[:-2] + bytes(self.payload), 0xFFFF)
+        head = head[:-2] + struct.pack("<H", crc)
+        body = head + bytes(self.payload)
+        if not drop:
+            self.sectors.append(body + bytes(SECTOR - len(body)))
+        self.index += 1
+        self.begin()
+
+    def room(self):
+        if len(self.payload) + MAX_RECORD > PAYLOAD:
+            self.seal()
+
+    def put(self, data):
+        self.room()
+        self.payload += data
+
+    def control(self, limit, motor_q4):
+        self.room()       # Before the values change, as in the recorder
+        self.limit, self.motor_q4 = limit, motor_q4
+        self.payload += struct.pack("<BBHhBB", 0x80, 0x02, limit, motor_q4,
+                                    self.mode, self.user_mode)
+
+    def edge(self, cooldown):
+        self.put(struct.pack("<BBH", 0x80, 0x03, cooldown))
+
+    def gap(self, lost):
+        self.put(struct.pack("<BBH", 0x80, 0x04, lost))
+        self.sample += lost
+
+    def add(self, raw, baseline):
+        dp, db = raw - self.pressure, baseline - self.baseline
+        if -128 < dp <= 127 and -128 <= db <= 127:
+            self.put(struct.pack("<bb", dp, db))
+        else:
+            self.put(struct.pack("<BBHH", 0x80, 0x01, raw, baseline))
+        self.pressure, self.baseline = raw, baseline
+        self.sample += 1
+
+
+def main():
+    rng = random.Random(7)
+    enc = Encoder()
+    enc.pressure = enc.baseline = 1800
+    base = 1800.0
+
+    for t in range(8000):
+        rise = 0
+        if 1500 <= t < 3000:                 # Slow clench, past the limit
+            rise = 340 * min(1.0, (t - 1500) / 900)
+        elif 5000 <= t < 5600:               # Abrupt one
+            rise = 420
+        raw = int(1800 + rise + rng.randint(-3, 3))
+        base += (raw - base) / 1024
+        baseline = int(base)
+
+        if t == 700:
+            enc.control(260, 40 * 16)
+        if t == 2400:
+            enc.edge(12)
+            enc.control(260, 0)
+        if t == 4000:
+            enc.gap(25)
+        if t == 6200:
+            enc.seal(drop=True)              # The card fell behind
+        enc.add(raw, baseline)
+    enc.seal()
+
+    # Damage one sector after sealing — its CRC no longer matches
+    damaged = bytearray(enc.sectors[9])
+    damaged[HEADER.size + 10] ^= 0x5A
+    enc.sectors[9] = bytes(damaged)
+
+    data = b"".join(enc.sectors)
+    with open(os.path.join(HERE, "SESS0001.BIN"), "wb") as f:
+        f.write(data)
+
+    lines = [
+        "// session_fixture.h — SESS0001.BIN as a C array",
+        "//",
+        "// Generated by test/fixtures/make_session_fixture.py, which describes",
+        "// what's in it. Don't edit by hand.",
+        "",
+        "#pragma once",
+        "",
+        "#include \"hal.h\"",
+        "",
+        "static const uint8_t SESSION_FIXTURE[%d] = {" % len(data),
+    ]
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+    lines.append("};")
+    path = os.path.join(HERE, "..", "test_native", "session_fixture.h")
+    with open(path, "w") as f:
+        f.write("\n".join(lines) + "\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,49 @@
+// fakes.cpp — Host stand-ins for the display drivers
+//
+// Only the calls fire_effect.cpp and matrix_graph.cpp make are here. 
+// The LCD is never busy and "streams" each frame synchronously, the 
+// way the DMA interrupt would call the renderer strip by strip. The 
+// matrix just keeps its framebuffer.
+
+#include "native_tests.h"
+#include "colour_lcd.h"
+#include "HT1632C_Display.h"
+
+uint16_t fake_lcd_frame[LCD_PIXEL_COUNT];
+uint32_t fake_lcd_frames = 0;
+
+bool lcd_frame_busy()
+{
+    return false;
+}
+
+bool lcd_stream_frame_async(LcdStripRenderFn render)
+{
+    for (uint16_t y = 0; y < LCD_HEIGHT; y += LCD_STRIP_LINES) {
+        uint16_t lines = LCD_HEIGHT - y < LCD_STRIP_LINES ? LCD_HEIGHT - y : LCD_STRIP_LINES;
+        render(fake_lcd_frame + (uint32_t)y * LCD_WIDTH, y, lines);
+    }
+    fake_lcd_frames++;
+    return true;
+}
+
+HT1632C_Display::HT1632C_Display(uint8_t pinCS, uint8_t pinWR, uint8_t pinDATA)
+    : _pinCS(pinCS), _pinWR(pinWR), _pinDATA(pinDATA)
+{
+    memset(_buffer, 0, sizeof(_buffer));
+}
+
+void HT1632C_Display::setColumn(uint8_t col, uint8_t data)
+{
+    if (col < HT1632C_WIDTH) _buffer[col] = data;
+}
+
+bool HT1632C_Display::flush()
+{
+    return true;
+}
+
+uint8_t* HT1632C_Display::getBuffer()
+{
+    return _buffer;
+}
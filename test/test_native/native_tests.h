@@ -0,0 +1,78 @@
+// native_tests.h — Shared pieces of the host test suite
+//
+// The suite builds the control core's pure modules (see [env:native] 
+// in platformio.ini) and checks them two ways:
+//
+//   Golden outputs   A fixed input (a seeded simulated session, a 
+//                    seeded fire) must give exactly the output it 
+//                    gave when the golden value was taken. A change 
+//                    to a kernel that's meant to be a pure speed-up 
+//                    has to leave these alone.
+//   Benchmarks       Per-call cost of the hot kernels, printed for 
+//                    comparing runs, and failed only past a generous 
+//                    ceiling so a slow CI machine doesn't trip them.
+//
+// When a change is MEANT to alter an output, run the suite, check the 
+// new behaviour by other means, and update the golden value with the 
+// one the failure prints.
+
+#pragma once
+
+#include "hal.h"
+
+// FNV-1a over a byte range — a compact fingerprint for outputs too 
+// big to list (a heat grid, a whole session of baselines). In Python:
+//
+//   h = 0x811C9DC5
+//   for b in data: h = ((h ^ b) * 0x01000193) & 0xFFFFFFFF
+inline uint32_t fnv1a(const void* data, size_t bytes, uint32_t h = 0x811C9DC5u)
+{
+    const uint8_t* p = (const uint8_t*)data;
+    for (size_t i = 0; i < bytes; i++) {
+        h ^= p[i];
+        h *= 0x01000193u;
+    }
+    return h;
+}
+
+// ── Link seams (fakes.cpp) ─────────────────────────────────────────────
+// The fire and graph kernels talk to the LCD and LED matrix drivers, 
+// which only exist on the device. fakes.cpp stands in for the calls 
+// they make: the LCD "streams" a frame by rendering every strip into 
+// fake_lcd_frame at once.
+extern uint16_t fake_lcd_frame[];
+extern uint32_t fake_lcd_frames;        // Frames streamed so far
+
+// ── Test cases ─────────────────────────────────────────────────────────
+// test_golden.cpp
+void test_sim_session_golden();
+void test_baseline_ema_golden();
+void test_baseline_window_golden();
+void test_baseline_median_golden();
+void test_fire_step_golden();
+void test_fire_frame_golden();
+void test_matrix_column_golden();
+
+// test_session.cpp
+void test_session_sectors();
+void test_session_decode_golden();
+
+// test_policy.cpp
+void test_auto_limit_knob();
+void test_auto_limit_adaptive_golden();
+void test_auto_cooldown_modes();
+void test_auto_cooldown_creep();
+void test_auto_cooldown_sensitise();
+
+// test_heartbeat.cpp
+void test_heartbeat_steady();
+void test_heartbeat_flat();
+
+// test_bench.cpp
+void bench_baseline_update();
+void bench_noise_floor_update();
+void bench_session_decode();
+void bench_sim_tick();
+void bench_fire_step();
+void bench_fire_render_frame();
+void bench_matrix_graph_redraw();
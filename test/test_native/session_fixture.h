@@ -0,0 +1,1099 @@
+// session_fixture.h — SESS0001.BIN as a C array
+//
+// Generated by test/fixtures/make_session_fixture.py, which describes
+// what's in it. Don't edit by hand.
+
+#pragma once
+
+#include "hal.h"
+
+static const uint8_t SESSION_FIXTURE[17408] = {
+    0x4E, 0x58, 0x53, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2C, 0x01, 0x00, 0x00, 0x02, 0x03, 0xDC, 0x01, 0x46, 0xFB, 0xFF, 0xFF,
+    0xFF, 0x00, 0x02, 0x00, 0x02, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x06, 0x00, 0xFE, 0x00, 0xFC, 0x00,
+    0x02, 0x00, 0x02, 0x00, 0xFC, 0x00, 0x04, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0xFD, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x04, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x06, 0x00,
+    0xFE, 0x00, 0xFC, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFC, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x04, 0x00, 0x02, 0x00, 0xFB, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x03, 0x00, 0xFC, 0x00, 0x04, 0x00, 0xFE, 0x00, 0x02, 0x00,
+    0x02, 0x00, 0xFF, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0xFC, 0x00,
+    0x01, 0x00, 0xFE, 0x00, 0x04, 0x00, 0x01, 0x00, 0xFB, 0x00, 0x04, 0x00, 0xFC, 0x00, 0x04, 0x00,
+    0xFD, 0x00, 0x02, 0x00, 0x02, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xFC, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x05, 0x00, 0xFB, 0x00, 0x04, 0x00,
+    0x01, 0x00, 0xFB, 0x00, 0xFF, 0x00, 0x04, 0x00, 0xFE, 0x00, 0x02, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0x03, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x02, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x04, 0x00, 0xFF, 0x00,
+    0xFE, 0x00, 0x05, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x05, 0x00,
+    0xFB, 0x00, 0x06, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0xFD, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x02, 0x00, 0xFD, 0x00, 0xFD, 0x00,
+    0x06, 0x00, 0xFA, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x03, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x01, 0x00, 0xFD, 0x00,
+    0xFF, 0x00, 0x03, 0x00, 0xFE, 0x00, 0x02, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0x03, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x03, 0x00, 0xFC, 0x00, 0x03, 0x00, 0xFD, 0x00, 0x01, 0x00, 0x05, 0x00, 0xFC, 0x00,
+    0xFF, 0x00, 0x04, 0x00, 0xFC, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0xFD, 0x00, 0xFD, 0x00,
+    0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x05, 0x00, 0xFD, 0x00,
+    0x03, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x03, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xFE, 0x00,
+    0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xFC, 0x00,
+    0xFF, 0x00, 0x03, 0x00, 0x03, 0x00, 0xFE, 0x00, 0xFD, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFE, 0x00,
+    0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFF, 0x00,
+    0x04, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x00,
+    0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFE, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x03, 0x00, 0x02, 0x00, 0xFE, 0x00, 0xFD, 0x00,
+    0x01, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x02, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x02, 0x00, 0x02, 0x00,
+    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x58, 0x53, 0x31, 0x01, 0x00, 0x00, 0x00, 0xEE, 0x00, 0x00, 0x00, 0xEE, 0x00, 0x00, 0x00,
+    0x06, 0x07, 0x07, 0x07, 0x2C, 0x01, 0x00, 0x00, 0x02, 0x03, 0xDC, 0x01, 0x16, 0x2F, 0x03, 0x00,
+    0xFC, 0x00, 0x02, 0x00, 0x02, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x06, 0x00, 0xFB, 0x00, 0x03, 0x00,
+    0xFF, 0x00, 0xFE, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x01, 0x00,
+    0xFD, 0x00, 0x00, 0x00, 0x06, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFE, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x05, 0x00, 0xFD, 0x00, 0x03, 0x00, 0xFD, 0x00, 0x01, 0x00,
+    0x03, 0x00, 0xFF, 0x00, 0xFC, 0x00, 0x03, 0x00, 0xFC, 0x00, 0x01, 0x00, 0x03, 0x00, 0xFE, 0x00,
+    0xFF, 0x00, 0x04, 0x00, 0xFF, 0x00, 0xFC, 0x00, 0x06, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x03, 0x00,
+    0x01, 0x00, 0xFA, 0x00, 0x05, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x02, 0x00, 0xFE, 0x00, 0xFF, 0x00,
+    0x01, 0x00, 0x04, 0x00, 0xFB, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFE, 0x00, 0xFE, 0x00,
+    0x03, 0x00, 0xFC, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x00,
+    0x05, 0x00, 0xFB, 0x00, 0x05, 0x00, 0xFD, 0x00, 0x02, 0x00, 0x01, 0x00, 0xFB, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x06, 0x00, 0xFC, 0x00,
+    0x01, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x04, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x01, 0x00, 0x03, 0x00,
+    0xFF, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x02, 0x00,
+    0xFE, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFA, 0x00,
+    0x03, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x04, 0x00, 0xFF, 0x00, 0xFB, 0x00, 0x06, 0x00, 0xFF, 0x00,
+    0xFB, 0x00, 0x03, 0x00, 0x03, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFB, 0x00, 0x02, 0x00, 0xFE, 0x00,
+    0x02, 0x00, 0x03, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0x06, 0x00, 0xFF, 0x00, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFB, 0x00, 0x05, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x01, 0x00, 0x03, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xFF, 0x00, 0xFC, 0x00, 0x03, 0x00,
+    0x02, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x02, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0xFD, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x06, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x04, 0x00,
+    0x01, 0x00, 0xFC, 0x00, 0x02, 0x00, 0x03, 0x00, 0xFB, 0x00, 0x05, 0x00, 0x00, 0x00, 0xFB, 0x00,
+    0xFF, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x05, 0x00, 0xFE, 0x00,
+    0xFE, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xFB, 0x00, 0xFF, 0x00, 0x05, 0x00,
+    0xFD, 0x00, 0x01, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x02, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x03, 0x00,
+    0xFE, 0x00, 0xFD, 0x00, 0x03, 0x00, 0xFD, 0x00, 0x03, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x06, 0x00,
+    0xFD, 0x00, 0x03, 0x00, 0xFB, 0x00, 0x03, 0x00, 0xFC, 0x00, 0x06, 0x00, 0x00, 0x00, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0xFB, 0x00, 0x04, 0x00, 0xFC, 0x00,
+    0x02, 0x00, 0x03, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0xFA, 0x00, 0x04, 0x00, 0xFC, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x58, 0x53, 0x31, 0x02, 0x00, 0x00, 0x00, 0xDC, 0x01, 0x00, 0x00, 0xDC, 0x01, 0x00, 0x00,
+    0x06, 0x07, 0x07, 0x07, 0x2C, 0x01, 0x00, 0x00, 0x02, 0x03, 0xDC, 0x01, 0x70, 0x59, 0x01, 0x00,
+    0xFE, 0x00, 0x06, 0x00, 0xFA, 0x00, 0x04, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x06, 0x00,
+    0xFA, 0x00, 0x03, 0x00, 0xFF, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00,
+    0x04, 0x00, 0xFD, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x01, 0x00,
+    0xFD, 0x00, 0x04, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x05, 0x00, 0xFD, 0x00,
+    0xFE, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x03, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x05, 0x00,
+    0xFC, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x01, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x04, 0x00, 0xFA, 0x00,
+    0x06, 0x00, 0xFB, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x01, 0x00,
+    0xFF, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x04, 0x00, 0xFB, 0x00, 0x03, 0x00, 0x00, 0x00, 0xFE, 0x00,
+    0x04, 0x00, 0x01, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x04, 0x00, 0xFE, 0x00, 0x01, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x05, 0x00, 0xFD, 0x00,
+    0xFE, 0x00, 0x02, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFB, 0x00, 0x03, 0x00,
+    0xFF, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x02, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x06, 0x00,
+    0xFB, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x06, 0x00, 0xFB, 0x00,
+    0x01, 0x00, 0x04, 0x00, 0xFB, 0x00, 0x05, 0x00, 0xFD, 0x00, 0x03, 0x00, 0xFF, 0x00, 0x01, 0x00,
+    0xFC, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x02, 0x00,
+    0xFD, 0x00, 0xFE, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x06, 0x00, 0xFF, 0x00, 0xFC, 0x00, 0x02, 0x00,
+    0xFD, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x05, 0x00, 0xFB, 0x00, 0x06, 0x00, 0xFC, 0x00, 0xFE, 0x00,
+    0x04, 0x00, 0x02, 0x00, 0xFB, 0x00, 0xFF, 0x00, 0x02, 0x00, 0x04, 0x00, 0xFA, 0x00, 0x03, 0x00,
+    0xFD, 0x00, 0x02, 0x00, 0x02, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x02, 0x00, 0xFD, 0x00, 0xFF, 0x00,
+    0x04, 0x00, 0x01, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0xFD, 0x00, 0x02, 0x00, 0x02, 0x00, 0xFB, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0xFA, 0x00,
+    0x02, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFD, 0x00,
+    0x03, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x05, 0x00, 0x01, 0x00, 0xFF, 0x00,
+    0xFE, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x01, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x01, 0x00, 0xFE, 0x00,
+    0x03, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x05, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFC, 0x00, 0x02, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x06, 0x00, 0xFB, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x01, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x80, 0x02,
+    0x04, 0x01, 0x80, 0x02, 0x02, 0x03, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x03, 0x00,
+    0xFE, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x58, 0x53, 0x31, 0x03, 0x00, 0x00, 0x00, 0xC6, 0x02, 0x00, 0x00, 0xC6, 0x02, 0x00, 0x00,
+    0x06, 0x07, 0x07, 0x07, 0x04, 0x01, 0x80, 0x02, 0x02, 0x03, 0xDC, 0x01, 0x2A, 0x7A, 0x04, 0x00,
+    0xFD, 0x00, 0xFE, 0x00, 0x03, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0xFD, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x02, 0x00,
+    0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x02, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x03, 0x00,
+    0xFF, 0x00, 0x02, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0xFA, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0xFA, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0xFC, 0x00,
+    0x03, 0x00, 0xFD, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0xFE, 0x00,
+    0xFF, 0x00, 0x03, 0x00, 0xFC, 0x00, 0x03, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x01, 0x00, 0x03, 0x00,
+    0xFF, 0x00, 0x01, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0x01, 0x00, 0xFE, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xFE, 0x00, 0xFD, 0x00, 0x03, 0x00,
+    0x02, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x06, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0x03, 0x00,
+    0x03, 0x00, 0xFD, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x05, 0x00, 0xFB, 0x00, 0x05, 0x00, 0xFF, 0x00,
+    0x01, 0x00, 0xFC, 0x00, 0x02, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x03, 0x00, 0x03, 0x00, 0xFA, 0x00,
+    0x05, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x05, 0x00, 0xFF, 0x00, 0xFC, 0x00, 0x05, 0x00,
+    0x00, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x04, 0x00, 0xFA, 0x00, 0x06, 0x00, 0xFC, 0x00, 0xFF, 0x00,
+    0x04, 0x00, 0x01, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x03, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x04, 0x00, 0xFA, 0x00,
+    0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFD, 0x00,
+    0xFF, 0x00, 0x03, 0x00, 0xFD, 0x00, 0x03, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xFB, 0x00, 0x05, 0x00,
+    0xFC, 0x00, 0x04, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xFA, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x01, 0x00, 0xFE, 0x00,
+    0x03, 0x00, 0xFD, 0x00, 0x02, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x06, 0x00, 0xFE, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x04, 0x00, 0xFC, 0x00, 0x01, 0x00,
+    0x04, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0x00, 0x02, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x05, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFD, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x03, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x03, 0x00, 0xFC, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x58, 0x53, 0x31, 0x04, 0x00, 0x00, 0x00, 0xB4, 0x03, 0x00, 0x00, 0xB4, 0x03, 0x00, 0x00,
+    0x07, 0x07, 0x07, 0x07, 0x04, 0x01, 0x80, 0x02, 0x02, 0x03, 0xDC, 0x01, 0x8E, 0xDD, 0x01, 0x00,
+    0xFF, 0x00, 0xFE, 0x00, 0x06, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x02, 0x00, 0x04, 0x00, 0xFC, 0x00,
+    0x04, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x01, 0x00, 0x04, 0x00, 0xFB, 0x00, 0x05, 0x00, 0xFD, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0xFE, 0x00, 0xFC, 0x00,
+    0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0xFC, 0x00, 0x04, 0x00, 0xFA, 0x00, 0x02, 0x00, 0xFE, 0x00,
+    0x00, 0x00, 0x06, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x03, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x05, 0x00, 0xFC, 0x00, 0x04, 0x00, 0xFD, 0x00,
+    0xFD, 0x00, 0x06, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFD, 0x00,
+    0x04, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x05, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00,
+    0xFB, 0x00, 0x04, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x04, 0x00, 0xFD, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x01, 0x00, 0x02, 0x00, 0xFC, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0xFE, 0x00, 0xFD, 0x00, 0x01, 0x00, 0x04, 0x00, 0xFC, 0x00, 0xFF, 0x00,
+    0x01, 0x00, 0x03, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x02, 0x00, 0xFF, 0x00,
+    0x04, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x03, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0xFC, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0xFE, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x05, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x04, 0x00,
+    0xFA, 0x00, 0x03, 0x00, 0xFF, 0x00, 0x02, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x04, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x00, 0xFF, 0x00, 0x02, 0x00,
+    0xFF, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x03, 0x00, 0x02, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0xFD, 0x00, 0x01, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00,
+    0xFE, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x05, 0x00, 0xFA, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0xFB, 0x00, 0x06, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x04, 0x00, 0x02, 0x00, 0xFA, 0x00,
+    0x00, 0x00, 0x06, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x03, 0x00, 0xFC, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0xFD, 0x00, 0xFF, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x02, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x02, 0x00,
+    0x01, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFD, 0x00,
+    0x02, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x05, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x04, 0x00,
+    0xFE, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x58, 0x53, 0x31, 0x05, 0x00, 0x00, 0x00, 0xA2, 0x04, 0x00, 0x00, 0xA2, 0x04, 0x00, 0x00,
+    0x0A, 0x07, 0x07, 0x07, 0x04, 0x01, 0x80, 0x02, 0x02, 0x03, 0xDC, 0x01, 0x98, 0x45, 0x01, 0x00,
+    0xFB, 0x00, 0x02, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x03, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x03, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0xFE, 0x00, 0xFD, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x04, 0x00, 0xFE, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x05, 0x00, 0xFD, 0x00, 0x03, 0x00, 0xFE, 0x00, 0xFF, 0x00,
+    0x03, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x06, 0x00, 0xFC, 0x00, 0x03, 0x00, 0x01, 0x00,
+    0xFE, 0x00, 0xFC, 0x00, 0x01, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0xFB, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x01, 0x00, 0x04, 0x00, 0xFC, 0x00, 0xFE, 0x00,
+    0x04, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0xFB, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x04, 0x00,
+    0xFD, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x05, 0x00, 0xFB, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0xFD, 0x00, 0x03, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFE, 0x00, 0xFD, 0x00, 0x02, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0xFE, 0x00, 0x03, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x00, 0xFE, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x02, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x04, 0x00,
+    0x02, 0x00, 0xFB, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x01, 0x00,
+    0x02, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0xFE, 0x00, 0xFD, 0x00,
+    0x05, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x05, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFD, 0x00, 0xFD, 0x00,
+    0x03, 0x00, 0xFD, 0x00, 0x03, 0x00, 0xFD, 0x00, 0x06, 0x00, 0xFA, 0x00, 0x02, 0x00, 0xFF, 0x00,
+    0x04, 0x00, 0xFB, 0x00, 0x04, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0xFC, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0x00, 0x05, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x02, 0x00, 0xFF, 0x00, 0xFB, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0xFB, 0x00, 0xFF, 0x00, 0x03, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x03, 0x00, 0xFD, 0x00,
+    0x03, 0x00, 0xFC, 0x00, 0x01, 0x00, 0x03, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0x02, 0x00, 0xFE, 0x00,
+    0xFF, 0x00, 0x06, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x04, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFB, 0x00,
+    0x03, 0x00, 0xFD, 0x00, 0x01, 0x00, 0x04, 0x00, 0xFC, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x02, 0x00, 0x03, 0x00, 0xFB, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x05, 0x00, 0xFB, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0xFE, 0x00, 0xFF, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0xFC, 0x00,
+    0x01, 0x00, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x58, 0x53, 0x31, 0x06, 0x00, 0x00, 0x00, 0x90, 0x05, 0x00, 0x00, 0x90, 0x05, 0x00, 0x00,
+    0x0A, 0x07, 0x07, 0x07, 0x04, 0x01, 0x80, 0x02, 0x02, 0x03, 0xDC, 0x01, 0x9D, 0x2B, 0xFE, 0x00,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0xFC, 0x00,
+    0x04, 0x00, 0xFF, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFA, 0x00, 0x06, 0x00,
+    0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x03, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x03, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x04, 0x00, 0x01, 0x00, 0xFA, 0x00, 0x05, 0x00,
+    0xFE, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0xFB, 0x00, 0x05, 0x00,
+    0xFD, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x02, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x03, 0x00, 0x02, 0x00, 0xFE, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00,
+    0xFB, 0x00, 0x02, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x00,
+    0x00, 0x00, 0x06, 0x00, 0xFF, 0x00, 0x02, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x02, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x04, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x06, 0x00, 0xFA, 0x00, 0x06, 0x00, 0xFD, 0x00, 0x01, 0x00,
+    0x02, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x04, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x02, 0x00, 0xFF, 0x00,
+    0x06, 0x00, 0xFE, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x03, 0x00, 0xFE, 0x00, 0x06, 0x00,
+    0xFE, 0x00, 0x02, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x04, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x05, 0x00,
+    0xFD, 0x00, 0x02, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x04, 0x00, 0xFD, 0x00,
+    0x02, 0x00, 0xFD, 0x00, 0x02, 0x00, 0x04, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0xFE, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x03, 0x00, 0xFD, 0x00, 0x02, 0x00,
+    0x03, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0x01, 0xFE, 0x00, 0x03, 0x00, 0xFD, 0x00,
+    0x07, 0x00, 0xFA, 0x00, 0x03, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x02, 0x00, 0x03, 0x00, 0xFB, 0x00,
+    0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x05, 0x00, 0xFD, 0x00, 0x05, 0x00, 0x01, 0x00, 0xFD, 0x00,
+    0xFE, 0x00, 0x04, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x04, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+    0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01, 0x00, 0xFF, 0x00,
+    0x06, 0x00, 0xFA, 0x00, 0x03, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x05, 0x00, 0x01, 0x00, 0xFE, 0x00,
+    0xFE, 0x00, 0x05, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x04, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0xFB, 0x00, 0x04, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x03, 0x00, 0xFB, 0x00, 0x05, 0x00,
+    0xFE, 0x00, 0xFE, 0x00, 0x04, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x04, 0x00, 0x01, 0x01, 0xFD, 0x00,
+    0x03, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x58, 0x53, 0x31, 0x07, 0x00, 0x00, 0x00, 0x7E, 0x06, 0x00, 0x00, 0x7E, 0x06, 0x00, 0x00,
+    0x42, 0x07, 0x0C, 0x07, 0x04, 0x01, 0x80, 0x02, 0x02, 0x03, 0xDC, 0x01, 0xD6, 0xAE, 0x05, 0x00,
+    0x01, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFC, 0x00,
+    0x05, 0x00, 0x01, 0x00, 0xFD, 0x01, 0xFE, 0x00, 0x04, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x02, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x04, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x03, 0x00,
+    0xFD, 0x00, 0x03, 0x00, 0x00, 0x01, 0x02, 0x00, 0xFE, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x03, 0x00,
+    0x03, 0x00, 0xFF, 0x01, 0x02, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x03, 0x00, 0xFB, 0x00, 0x06, 0x00,
+    0xFD, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0xFE, 0x00, 0x07, 0x00, 0xFD, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x05, 0x00, 0xFE, 0x00, 0x04, 0x01, 0x00, 0x00, 0xFF, 0x00,
+    0xFC, 0x00, 0x01, 0x00, 0x06, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0xFB, 0x00,
+    0xFF, 0x00, 0x07, 0x00, 0xFA, 0x01, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFA, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x04, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x07, 0x00, 0xFC, 0x00, 0x03, 0x00, 0x02, 0x00,
+    0xFC, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x00, 0xFE, 0x00, 0x04, 0x00, 0xFE, 0x00, 0xFE, 0x00,
+    0x01, 0x00, 0x03, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xFE, 0x01, 0x03, 0x00, 0x00, 0x00,
+    0xFD, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0xFE, 0x00,
+    0x04, 0x01, 0xFE, 0x00, 0x03, 0x00, 0xFE, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0xFC, 0x00, 0xFF, 0x00, 0x06, 0x01, 0xFF, 0x00, 0xFC, 0x00, 0x05, 0x00, 0x02, 0x00, 0xFC, 0x00,
+    0x04, 0x00, 0xFE, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0xFC, 0x00, 0x02, 0x00,
+    0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x02, 0x00, 0x01, 0x00, 0xFD, 0x01, 0x00, 0x00,
+    0x02, 0x00, 0xFF, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0xFA, 0x00,
+    0x04, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0xFB, 0x00, 0x03, 0x00, 0x04, 0x00,
+    0xFF, 0x00, 0xFE, 0x00, 0x00, 0x01, 0x04, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x02, 0x00, 0xFD, 0x00,
+    0x04, 0x00, 0xFB, 0x00, 0x05, 0x00, 0xFC, 0x01, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00,
+    0x02, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFE, 0x01, 0xFF, 0x00, 0x01, 0x00, 0x02, 0x00,
+    0xFF, 0x00, 0x03, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x04, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x05, 0x00, 0xFE, 0x00, 0x03, 0x00, 0xFD, 0x01, 0x02, 0x00,
+    0x02, 0x00, 0xFE, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x01, 0x02, 0x00,
+    0xFE, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xFC, 0x00, 0x04, 0x00, 0xFC, 0x01,
+    0x03, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x06, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x58, 0x53, 0x31, 0x08, 0x00, 0x00, 0x00, 0x6C, 0x07, 0x00, 0x00, 0x6C, 0x07, 0x00, 0x00,
+    0x9C, 0x07, 0x21, 0x07, 0x04, 0x01, 0x80, 0x02, 0x02, 0x03, 0xDC, 0x01, 0x6F, 0xB3, 0x06, 0x00,
+    0xFF, 0x00, 0x01, 0x01, 0xFD, 0x00, 0x01, 0x00, 0x04, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x01, 0x00,
+    0x05, 0x00, 0x01, 0x01, 0xFF, 0x00, 0xFE, 0x00, 0x03, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x02, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x04, 0x01, 0xFD, 0x00, 0x03, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0xFA, 0x01, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x01, 0x00,
+    0x02, 0x01, 0xFE, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0xFE, 0x01, 0x04, 0x00, 0xFE, 0x00, 0xFD, 0x00, 0x04, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x03, 0x01,
+    0x03, 0x00, 0xFC, 0x00, 0x05, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x02, 0x00, 0xFF, 0x00, 0xFD, 0x01,
+    0x03, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x02, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x05, 0x01, 0x01, 0x00,
+    0xFE, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xFF, 0x01, 0x04, 0x00, 0xFC, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x01, 0xFC, 0x00, 0x03, 0x00, 0xFC, 0x00,
+    0x02, 0x00, 0x04, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x02, 0x00, 0x02, 0x00, 0xFE, 0x00,
+    0xFE, 0x00, 0x01, 0x00, 0x03, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0x05, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x00, 0xFD, 0x00,
+    0xFF, 0x01, 0x03, 0x00, 0xFF, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x02, 0x00, 0x04, 0x01, 0xFF, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0xFE, 0x00,
+    0x01, 0x00, 0xFC, 0x00, 0x06, 0x00, 0xFA, 0x01, 0x04, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x03, 0x00,
+    0xFE, 0x00, 0x05, 0x00, 0xFB, 0x01, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x04, 0x00,
+    0xFD, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xFD, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0xFB, 0x00, 0x06, 0x01, 0xFB, 0x00, 0x05, 0x00, 0xFC, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0xFF, 0x00, 0x02, 0x01, 0xFD, 0x00, 0xFF, 0x00, 0x05, 0x00, 0x01, 0x00, 0xFE, 0x00,
+    0x01, 0x01, 0xFC, 0x00, 0x06, 0x00, 0x01, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0xFE, 0x01, 0x01, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x01, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFB, 0x00, 0x06, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x01, 0x00,
+    0xFE, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x07, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFD, 0x01, 0x01, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x05, 0x00, 0x01, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x04, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x03, 0x00, 0xFC, 0x00, 0x03, 0x00, 0x01, 0x00, 0xFC, 0x01, 0x06, 0x00, 0xFD, 0x00,
+    0xFE, 0x00, 0x03, 0x00, 0x01, 0x00, 0x03, 0x01, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x58, 0x53, 0x31, 0x09, 0x00, 0x00, 0x00, 0x5A, 0x08, 0x00, 0x00, 0x5A, 0x08, 0x00, 0x00,
+    0xF5, 0x07, 0x45, 0x07, 0x04, 0x01, 0x80, 0x02, 0x02, 0x03, 0xDC, 0x01, 0xF4, 0x0E, 0x03, 0x00,
+    0x01, 0x00, 0x02, 0x00, 0xFC, 0x00, 0x04, 0x01, 0x5A, 0x00, 0xFE, 0x00, 0x04, 0x00, 0x02, 0x00,
+    0x00, 0x01, 0xFA, 0x00, 0x05, 0x00, 0x02, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0x01, 0xFE, 0x00,
+    0x04, 0x00, 0xFD, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFB, 0x00, 0x00, 0x00, 0x03, 0x00,
+    0x01, 0x00, 0xFD, 0x01, 0x04, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0xFB, 0x00, 0x03, 0x01,
+    0x01, 0x00, 0xFE, 0x00, 0x05, 0x00, 0xFE, 0x00, 0xFF, 0x01, 0x02, 0x00, 0xFD, 0x00, 0x02, 0x00,
+    0x04, 0x00, 0xFB, 0x00, 0x05, 0x01, 0xFC, 0x00, 0x03, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x06, 0x01,
+    0x01, 0x00, 0xFA, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x02, 0x00, 0xFB, 0x00,
+    0x05, 0x00, 0xFD, 0x00, 0x01, 0x01, 0xFE, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFC, 0x01,
+    0x03, 0x00, 0x02, 0x00, 0xFC, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x02, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x02, 0x00, 0x03, 0x00, 0xFC, 0x00, 0x02, 0x00, 0xFF, 0x01,
+    0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x02, 0x01, 0xFE, 0x00, 0x01, 0x00, 0xFC, 0x00,
+    0x02, 0x00, 0x03, 0x00, 0xFE, 0x01, 0x02, 0x00, 0xFE, 0x00, 0x05, 0x00, 0x00, 0x00, 0xFE, 0x01,
+    0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00,
+    0x01, 0x00, 0xFD, 0x01, 0x02, 0x00, 0xFD, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x03, 0x00,
+    0x00, 0x00, 0xFD, 0x00, 0x03, 0x00, 0xFD, 0x01, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x00, 0xFE, 0x00, 0xFD, 0x00, 0x05, 0x00, 0xFC, 0x01, 0x01, 0x00, 0x04, 0x00,
+    0xFD, 0x00, 0x03, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFF, 0x01,
+    0x01, 0x00, 0x04, 0x00, 0xFB, 0x00, 0x01, 0x00, 0x05, 0x01, 0xFB, 0x00, 0x02, 0x00, 0x02, 0x00,
+    0xFE, 0x00, 0x01, 0x01, 0x05, 0x00, 0xFC, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x02, 0x01, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x05, 0x00, 0xFB, 0x01, 0x03, 0x00, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0xFD, 0x01, 0x01, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 0x00, 0xFD, 0x01, 0x03, 0x00, 0xFC, 0x00,
+    0x03, 0x00, 0x02, 0x00, 0xFD, 0x01, 0x02, 0x00, 0xFD, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x01,
+    0x01, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x06, 0x00, 0xFC, 0x01, 0x05, 0x00, 0xFE, 0x00, 0x02, 0x00,
+    0xFF, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x03, 0x01, 0xFC, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xFB, 0x01,
+    0x04, 0x00, 0xFD, 0x00, 0x04, 0x00, 0xFC, 0x01, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x01, 0x01, 0x00, 0xFB, 0x00, 0x04, 0x00, 0xFE, 0x00, 0x05, 0x01, 0xFE, 0x00, 0x02, 0x00,
+    0x01, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x02, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x01, 0x01, 0x00, 0x00,
+    0xFE, 0x00, 0x04, 0x00, 0x02, 0x00, 0xFE, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01,
+    0xFC, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x05, 0x00, 0xFA, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x58, 0x53, 0x31, 0x0A, 0x00, 0x00, 0x00, 0x48, 0x09, 0x00, 0x00, 0x48, 0x09, 0x00, 0x00,
+    0x4F, 0x08, 0x74, 0x07, 0x04, 0x01, 0x80, 0x02, 0x02, 0x03, 0xDC, 0x01, 0xA3, 0x4A, 0x03, 0x00,
+    0x04, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x01, 0x02, 0x00, 0x03, 0x00, 0xFD, 0x00, 0x00, 0x01,
+    0x05, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x03, 0x00, 0xFE, 0x01, 0xFF, 0x00, 0x06, 0x00, 0xFE, 0x00,
+    0x00, 0x01, 0x01, 0x00, 0xFE, 0x00, 0x04, 0x00, 0xFE, 0x00, 0x02, 0x01, 0xFC, 0x00, 0x80, 0x03,
+    0x0C, 0x00, 0x80, 0x02, 0x04, 0x01, 0x00, 0x00, 0x02, 0x03, 0x06, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0xFC, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x01, 0x00, 0x02, 0x01, 0xFE, 0x00, 0xFE, 0x00, 0x04, 0x00,
+    0xFC, 0x01, 0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0xFA, 0x00, 0x05, 0x01, 0xFF, 0x00, 0xFE, 0x00,
+    0x03, 0x00, 0xFB, 0x00, 0x02, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFD, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x02, 0x00,
+    0xFE, 0x01, 0xFE, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x01, 0xFE, 0x00, 0x01, 0x00, 0xFD, 0x00,
+    0x05, 0x00, 0xFD, 0x01, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0xFA, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0xFF, 0x01, 0xFC, 0x00, 0x02, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x01, 0x01,
+    0xFC, 0x00, 0x05, 0x00, 0xFB, 0x00, 0x01, 0x00, 0x03, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x04, 0x00, 0xFE, 0x01, 0x01, 0x00,
+    0xFC, 0x00, 0x05, 0x00, 0x00, 0x01, 0xFD, 0x00, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x00, 0xFB, 0x01,
+    0x01, 0x00, 0x03, 0x00, 0xFE, 0x00, 0x02, 0x00, 0xFD, 0x01, 0x01, 0x00, 0x02, 0x00, 0xFC, 0x00,
+    0x02, 0x00, 0xFD, 0x01, 0x06, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0x04, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0xFB, 0x01, 0x05, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x04, 0x01, 0xFD, 0x00, 0xFD, 0x00,
+    0x00, 0x00, 0x06, 0x00, 0xFE, 0x01, 0xFE, 0x00, 0x04, 0x00, 0xFB, 0x00, 0x03, 0x00, 0x02, 0x01,
+    0xFC, 0x00, 0x03, 0x00, 0xFF, 0x00, 0xFC, 0x00, 0x05, 0x01, 0xFB, 0x00, 0x01, 0x00, 0xFF, 0x00,
+    0x05, 0x00, 0xFD, 0x01, 0x00, 0x00, 0x02, 0x00, 0xFC, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x05, 0x01,
+    0xFB, 0x00, 0x00, 0x00, 0x05, 0x00, 0xFD, 0x00, 0xFF, 0x01, 0x04, 0x00, 0xFB, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x03, 0x01, 0xFE, 0x00, 0xFD, 0x00, 0x03, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x02, 0x00,
+    0xFA, 0x00, 0x05, 0x00, 0xFF, 0x00, 0x02, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFC, 0x00, 0xFF, 0x00,
+    0x02, 0x00, 0x02, 0x01, 0xFC, 0x00, 0x03, 0x00, 0xFC, 0x00, 0x05, 0x00, 0x01, 0x01, 0xFD, 0x00,
+    0x02, 0x00, 0xFB, 0x00, 0x04, 0x00, 0xFC, 0x01, 0x02, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x05, 0x00,
+    0xFB, 0x00, 0x02, 0x01, 0x00, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x03, 0x00, 0x00, 0x01, 0xFE, 0x00,
+    0x04, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x02, 0x00, 0xFE, 0x01, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0xFF, 0x00, 0xFB, 0x01, 0x01, 0x00, 0x05, 0x00, 0xFC, 0x00, 0x01, 0x00, 0x02, 0x00, 0xFF, 0x01,
+    0xFF, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x04, 0x00, 0xFD, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x58, 0x53, 0x31, 0x0B, 0x00, 0x00, 0x00, 0x30, 0x0A, 0x00, 0x00, 0x30, 0x0A, 0x00, 0x00,
+    0x5C, 0x08, 0xA3, 0x07, 0x04, 0x01, 0x00, 0x00, 0x02, 0x03, 0xDC, 0x01, 0x21, 0x34, 0xFF, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFB, 0x00, 0x01, 0x01, 0x04, 0x00, 0xFD, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0xFB, 0x01, 0x00, 0x00, 0x04, 0x00, 0xFC, 0x00, 0x05, 0x00, 0x00, 0x00, 0xFD, 0x01,
+    0x04, 0x00, 0xFA, 0x00, 0x04, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x03, 0x00, 0xFB, 0x00, 0xFF, 0x00,
+    0x01, 0x00, 0x04, 0x00, 0xFE, 0x01, 0x02, 0x00, 0xFC, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x06, 0x00,
+    0xFF, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0xFE, 0x01, 0x00, 0x00, 0x02, 0x00,
+    0xFB, 0x00, 0x01, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x02, 0x00, 0xFC, 0x00,
+    0x06, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x01,
+    0x02, 0x00, 0xFE, 0x00, 0x04, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFF, 0x01, 0x04, 0x00, 0xFE, 0x00,
+    0x03, 0x00, 0xFA, 0x00, 0x02, 0x00, 0xFF, 0x01, 0x01, 0x00, 0x03, 0x00, 0xFD, 0x00, 0xFF, 0x00,
+    0x03, 0x00, 0x01, 0x01, 0xFB, 0x00, 0x06, 0x00, 0xFA, 0x00, 0x03, 0x00, 0x02, 0x00, 0xFF, 0x01,
+    0xFF, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x03, 0x00, 0xFF, 0x01, 0xFE, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0xFD, 0x01, 0x01, 0x00, 0x02, 0x00, 0xFF, 0x00, 0xFB, 0x00,
+    0x06, 0x00, 0xFE, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x04, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFB, 0x01, 0x01, 0x00, 0xFF, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x02, 0x01, 0x01, 0x00, 0xFB, 0x00, 0xFF, 0x00, 0x05, 0x00,
+    0xFC, 0x00, 0x05, 0x01, 0xFA, 0x00, 0x03, 0x00, 0x03, 0x00, 0xFA, 0x00, 0x05, 0x00, 0xFB, 0x00,
+    0x02, 0x01, 0x04, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x05, 0x00, 0xFC, 0x00, 0x02, 0x01, 0x01, 0x00,
+    0xFD, 0x00, 0x04, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x02, 0x01, 0xFD, 0x00, 0x02, 0x00, 0xFE, 0x00,
+    0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0xFF, 0x01, 0xFC, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0xFC, 0x00, 0x06, 0x01, 0xFA, 0x00, 0x06, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x01, 0x00, 0x01, 0x01,
+    0xFE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x00, 0xFE, 0x00, 0x01, 0x01, 0x00, 0x00,
+    0x01, 0x00, 0xFC, 0x00, 0x02, 0x00, 0x03, 0x00, 0xFD, 0x01, 0x01, 0x00, 0xFC, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x00, 0x01, 0x04, 0x00, 0xFB, 0x00, 0x03, 0x00, 0xFD, 0x00,
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x01, 0xFB, 0x00, 0x06, 0x00, 0xFA, 0x00, 0x01, 0x00, 0x05, 0x00,
+    0xFA, 0x01, 0x01, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x02, 0x00, 0x03, 0x00, 0xFF, 0x00, 0xFD, 0x01,
+    0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x02, 0x00, 0x04, 0x01, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xFB, 0x00, 0x04, 0x00, 0x01, 0x01, 0xFA, 0x00, 0x02, 0x00,
+    0x03, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFE, 0x01, 0x00, 0x00, 0x02, 0x00, 0xFD, 0x00, 0xFE, 0x00,
+    0x05, 0x00, 0xFB, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0xFE, 0x00, 0xFC, 0x01, 0x03, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x58, 0x53, 0x31, 0x0C, 0x00, 0x00, 0x00, 0x1E, 0x0B, 0x00, 0x00, 0x1E, 0x0B, 0x00, 0x00,
+    0x5B, 0x08, 0xC9, 0x07, 0x04, 0x01, 0x00, 0x00, 0x02, 0x03, 0xDC, 0x01, 0x41, 0x4A, 0x03, 0x00,
+    0xFF, 0x00, 0xFD, 0x00, 0x05, 0x01, 0x00, 0x00, 0xFD, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x02, 0x01, 0x01, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFC, 0x00, 0x00, 0x00,
+    0x05, 0x01, 0xFA, 0x00, 0x02, 0x00, 0x03, 0x00, 0xFC, 0x00, 0x04, 0x00, 0x01, 0x00, 0xFD, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x01,
+    0xFE, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x04, 0x00, 0x01, 0x01, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x04, 0x00, 0xFE, 0x01, 0x01, 0x00, 0xFB, 0x00,
+    0x06, 0x00, 0xFB, 0x00, 0x03, 0x00, 0x02, 0x00, 0xFC, 0x01, 0x02, 0x00, 0xFF, 0x00, 0xFE, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x01, 0x01, 0x02, 0x00, 0xFB, 0x00, 0x05, 0x00,
+    0xFD, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xFB, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0xFE, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0xFA, 0x00, 0x02, 0x00, 0x04, 0x00,
+    0xFB, 0x00, 0x05, 0x00, 0x00, 0x01, 0xFE, 0x00, 0xFD, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFE, 0x00, 0x01, 0x01, 0x01, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x02, 0x00, 0xFC, 0x00,
+    0x04, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x03, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0xFC, 0x01, 0x01, 0x00, 0x02, 0x00, 0xFC, 0x00, 0x05, 0x00, 0xFE, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0xFC, 0x01, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0xFA, 0x00, 0x06, 0x00, 0xFD, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0xFC, 0x00, 0x04, 0x00, 0x02, 0x00, 0xFC, 0x00, 0x04, 0x00, 0xFA, 0x00,
+    0x01, 0x00, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x04, 0x00, 0xFE, 0x00, 0xFE, 0x00,
+    0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x01, 0x00, 0x05, 0x01, 0xFF, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFE, 0x00,
+    0x01, 0x00, 0x80, 0x01, 0x0B, 0x07, 0xDD, 0x07, 0xFE, 0x00, 0x02, 0x00, 0xFB, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x03, 0x00, 0xFF, 0x00, 0x04, 0x00, 0xFA, 0xFF, 0x02, 0x00, 0x03, 0x00, 0xFE, 0x00,
+    0x03, 0x00, 0xFA, 0xFF, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0xFC, 0x00, 0x02, 0xFF, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x00, 0xFF,
+    0xFE, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x01, 0x00, 0x04, 0x00, 0xFC, 0x00,
+    0x01, 0x00, 0xFD, 0xFF, 0x03, 0x00, 0x03, 0x00, 0xFE, 0x00, 0x02, 0x00, 0xFE, 0xFF, 0xFD, 0x00,
+    0x01, 0x00, 0x04, 0x00, 0xFA, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFD, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xFE, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0xFE, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0xFA, 0xFF, 0x06, 0x00, 0xFE, 0x00, 0x01, 0x00, 0xFE, 0x00, 0xFD, 0x00,
+    0x05, 0xFF, 0xFB, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFD, 0xFF, 0x04, 0x00, 0xFB, 0x00,
+    0x05, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x58, 0x53, 0x31, 0x0D, 0x00, 0x00, 0x00, 0x0A, 0x0C, 0x00, 0x00, 0x0A, 0x0C, 0x00, 0x00,
+    0x08, 0x07, 0xCD, 0x07, 0x04, 0x01, 0x00, 0x00, 0x02, 0x03, 0xDC, 0x01, 0xE6, 0xEF, 0x03, 0x00,
+    0xFB, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x04, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0xFE, 0x00, 0x04, 0x00, 0xFC, 0xFF, 0x06, 0x00, 0xFA, 0x00, 0x02, 0x00, 0x04, 0x00,
+    0xFE, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xFD, 0x00, 0xFD, 0xFF, 0x00, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x04, 0x00, 0xFA, 0xFF, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0xFD, 0x00,
+    0x02, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x03, 0x00, 0xFF, 0x00, 0xFB, 0x00, 0x03, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xFD, 0xFF, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFE, 0x00,
+    0x02, 0x00, 0xFE, 0xFF, 0x05, 0x00, 0xFB, 0x00, 0x04, 0x00, 0xFB, 0x00, 0x03, 0xFF, 0x02, 0x00,
+    0xFC, 0x00, 0x05, 0x00, 0xFA, 0x00, 0x01, 0x00, 0x05, 0xFF, 0xFB, 0x00, 0xFF, 0x00, 0x04, 0x00,
+    0x02, 0x00, 0xFC, 0xFF, 0x03, 0x00, 0xFC, 0x00, 0x05, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x03, 0xFF,
+    0x03, 0x00, 0xFA, 0x00, 0x05, 0x00, 0xFB, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x04, 0x00,
+    0xFB, 0x00, 0x02, 0x00, 0xFD, 0xFF, 0x05, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00,
+    0x04, 0xFF, 0xFB, 0x00, 0x01, 0x00, 0x04, 0x00, 0xFE, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x02, 0x00,
+    0x03, 0x00, 0xFB, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x02, 0x00, 0x02, 0xFF, 0x02, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x04, 0x00, 0xFB, 0xFF, 0x01, 0x00,
+    0x01, 0x00, 0xFD, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x01, 0x00, 0x03, 0x00,
+    0xFC, 0x00, 0x05, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0xFC, 0x00, 0x03, 0x00, 0xFF, 0x00, 0x03, 0x00,
+    0xFC, 0xFF, 0xFE, 0x00, 0x02, 0x00, 0x04, 0x00, 0xFB, 0x00, 0x01, 0x00, 0x01, 0xFF, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0xFE, 0x00, 0xFF, 0x00,
+    0x06, 0x00, 0xFF, 0x00, 0xFD, 0xFF, 0xFF, 0x00, 0x04, 0x00, 0xFB, 0x00, 0x03, 0x00, 0x03, 0x00,
+    0xFE, 0xFF, 0xFE, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x06, 0xFF, 0x00, 0x00,
+    0xFE, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x03, 0x00, 0xFE, 0x00,
+    0x01, 0x00, 0x02, 0x00, 0xFD, 0xFF, 0x00, 0x00, 0x05, 0x00, 0xFB, 0x00, 0x03, 0x00, 0x02, 0x00,
+    0xFB, 0xFF, 0x04, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x03, 0x00, 0xFC, 0x00, 0x06, 0xFF, 0xFA, 0x00,
+    0x04, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x03, 0x00, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0xFB, 0x00, 0x03, 0x00, 0xFE, 0x00,
+    0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x03, 0xFF,
+    0xFF, 0x00, 0xFB, 0x00, 0x04, 0x00, 0x02, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x04, 0x00,
+    0xFF, 0x00, 0x01, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x03, 0x00, 0xFD, 0x00,
+    0xFE, 0x00, 0x05, 0x00, 0xFF, 0x00, 0xFD, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00,
+    0xFC, 0x00, 0xFE, 0xFF, 0x01, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x58, 0x53, 0x31, 0x0E, 0x00, 0x00, 0x00, 0xF8, 0x0C, 0x00, 0x00, 0xF8, 0x0C, 0x00, 0x00,
+    0x07, 0x07, 0xA4, 0x07, 0x04, 0x01, 0x00, 0x00, 0x02, 0x03, 0xDC, 0x01, 0x0F, 0xC7, 0x02, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0xFA, 0xFF, 0x02, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFC, 0x00,
+    0x00, 0xFF, 0x02, 0x00, 0x03, 0x00, 0xFC, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF,
+    0x04, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x01, 0x00, 0x02, 0x00, 0xFA, 0xFF, 0x02, 0x00,
+    0x04, 0x00, 0xFA, 0x00, 0x05, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x01, 0x00, 0xFC, 0x00, 0x04, 0x00,
+    0x02, 0x00, 0xFE, 0x00, 0xFD, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x03, 0x00,
+    0xFD, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0xFA, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x06, 0xFF,
+    0xFE, 0x00, 0x01, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x04, 0xFF, 0xFE, 0x00,
+    0xFD, 0x00, 0x02, 0x00, 0x04, 0x00, 0xFA, 0x00, 0x05, 0x00, 0xFC, 0xFF, 0xFF, 0x00, 0x02, 0x00,
+    0xFE, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xFF, 0x02, 0x00, 0xFC, 0x00, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x05, 0x00,
+    0xFB, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x02, 0x00, 0xFE, 0x00, 0xFE, 0x00,
+    0x05, 0x00, 0xFA, 0x00, 0x05, 0xFF, 0xFE, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x01, 0x00, 0x02, 0x00,
+    0xFE, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x03, 0x00, 0xFD, 0x00, 0x06, 0x00, 0xFC, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0xFE, 0x00, 0x05, 0x00, 0xFC, 0x00, 0x03, 0x00, 0xFE, 0x00, 0x03, 0x00, 0xFE, 0x00,
+    0x02, 0xFF, 0xFC, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x03, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0x02, 0xFF,
+    0x02, 0x00, 0xFD, 0x00, 0x04, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x05, 0x00, 0xFD, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0xFB, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x04, 0x00, 0xFD, 0x00, 0xFF, 0xFF, 0x02, 0x00,
+    0x01, 0x00, 0xFE, 0x00, 0x03, 0x00, 0x01, 0x00, 0xFB, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0xFD, 0x00, 0x02, 0x00, 0xFB, 0x00, 0x06, 0xFF, 0xFA, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x03, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0x00,
+    0xFF, 0x00, 0x02, 0x00, 0xFA, 0x00, 0x04, 0x00, 0xFC, 0xFF, 0x02, 0x00, 0xFE, 0x00, 0x04, 0x00,
+    0xFC, 0x00, 0x03, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0xFE, 0x00,
+    0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x04, 0x00, 0xFD, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x04, 0x00, 0xFB, 0x00,
+    0x05, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x04, 0x00, 0xFD, 0xFF, 0x01, 0x00, 0x01, 0x00, 0xFF, 0x00,
+    0xFD, 0x00, 0x04, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x03, 0xFF, 0x01, 0x00, 0xFD, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0xFE, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x03, 0x00, 0xFC, 0x00, 0xFE, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x58, 0x53, 0x31, 0x0F, 0x00, 0x00, 0x00, 0xE6, 0x0D, 0x00, 0x00, 0xE6, 0x0D, 0x00, 0x00,
+    0x09, 0x07, 0x83, 0x07, 0x04, 0x01, 0x00, 0x00, 0x02, 0x03, 0xDC, 0x01, 0x85, 0xA9, 0x00, 0x00,
+    0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x05, 0x00, 0xFB, 0xFF,
+    0x01, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF,
+    0xFE, 0x00, 0x06, 0x00, 0xFA, 0x00, 0x01, 0x00, 0x03, 0x00, 0xFC, 0x00, 0x04, 0x00, 0x02, 0xFF,
+    0xFC, 0x00, 0x01, 0x00, 0x02, 0x00, 0xFB, 0x00, 0x04, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xFD, 0x00,
+    0xFF, 0xFF, 0x03, 0x00, 0x01, 0x00, 0xFA, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0xFC, 0xFF, 0x02, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x04, 0x00, 0xFC, 0x00,
+    0x03, 0x00, 0x00, 0xFF, 0x02, 0x00, 0xFC, 0x00, 0x04, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFC, 0x00,
+    0x05, 0x00, 0x01, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x04, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x02, 0x00, 0x03, 0x00, 0xFA, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x03, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0xFD, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x04, 0x00, 0xFE, 0x00, 0x00, 0x00,
+    0xFC, 0x00, 0x03, 0x00, 0x03, 0x00, 0xFD, 0x00, 0x02, 0x00, 0xFE, 0x00, 0xFF, 0xFF, 0x03, 0x00,
+    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x02, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0x06, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xFE, 0x00, 0x04, 0x00, 0xFB, 0x00, 0x02, 0x00,
+    0x01, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x06, 0x00, 0xFC, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0xFE, 0x00, 0x02, 0x00, 0xFB, 0xFF, 0x01, 0x00, 0xFF, 0x00, 0x02, 0x00, 0xFD, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x02, 0x00, 0x02, 0x00,
+    0xFC, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x04, 0x00, 0x01, 0xFF,
+    0xFD, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x05, 0x00, 0xFB, 0x00, 0x04, 0x00, 0xFD, 0x00, 0xFF, 0x00,
+    0x03, 0x00, 0xFF, 0xFF, 0x02, 0x00, 0xFF, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFD, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xFE, 0x00, 0x00, 0x00,
+    0xFE, 0x00, 0x03, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x01, 0xFF, 0xFA, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x06, 0x00, 0xFC, 0x00, 0x02, 0x00, 0xFD, 0xFF, 0xFF, 0x00,
+    0x05, 0x00, 0xFD, 0x00, 0x03, 0x00, 0xFD, 0x00, 0x04, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x02, 0x00,
+    0xFC, 0xFF, 0x03, 0x00, 0xFE, 0x00, 0x04, 0x00, 0xFE, 0x00, 0xFD, 0x00, 0x03, 0x00, 0xFD, 0x00,
+    0x02, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x02, 0x00,
+    0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x05, 0xFF, 0xFE, 0x00, 0xFD, 0x00,
+    0x06, 0x00, 0xFA, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x58, 0x53, 0x31, 0x10, 0x00, 0x00, 0x00, 0xD4, 0x0E, 0x00, 0x00, 0xD4, 0x0E, 0x00, 0x00,
+    0x0A, 0x07, 0x6A, 0x07, 0x04, 0x01, 0x00, 0x00, 0x02, 0x03, 0xDC, 0x01, 0xB7, 0xFF, 0xFF, 0x00,
+    0xFC, 0x00, 0x02, 0xFF, 0x01, 0x00, 0x03, 0x00, 0xFA, 0x00, 0x04, 0x00, 0xFC, 0x00, 0x05, 0x00,
+    0xFB, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00,
+    0x04, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x03, 0x00, 0xFD, 0xFF, 0x02, 0x00,
+    0x01, 0x00, 0xFC, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0xFE, 0x00, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xFD, 0x00,
+    0x01, 0x00, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x05, 0x00, 0xFB, 0x00, 0x05, 0x00,
+    0x01, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x04, 0x00, 0xFC, 0x00, 0x01, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0xFF, 0x00, 0x02, 0x00, 0x03, 0x00, 0xFB, 0x00, 0x06, 0x00, 0xFE, 0x00, 0xFC, 0x00,
+    0x02, 0x00, 0xFF, 0x00, 0x02, 0xFF, 0x01, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0xFA, 0x00, 0x03, 0x00, 0xFD, 0xFF, 0x04, 0x00, 0xFD, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x03, 0x00, 0x02, 0x00, 0xFB, 0x00, 0x01, 0x00,
+    0xFE, 0xFF, 0x06, 0x00, 0x00, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x01, 0x00, 0xFE, 0x00,
+    0x01, 0x00, 0xFD, 0x00, 0x01, 0x00, 0x04, 0x00, 0xFE, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFD, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x02, 0x00, 0xFE, 0x00, 0xFD, 0x00, 0x06, 0xFF,
+    0x00, 0x00, 0xFB, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0xFE, 0x00,
+    0xFF, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0xFE, 0x00, 0x02, 0x00, 0x02, 0x00,
+    0x02, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x02, 0x00, 0xFB, 0x00, 0x00, 0xFF, 0x03, 0x00,
+    0x03, 0x00, 0xFC, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x02, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x02, 0x00, 0x03, 0x00, 0xFB, 0x00, 0x02, 0x00,
+    0x04, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x04, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x01, 0x00,
+    0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x03, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x04, 0x00,
+    0xFE, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0xFF,
+    0xFD, 0x00, 0x00, 0x00, 0x05, 0x00, 0xFD, 0x00, 0x02, 0x00, 0xFC, 0x00, 0x04, 0x00, 0xFD, 0x00,
+    0x02, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x02, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x80, 0x04, 0x19, 0x00, 0x05, 0x00, 0x00, 0x00, 0xFA, 0x00,
+    0x05, 0x00, 0xFF, 0x00, 0xFC, 0xFF, 0x04, 0x00, 0x02, 0x00, 0xFC, 0x00, 0x03, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x05, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x01, 0xFF,
+    0xFE, 0x00, 0x03, 0x00, 0x02, 0x00, 0xFB, 0x00, 0x05, 0x00, 0xFC, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0xFB, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x04, 0x00, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x58, 0x53, 0x31, 0x11, 0x00, 0x00, 0x00, 0xD9, 0x0F, 0x00, 0x00, 0xD9, 0x0F, 0x00, 0x00,
+    0x05, 0x07, 0x55, 0x07, 0x04, 0x01, 0x00, 0x00, 0x02, 0x03, 0xDC, 0x01, 0x4D, 0x87, 0x00, 0x00,
+    0x04, 0x00, 0xFE, 0x00, 0x04, 0x00, 0xFE, 0x00, 0x02, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0x05, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0x01, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x05, 0x00, 0xFF, 0x00,
+    0xFE, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0xFD, 0x00, 0x03, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFB, 0x00, 0x01, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x02, 0x00,
+    0x03, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x05, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x05, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x03, 0x00,
+    0xFB, 0x00, 0x01, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x02, 0xFF, 0x02, 0x00, 0x01, 0x00, 0xFC, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x03, 0x00, 0xFD, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x02, 0x00,
+    0xFE, 0x00, 0x05, 0x00, 0xFC, 0xFF, 0xFF, 0x00, 0x02, 0x00, 0x02, 0x00, 0xFB, 0x00, 0x04, 0x00,
+    0xFE, 0x00, 0x03, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x03, 0x00, 0x02, 0x00, 0xFB, 0x00, 0x03, 0x00,
+    0xFF, 0xFF, 0x02, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFE, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFD, 0xFF,
+    0xFE, 0x00, 0x06, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x00, 0xFB, 0x00, 0x01, 0x00, 0x04, 0x00,
+    0xFB, 0x00, 0x00, 0x00, 0x06, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x05, 0xFF, 0xFC, 0x00, 0x03, 0x00,
+    0xFB, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x02, 0x00,
+    0xFB, 0x00, 0x01, 0x00, 0x02, 0x00, 0xFC, 0x00, 0x02, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x03, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0xFE, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x05, 0xFF, 0x00, 0x00, 0xFC, 0x00, 0x02, 0x00, 0x02, 0x00,
+    0xFF, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x02, 0x00, 0x03, 0x00, 0xFB, 0x00, 0xFF, 0x00,
+    0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFE, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xFD, 0x00,
+    0x05, 0x00, 0xFF, 0x00, 0xFC, 0x00, 0x03, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x01, 0x00, 0x04, 0x00, 0xFD, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x02, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x04, 0x00,
+    0xFC, 0x00, 0xFF, 0xFF, 0x04, 0x00, 0x01, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x04, 0x00, 0xFD, 0x00,
+    0x03, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x04, 0x00, 0xFC, 0x00, 0x03, 0x00, 0x00, 0x00, 0xFD, 0x00,
+    0x01, 0x00, 0x03, 0xFF, 0x01, 0x00, 0xFA, 0x00, 0x04, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xFB, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x03, 0x00, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x00, 0xFD, 0x00,
+    0x03, 0x00, 0xFB, 0x00, 0xFF, 0xFF, 0x05, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0x02, 0x00, 0x01, 0x00,
+    0xFE, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x05, 0x00,
+    0xFD, 0x00, 0x01, 0x00, 0xFD, 0xFF, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x58, 0x53, 0x31, 0x12, 0x00, 0x00, 0x00, 0xC7, 0x10, 0x00, 0x00, 0xC7, 0x10, 0x00, 0x00,
+    0x07, 0x07, 0x45, 0x07, 0x04, 0x01, 0x00, 0x00, 0x02, 0x03, 0xDC, 0x01, 0xDC, 0xF8, 0x01, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0xFD, 0x00, 0xFD, 0xFF, 0x05, 0x00, 0x00, 0x00, 0xFD, 0x00,
+    0x03, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x05, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0x00, 0x05, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0x05, 0x00,
+    0xFD, 0x00, 0x03, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x03, 0x00,
+    0xFC, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x04, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFD, 0x00,
+    0x03, 0x00, 0xFB, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x04, 0x00, 0xFF, 0x00, 0x02, 0x00,
+    0xFF, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x06, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x03, 0x00,
+    0xFF, 0xFF, 0xFE, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x04, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xFE, 0x00, 0x04, 0x00, 0x00, 0x00, 0xFC, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x01, 0x00,
+    0xFF, 0x00, 0xFE, 0x00, 0xFD, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0xFC, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFB, 0x00, 0x01, 0x00, 0x04, 0x00,
+    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0xFE, 0x00, 0xFD, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x04, 0x00, 0xFD, 0xFF, 0xFE, 0x00,
+    0x00, 0x00, 0x06, 0x00, 0xFE, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFF, 0x00,
+    0xFE, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x05, 0x00, 0xFB, 0x00, 0x04, 0x00, 0x01, 0x00, 0xFE, 0x00,
+    0xFF, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0xFD, 0x00, 0x05, 0x00, 0x01, 0x00, 0xFB, 0x00, 0x04, 0x00,
+    0xFC, 0x00, 0x02, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x03, 0x00, 0x03, 0x00, 0xFE, 0x00, 0x01, 0x00,
+    0xFD, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x02, 0x00, 0xFD, 0xFF, 0x04, 0x00, 0xFE, 0x00, 0x02, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xFB, 0x00, 0x02, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0xFC, 0x00, 0x06, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x05, 0x00, 0x00, 0x00, 0xFD, 0xFF,
+    0x02, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x01, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01, 0x00, 0x04, 0x00, 0xFC, 0x00, 0x02, 0x00, 0x01, 0x00,
+    0xFB, 0x00, 0x06, 0x00, 0xFB, 0x00, 0x00, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x02, 0x00,
+    0xFB, 0x00, 0x01, 0x00, 0x04, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x03, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFE, 0x00,
+    0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0xFB, 0x00, 0x01, 0x00, 0x05, 0x00,
+    0x00, 0x00, 0xFC, 0x00, 0x03, 0x00, 0xFB, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0xFD, 0x00,
+    0x03, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x03, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x58, 0x53, 0x31, 0x13, 0x00, 0x00, 0x00, 0xB5, 0x11, 0x00, 0x00, 0xB5, 0x11, 0x00, 0x00,
+    0x08, 0x07, 0x38, 0x07, 0x04, 0x01, 0x00, 0x00, 0x02, 0x03, 0xDC, 0x01, 0x2E, 0x47, 0xFE, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0xFB, 0x00, 0x05, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x00, 0x06, 0x00, 0xFD, 0x00, 0x02, 0x00, 0xFB, 0x00, 0x06, 0x00, 0xFD, 0x00, 0xFE, 0x00,
+    0x05, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFA, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFC, 0x00, 0x03, 0x00, 0x03, 0x00, 0xFF, 0x00, 0xFE, 0x00,
+    0x01, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xFA, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x04, 0xFF, 0xFE, 0x00, 0xFC, 0x00, 0x03, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x02, 0x00,
+    0xFE, 0x00, 0x00, 0x00, 0x05, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x02, 0x00, 0xFF, 0x00, 0xFE, 0x00,
+    0x05, 0x00, 0xFC, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x04, 0x00, 0x02, 0x00, 0xFB, 0x00, 0x03, 0xFF,
+    0xFC, 0x00, 0x05, 0x00, 0x01, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00,
+    0xFC, 0x00, 0x04, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x06, 0x00, 0xFC, 0x00,
+    0xFE, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0xFF, 0x00, 0xFE, 0xFF, 0x03, 0x00,
+    0xFE, 0x00, 0xFD, 0x00, 0x06, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x02, 0x00, 0x02, 0x00,
+    0xFE, 0x00, 0x04, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x05, 0x00, 0xFC, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x04, 0x00, 0xFE, 0x00, 0xFD, 0xFF, 0x06, 0x00, 0xFE, 0x00, 0xFF, 0x00,
+    0xFD, 0x00, 0x06, 0x00, 0xFA, 0x00, 0x03, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x06, 0x00, 0xFC, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x03, 0x00, 0xFE, 0x00, 0x04, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x00,
+    0x03, 0x00, 0xFB, 0x00, 0x03, 0x00, 0xFE, 0x00, 0x02, 0xFF, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0xFC, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x02, 0x00, 0x01, 0x00,
+    0xFF, 0x00, 0x03, 0x00, 0xFA, 0x00, 0x06, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x03, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0x00, 0xFD, 0x00,
+    0xFE, 0x00, 0x04, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x05, 0x00, 0xFE, 0x00,
+    0x00, 0x00, 0xFC, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x01, 0x00, 0xFF, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFC, 0x00, 0x03, 0x00,
+    0xFE, 0x00, 0xFF, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x00,
+    0x02, 0x00, 0x02, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x02, 0x00,
+    0x01, 0x00, 0xFC, 0x00, 0x05, 0x00, 0xFC, 0x00, 0x04, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x01, 0x00,
+    0x01, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x04, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x04, 0x00, 0xFB, 0x00, 0x04, 0x00, 0x02, 0x00, 0xFA, 0x00,
+    0x06, 0x00, 0xFB, 0x00, 0x05, 0x00, 0xFD, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFB, 0x00,
+    0x02, 0xFF, 0x04, 0x00, 0xFC, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x58, 0x53, 0x31, 0x14, 0x00, 0x00, 0x00, 0xA3, 0x12, 0x00, 0x00, 0xA3, 0x12, 0x00, 0x00,
+    0x0B, 0x07, 0x2E, 0x07, 0x04, 0x01, 0x00, 0x00, 0x02, 0x03, 0xDC, 0x01, 0x34, 0x3A, 0xFB, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x04, 0x00, 0xFB, 0x00, 0x02, 0x00, 0x04, 0x00, 0xFC, 0x00,
+    0x03, 0x00, 0xFD, 0x00, 0x02, 0x00, 0x02, 0x00, 0xFF, 0x00, 0xFC, 0x00, 0x01, 0x00, 0x04, 0x00,
+    0xFE, 0x00, 0x01, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x05, 0xFF, 0xFD, 0x00, 0x03, 0x00,
+    0xFD, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x01, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x05, 0x00, 0xFB, 0x00,
+    0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x06, 0x00, 0xFF, 0x00, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x03, 0x00,
+    0xFC, 0xFF, 0x01, 0x00, 0x01, 0x00, 0x03, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0x01, 0x00, 0x03, 0x00, 0xFC, 0x00, 0x04, 0x00,
+    0xFD, 0x00, 0x01, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x04, 0x00, 0xFF, 0x00,
+    0xFE, 0x00, 0x02, 0x00, 0x01, 0x00, 0xFA, 0x00, 0x06, 0xFF, 0xFD, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFC, 0x00, 0x06, 0x00, 0xFB, 0x00, 0x04, 0x00, 0xFD, 0x00,
+    0xFF, 0x00, 0x04, 0x00, 0xFB, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x03, 0x00, 0x00, 0x00, 0xFE, 0x00,
+    0x03, 0x00, 0xFE, 0x00, 0x04, 0x00, 0xFE, 0x00, 0x01, 0x00, 0xFB, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0xFB, 0xFF, 0x01, 0x00, 0x03, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+    0x00, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x03, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x02, 0x00, 0x01, 0x00, 0xFB, 0x00, 0x05, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0xFF, 0x00, 0xFB, 0x00, 0x05, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x01, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x06, 0x00, 0xFD, 0x00, 0x03, 0x00,
+    0xFA, 0x00, 0x00, 0x00, 0x05, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x01, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x03, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00,
+    0x01, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0x03, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x02, 0x00, 0x04, 0x00, 0xFC, 0x00, 0x01, 0x00, 0xFF, 0x00,
+    0x02, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x02, 0x00, 0xFE, 0x00, 0xFD, 0x00, 0x04, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x04, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x04, 0x00, 0xFF, 0x00,
+    0xFE, 0x00, 0x03, 0x00, 0xFA, 0x00, 0x06, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x03, 0x00, 0x01, 0x00,
+    0xFE, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0xFE, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x04, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x05, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x04, 0x00, 0xFC, 0xFF, 0x02, 0x00, 0x03, 0x00,
+    0xFA, 0x00, 0x00, 0x00, 0x04, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x58, 0x53, 0x31, 0x15, 0x00, 0x00, 0x00, 0x91, 0x13, 0x00, 0x00, 0x91, 0x13, 0x00, 0x00,
+    0x05, 0x07, 0x26, 0x07, 0x04, 0x01, 0x00, 0x00, 0x02, 0x03, 0xDC, 0x01, 0xB2, 0x81, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x03, 0x00, 0x02, 0x00, 0xFB, 0x00, 0x01, 0x00, 0x02, 0x00,
+    0xFE, 0x00, 0x03, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x05, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x80, 0x01,
+    0xAF, 0x08, 0x26, 0x07, 0xFB, 0x01, 0x03, 0x00, 0xFC, 0x00, 0x02, 0x01, 0x04, 0x00, 0xFF, 0x00,
+    0xFC, 0x01, 0x02, 0x00, 0x03, 0x01, 0xFD, 0x00, 0xFE, 0x00, 0x04, 0x01, 0xFD, 0x00, 0x04, 0x00,
+    0xFD, 0x01, 0x00, 0x00, 0xFE, 0x01, 0x01, 0x00, 0x04, 0x00, 0xFA, 0x01, 0x00, 0x00, 0x05, 0x00,
+    0x00, 0x01, 0xFB, 0x00, 0x00, 0x01, 0x06, 0x00, 0xFF, 0x00, 0xFE, 0x01, 0x02, 0x00, 0x01, 0x00,
+    0xFC, 0x01, 0xFE, 0x00, 0x01, 0x01, 0x03, 0x00, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x01, 0x01, 0x00, 0xFB, 0x00, 0xFF, 0x01, 0x02, 0x00, 0xFE, 0x01, 0x02, 0x00, 0x03, 0x00,
+    0xFE, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x00, 0x04, 0x01, 0xFD, 0x00,
+    0x02, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x01, 0x01, 0xFE, 0x00, 0x03, 0x00, 0x02, 0x01, 0xFB, 0x00,
+    0x02, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x04, 0x00, 0xFB, 0x01, 0x05, 0x00,
+    0xFC, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x02, 0x00, 0xFE, 0x01, 0x03, 0x00, 0x03, 0x00, 0xFB, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x03, 0x01, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xFE, 0x00, 0x03, 0x01,
+    0xFC, 0x00, 0x06, 0x00, 0xFB, 0x01, 0x05, 0x00, 0xFF, 0x00, 0xFD, 0x01, 0xFE, 0x00, 0x06, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0xFD, 0x00, 0xFE, 0x01, 0x02, 0x00, 0x03, 0x00, 0xFB, 0x01, 0x01, 0x00,
+    0x03, 0x00, 0xFB, 0x01, 0x06, 0x00, 0xFA, 0x00, 0x01, 0x01, 0xFF, 0x00, 0x01, 0x01, 0x01, 0x00,
+    0xFF, 0x00, 0x03, 0x01, 0x01, 0x00, 0xFD, 0x00, 0xFE, 0x01, 0x06, 0x00, 0xFB, 0x00, 0x02, 0x01,
+    0x02, 0x00, 0xFE, 0x00, 0xFD, 0x01, 0x03, 0x00, 0xFF, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0xFE, 0x01, 0xFF, 0x00, 0xFE, 0x00, 0x04, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x01, 0xFF, 0x00,
+    0x00, 0x00, 0xFB, 0x01, 0x00, 0x00, 0x01, 0x00, 0x03, 0x01, 0x00, 0x00, 0xFD, 0x00, 0x03, 0x01,
+    0xFF, 0x00, 0x02, 0x00, 0xFB, 0x01, 0x05, 0x00, 0xFB, 0x00, 0x00, 0x01, 0x02, 0x00, 0xFE, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0xFE, 0x01, 0x03, 0x00, 0xFF, 0x00, 0xFD, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0xFF, 0x01, 0xFD, 0x00, 0x04, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00,
+    0xFC, 0x01, 0x04, 0x00, 0xFE, 0x00, 0x04, 0x01, 0xFD, 0x00, 0xFD, 0x00, 0x02, 0x01, 0xFF, 0x00,
+    0x05, 0x00, 0xFB, 0x01, 0x04, 0x00, 0xFB, 0x00, 0x02, 0x01, 0x03, 0x00, 0xFC, 0x00, 0xFF, 0x01,
+    0x02, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0xFC, 0x01, 0x03, 0x00,
+    0x03, 0x00, 0xFE, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x02, 0x00, 0x03, 0x00, 0xFB, 0x01,
+    0x05, 0x00, 0xFE, 0x00, 0x01, 0x01, 0xFE, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x03, 0x01, 0xFE, 0x00,
+    0x03, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xFD, 0x00, 0x01, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x02, 0x01,
+    0xFF, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x58, 0x53, 0x31, 0x16, 0x00, 0x00, 0x00, 0x7D, 0x14, 0x00, 0x00, 0x7D, 0x14, 0x00, 0x00,
+    0xAF, 0x08, 0x71, 0x07, 0x04, 0x01, 0x00, 0x00, 0x02, 0x03, 0xDC, 0x01, 0x04, 0xE9, 0xFD, 0x00,
+    0x00, 0x01, 0x03, 0x00, 0xFB, 0x00, 0x04, 0x01, 0xFB, 0x00, 0x01, 0x00, 0x03, 0x01, 0x00, 0x00,
+    0xFE, 0x00, 0x03, 0x00, 0xFF, 0x01, 0x01, 0x00, 0xFE, 0x00, 0xFE, 0x01, 0x05, 0x00, 0xFB, 0x00,
+    0x04, 0x01, 0xFB, 0x00, 0x00, 0x00, 0x06, 0x01, 0xFE, 0x00, 0x02, 0x00, 0xFA, 0x00, 0x05, 0x01,
+    0xFB, 0x00, 0x03, 0x00, 0x02, 0x01, 0xFF, 0x00, 0xFE, 0x00, 0x03, 0x01, 0x00, 0x00, 0xFE, 0x00,
+    0x01, 0x00, 0x01, 0x01, 0xFD, 0x00, 0x01, 0x00, 0x01, 0x01, 0xFC, 0x00, 0x03, 0x00, 0x02, 0x00,
+    0x00, 0x01, 0x01, 0x00, 0xFD, 0x00, 0x01, 0x01, 0xFE, 0x00, 0x02, 0x00, 0x00, 0x01, 0xFF, 0x00,
+    0xFE, 0x00, 0x05, 0x00, 0xFF, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFD, 0x00, 0xFF, 0x00,
+    0x03, 0x00, 0xFB, 0x01, 0x03, 0x00, 0x01, 0x00, 0xFE, 0x01, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01,
+    0x01, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x05, 0x01, 0x01, 0x00, 0xFE, 0x00, 0x01, 0x01, 0xFC, 0x00,
+    0x03, 0x00, 0x02, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x04, 0x00, 0xFD, 0x01, 0x03, 0x00, 0xFF, 0x00,
+    0xFD, 0x00, 0x02, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0x06, 0x01, 0xFE, 0x00, 0xFE, 0x00, 0x02, 0x00, 0xFD, 0x01, 0x03, 0x00, 0xFD, 0x00, 0x05, 0x01,
+    0xFC, 0x00, 0xFF, 0x00, 0x04, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x05, 0x00, 0xFF, 0x01, 0xFE, 0x00,
+    0xFE, 0x00, 0x04, 0x00, 0x01, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFA, 0x01, 0x02, 0x00,
+    0x01, 0x00, 0xFF, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x01, 0xFD, 0x00, 0x03, 0x00,
+    0xFE, 0x01, 0x04, 0x00, 0xFD, 0x00, 0x01, 0x00, 0xFD, 0x01, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00,
+    0x01, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x01, 0x01, 0x02, 0x00, 0xFB, 0x00, 0x02, 0x01,
+    0x01, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x02, 0x01, 0xFB, 0x00, 0x03, 0x00, 0x02, 0x00, 0xFE, 0x01,
+    0x02, 0x00, 0x01, 0x00, 0xFB, 0x01, 0x05, 0x00, 0xFE, 0x00, 0xFD, 0x00, 0xFF, 0x01, 0x05, 0x00,
+    0xFC, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x03, 0x01, 0xFE, 0x00,
+    0x02, 0x00, 0xFE, 0x00, 0x04, 0x01, 0xFD, 0x00, 0xFF, 0x00, 0xFE, 0x01, 0x04, 0x00, 0xFD, 0x00,
+    0xFF, 0x00, 0x04, 0x01, 0xFE, 0x00, 0xFE, 0x00, 0x04, 0x00, 0xFD, 0x01, 0x01, 0x00, 0x03, 0x00,
+    0xFF, 0x00, 0xFE, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x01, 0x04, 0x00, 0xFD, 0x00,
+    0xFD, 0x00, 0x04, 0x01, 0x01, 0x00, 0xFE, 0x00, 0x03, 0x00, 0xFA, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x03, 0x01, 0xFC, 0x00, 0x02, 0x00, 0x02, 0x00, 0xFC, 0x01, 0xFE, 0x00, 0x05, 0x00,
+    0xFE, 0x00, 0x00, 0x01, 0xFF, 0x00, 0xFE, 0x00, 0x05, 0x00, 0x01, 0x01, 0xFC, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x02, 0x01, 0xFF, 0x00, 0x02, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x02, 0x00,
+    0x03, 0x00, 0xFE, 0x01, 0xFD, 0x00, 0x03, 0x00, 0xFD, 0x00, 0x05, 0x01, 0xFF, 0x00, 0xFF, 0x00,
+    0xFE, 0x00, 0xFE, 0x01, 0x05, 0x00, 0xFC, 0x00, 0x01, 0x00, 0x04, 0x01, 0xFA, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0xFD, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x58, 0x53, 0x31, 0x17, 0x00, 0x00, 0x00, 0x6B, 0x15, 0x00, 0x00, 0x6B, 0x15, 0x00, 0x00,
+    0xAD, 0x08, 0xB2, 0x07, 0x04, 0x01, 0x00, 0x00, 0x02, 0x03, 0xDC, 0x01, 0xBC, 0x89, 0xFF, 0x01,
+    0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x01, 0xFA, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01,
+    0xFF, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x01,
+    0xFF, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0xFA, 0x01, 0x05, 0x00, 0xFC, 0x00, 0x04, 0x00, 0xFC, 0x01, 0x02, 0x00, 0x01, 0x00, 0xFC, 0x00,
+    0x05, 0x01, 0xFD, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x04, 0x00, 0xFD, 0x01, 0x03, 0x00, 0xFD, 0x00,
+    0xFD, 0x00, 0x00, 0x01, 0x01, 0x00, 0x05, 0x00, 0xFA, 0x00, 0x04, 0x01, 0x02, 0x00, 0xFA, 0x00,
+    0x00, 0x00, 0x03, 0x01, 0xFD, 0x00, 0x06, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x03, 0x01, 0xFF, 0x00,
+    0xFD, 0x00, 0x06, 0x00, 0xFF, 0x01, 0xFC, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x01, 0x01, 0x03, 0x00,
+    0xFA, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x03, 0x00, 0xFE, 0x00, 0xFD, 0x01,
+    0x02, 0x00, 0x03, 0x00, 0xFA, 0x00, 0x06, 0x00, 0xFF, 0x01, 0xFC, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0xFF, 0x01, 0x03, 0x00, 0xFC, 0x00, 0x01, 0x00, 0x03, 0x00, 0xFE, 0x01, 0x02, 0x00, 0xFE, 0x00,
+    0xFE, 0x00, 0x02, 0x01, 0x01, 0x00, 0xFF, 0x00, 0x03, 0x00, 0x01, 0x00, 0xFC, 0x01, 0x02, 0x00,
+    0xFF, 0x00, 0x01, 0x00, 0xFF, 0x01, 0x02, 0x00, 0xFB, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFF, 0x01,
+    0x05, 0x00, 0xFD, 0x00, 0x03, 0x00, 0xFD, 0x01, 0x03, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x00, 0x00,
+    0xFF, 0x01, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x03, 0x01, 0x01, 0x00, 0xFD, 0x00, 0x01, 0x00,
+    0x02, 0x00, 0xFE, 0x01, 0x02, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x01, 0x00, 0x04, 0x01, 0xFC, 0x00,
+    0xFF, 0x00, 0x02, 0x00, 0x02, 0x01, 0xFF, 0x00, 0x01, 0x00, 0xFB, 0x00, 0x05, 0x00, 0xFD, 0x01,
+    0xFE, 0x00, 0x04, 0x00, 0xFC, 0x00, 0x03, 0x00, 0x01, 0x01, 0x80, 0x01, 0x0B, 0x07, 0xD2, 0x07,
+    0xFC, 0x00, 0xFE, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x05, 0xFF, 0xFD, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0x04, 0x00, 0xFC, 0xFF, 0x05, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF,
+    0xFE, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x02, 0x00, 0x03, 0x00, 0xFF, 0x00,
+    0xFB, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x05, 0x00, 0xFA, 0x00, 0x06, 0x00, 0xFE, 0xFF, 0xFF, 0x00,
+    0xFE, 0x00, 0xFF, 0x00, 0x05, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0x01, 0x00, 0xFB, 0x00, 0x02, 0x00,
+    0xFE, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x04, 0xFF, 0xFB, 0x00,
+    0x03, 0x00, 0x02, 0x00, 0xFB, 0x00, 0x00, 0xFF, 0x05, 0x00, 0xFF, 0x00, 0xFC, 0x00, 0x03, 0x00,
+    0xFC, 0xFF, 0x03, 0x00, 0xFD, 0x00, 0x01, 0x00, 0x05, 0x00, 0xFA, 0x00, 0x00, 0xFF, 0x03, 0x00,
+    0xFE, 0x00, 0x04, 0x00, 0x01, 0x00, 0xFC, 0xFF, 0x03, 0x00, 0xFE, 0x00, 0x02, 0x00, 0xFE, 0x00,
+    0xFE, 0x00, 0x05, 0xFF, 0xFA, 0x00, 0x05, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x05, 0x00,
+    0xFD, 0x00, 0xFF, 0x00, 0x04, 0x00, 0xFB, 0xFF, 0x05, 0x00, 0xFE, 0x00, 0x02, 0x00, 0xFC, 0x00,
+    0x03, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0xFC, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x58, 0x53, 0x31, 0x18, 0x00, 0x00, 0x00, 0x57, 0x16, 0x00, 0x00, 0x57, 0x16, 0x00, 0x00,
+    0x07, 0x07, 0xC1, 0x07, 0x04, 0x01, 0x00, 0x00, 0x02, 0x03, 0xDC, 0x01, 0xE5, 0x16, 0x00, 0x00,
+    0x00, 0xFF, 0x02, 0x00, 0x02, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x05, 0x00, 0xFF, 0xFF, 0xFC, 0x00,
+    0x02, 0x00, 0xFD, 0x00, 0x02, 0x00, 0x01, 0x00, 0xFE, 0xFF, 0x04, 0x00, 0xFD, 0x00, 0xFF, 0x00,
+    0x04, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0xFB, 0x00, 0x01, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x04, 0xFF,
+    0xFC, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xFE, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x06, 0x00,
+    0xFC, 0x00, 0xFE, 0x00, 0x05, 0xFF, 0xFC, 0x00, 0x04, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x00,
+    0x02, 0xFF, 0x01, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x06, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFD, 0x00,
+    0x01, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x04, 0xFF, 0xFC, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0xFA, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x04, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFB, 0x00, 0x03, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x04, 0xFF, 0x00, 0x00, 0xFC, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x04, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x01, 0x00, 0x03, 0x00, 0xFD, 0xFF,
+    0xFF, 0x00, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x04, 0xFF, 0xFA, 0x00, 0x05, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x05, 0xFF, 0xFF, 0x00, 0xFC, 0x00, 0x06, 0x00, 0xFB, 0x00,
+    0x03, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xFF,
+    0xFC, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x02, 0xFF, 0x01, 0x00, 0x02, 0x00,
+    0xFC, 0x00, 0xFE, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFC, 0x00, 0x01, 0x00,
+    0xFF, 0x00, 0x04, 0x00, 0xFB, 0xFF, 0x02, 0x00, 0xFE, 0x00, 0x06, 0x00, 0xFF, 0x00, 0x01, 0x00,
+    0x00, 0xFF, 0xFD, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x01, 0x00,
+    0xFF, 0x00, 0x01, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x02, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x02, 0x00,
+    0x01, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFC, 0x00, 0x04, 0x00, 0xFE, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0xFF, 0x01, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x06, 0x00, 0xFB, 0xFF, 0x00, 0x00, 0x05, 0x00, 0xFC, 0x00,
+    0xFE, 0x00, 0x03, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x02, 0x00, 0x02, 0x00,
+    0xFC, 0x00, 0x00, 0xFF, 0x05, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+    0x02, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x01, 0x00, 0x01, 0x00, 0xFA, 0x00, 0x06, 0x00, 0xFB, 0xFF,
+    0xFF, 0x00, 0x04, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x03, 0x00, 0x02, 0x00,
+    0xFF, 0x00, 0xFC, 0x00, 0x05, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0xFD, 0x00, 0x01, 0x00, 0xFD, 0x00, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x58, 0x53, 0x31, 0x19, 0x00, 0x00, 0x00, 0x45, 0x17, 0x00, 0x00, 0x45, 0x17, 0x00, 0x00,
+    0x07, 0x07, 0x9A, 0x07, 0x04, 0x01, 0x00, 0x00, 0x02, 0x03, 0xDC, 0x01, 0x8F, 0x9A, 0x01, 0x00,
+    0x03, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x04, 0x00,
+    0xFF, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0x05, 0x00, 0xFC, 0x00, 0x04, 0x00, 0xFB, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x04, 0x00, 0xFD, 0x00, 0x03, 0x00, 0xFB, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0xFD, 0x00, 0xFD, 0xFF, 0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0xFC, 0x00, 0xFE, 0x00,
+    0x06, 0x00, 0xFE, 0xFF, 0x01, 0x00, 0xFB, 0x00, 0x01, 0x00, 0x05, 0x00, 0xFF, 0x00, 0xFB, 0x00,
+    0x06, 0xFF, 0xFC, 0x00, 0x04, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x05, 0x00, 0x00, 0x00, 0xFD, 0xFF,
+    0x02, 0x00, 0xFD, 0x00, 0x05, 0x00, 0xFD, 0x00, 0x02, 0x00, 0x01, 0x00, 0xFF, 0x00, 0xFE, 0xFF,
+    0xFE, 0x00, 0x01, 0x00, 0x04, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0x05, 0xFF, 0xFE, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x02, 0xFF, 0x00, 0x00,
+    0x03, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+    0xFF, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x02, 0x00, 0x01, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFB, 0x00,
+    0x03, 0x00, 0x02, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0xFC, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x03, 0x00, 0xFF, 0xFF, 0x02, 0x00, 0xFD, 0x00, 0x03, 0x00,
+    0xFC, 0x00, 0xFE, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x06, 0x00,
+    0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x01, 0x00,
+    0x02, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x02, 0xFF, 0x01, 0x00, 0x03, 0x00, 0xFD, 0x00, 0x01, 0x00,
+    0xFC, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x02, 0x00, 0xFF, 0x00, 0x04, 0x00, 0xFE, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x02, 0x00, 0xFB, 0xFF, 0xFF, 0x00, 0x01, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0xFB, 0x00, 0x03, 0x00, 0x03, 0x00, 0xFB, 0xFF, 0x02, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x04, 0x00, 0xFE, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x02, 0x00, 0x02, 0xFF, 0xFE, 0x00, 0xFD, 0x00, 0x05, 0x00,
+    0x00, 0x00, 0xFB, 0x00, 0x02, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0x06, 0x00, 0xFB, 0x00,
+    0xFF, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x02, 0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x03, 0x00,
+    0xFD, 0x00, 0x03, 0x00, 0xFB, 0x00, 0x04, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0xFF, 0xFE, 0x00,
+    0x01, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x05, 0x00, 0xFC, 0x00, 0x03, 0x00, 0xFE, 0x00, 0xFD, 0xFF,
+    0x04, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x58, 0x53, 0x31, 0x1B, 0x00, 0x00, 0x00, 0x51, 0x18, 0x00, 0x00, 0x51, 0x18, 0x00, 0x00,
+    0x05, 0x07, 0x79, 0x07, 0x04, 0x01, 0x00, 0x00, 0x02, 0x03, 0xDC, 0x01, 0xF6, 0x19, 0x02, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x03, 0x00, 0xFE, 0x00,
+    0x04, 0xFF, 0xFF, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x03, 0x00, 0x01, 0x00, 0xFB, 0x00, 0x01, 0x00,
+    0x04, 0x00, 0xFE, 0xFF, 0xFC, 0x00, 0x03, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x02, 0x00, 0xFB, 0x00,
+    0x06, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x03, 0x00,
+    0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x05, 0x00, 0xFE, 0xFF, 0xFF, 0x00, 0x03, 0x00, 0xFA, 0x00,
+    0x06, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x02, 0x00, 0xFA, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x03, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x04, 0x00, 0xFD, 0x00, 0xFE, 0xFF,
+    0x04, 0x00, 0xFE, 0x00, 0x01, 0x00, 0x03, 0x00, 0xFC, 0x00, 0x03, 0x00, 0xFC, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x03, 0x00, 0xFE, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFD, 0x00,
+    0x05, 0x00, 0xFD, 0x00, 0x00, 0xFF, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x03, 0x00, 0xFD, 0x00,
+    0xFF, 0x00, 0xFE, 0x00, 0x01, 0x00, 0x03, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0x02, 0x00, 0xFD, 0x00,
+    0x02, 0x00, 0xFC, 0x00, 0x05, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x01, 0x00, 0x01, 0xFF, 0x04, 0x00,
+    0xFE, 0x00, 0xFF, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x02, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x03, 0x00,
+    0xFA, 0xFF, 0x02, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xFE, 0x00, 0x01, 0x00, 0x02, 0x00,
+    0xFC, 0x00, 0x04, 0x00, 0xFF, 0xFF, 0xFB, 0x00, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0xFA, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x04, 0x00, 0xFC, 0x00, 0x06, 0x00, 0xFE, 0xFF,
+    0x01, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x03, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFB, 0x00, 0x02, 0x00,
+    0xFF, 0x00, 0x04, 0xFF, 0xFC, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x00,
+    0x06, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x01, 0x00, 0xFC, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFB, 0x00,
+    0x04, 0x00, 0x01, 0x00, 0xFB, 0x00, 0x03, 0x00, 0x01, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x02, 0x00,
+    0xFD, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0xFB, 0x00, 0x03, 0x00, 0xFD, 0x00,
+    0x04, 0x00, 0xFC, 0x00, 0x06, 0x00, 0xFE, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x03, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0xFE, 0x00, 0x03, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x04, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0xFB, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x05, 0x00, 0x01, 0x00,
+    0xFF, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x04, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00,
+    0x01, 0x00, 0xFE, 0x00, 0x03, 0x00, 0xFB, 0x00, 0x06, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0xFE, 0x00, 0xFE, 0xFF, 0x02, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x58, 0x53, 0x31, 0x1C, 0x00, 0x00, 0x00, 0x3F, 0x19, 0x00, 0x00, 0x3F, 0x19, 0x00, 0x00,
+    0x06, 0x07, 0x61, 0x07, 0x04, 0x01, 0x00, 0x00, 0x02, 0x03, 0xDC, 0x01, 0x5A, 0x68, 0x01, 0x00,
+    0xFE, 0x00, 0x02, 0x00, 0x03, 0x00, 0xFF, 0x00, 0x02, 0x00, 0xFA, 0x00, 0x02, 0xFF, 0xFE, 0x00,
+    0x05, 0x00, 0xFF, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x06, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0x03, 0x00, 0x02, 0x00, 0x01, 0xFF, 0xFB, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x02, 0x00, 0xFC, 0x00,
+    0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFA, 0xFF, 0x00, 0x00, 0x04, 0x00,
+    0x02, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x03, 0x00, 0xFE, 0x00, 0x01, 0x00, 0x03, 0x00, 0xFD, 0x00,
+    0x00, 0x00, 0x02, 0xFF, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0xFB, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x01, 0x00, 0xFB, 0x00,
+    0x01, 0x00, 0x05, 0x00, 0xFB, 0x00, 0xFF, 0x00, 0x06, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x01, 0x00,
+    0xFF, 0x00, 0xFE, 0xFF, 0x05, 0x00, 0xFD, 0x00, 0x03, 0x00, 0xFB, 0x00, 0x04, 0x00, 0xFC, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFE, 0xFF, 0x04, 0x00, 0x01, 0x00,
+    0xFA, 0x00, 0x06, 0x00, 0xFC, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x03, 0x00, 0xFD, 0x00, 0xFE, 0x00,
+    0x05, 0x00, 0xFE, 0x00, 0x01, 0xFF, 0xFD, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x01, 0x00, 0x02, 0x00, 0xFD, 0x00, 0xFF, 0xFF, 0x03, 0x00,
+    0xFE, 0x00, 0x01, 0x00, 0x04, 0x00, 0xFB, 0x00, 0xFF, 0x00, 0x05, 0x00, 0xFF, 0x00, 0xFC, 0x00,
+    0x03, 0x00, 0x03, 0x00, 0xFB, 0x00, 0x05, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x05, 0x00,
+    0xFC, 0x00, 0xFF, 0x00, 0x03, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x03, 0x00,
+    0x01, 0xFF, 0xFA, 0x00, 0x05, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFB, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0xFF, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x06, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x03, 0x00, 0xFC, 0x00,
+    0x03, 0x00, 0x01, 0x00, 0xFD, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x00,
+    0xFC, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x06, 0x00, 0xFF, 0x00, 0xFE, 0x00,
+    0x03, 0xFF, 0xFA, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x06, 0x00, 0xFB, 0x00, 0x01, 0x00, 0x04, 0x00,
+    0xFD, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x02, 0x00, 0x04, 0x00, 0xFC, 0xFF, 0x01, 0x00, 0x03, 0x00,
+    0xFB, 0x00, 0x05, 0x00, 0xFA, 0x00, 0x04, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x02, 0x00, 0xFF, 0x00,
+    0xFE, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFB, 0x00, 0x01, 0x00, 0x04, 0x00, 0xFD, 0x00,
+    0x04, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFE, 0x00,
+    0x05, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x04, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFA, 0x00, 0x03, 0x00, 0x03, 0x00, 0xFA, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0xFC, 0x00, 0x06, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x58, 0x53, 0x31, 0x1D, 0x00, 0x00, 0x00, 0x2D, 0x1A, 0x00, 0x00, 0x2D, 0x1A, 0x00, 0x00,
+    0x09, 0x07, 0x4F, 0x07, 0x04, 0x01, 0x00, 0x00, 0x02, 0x03, 0xDC, 0x01, 0xF6, 0xEB, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x03, 0x00, 0xFF, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x00, 0xFF, 0x02, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x03, 0x00,
+    0xFA, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x06, 0xFF, 0xFD, 0x00, 0xFE, 0x00,
+    0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x00, 0xFC, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0xFE, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x01, 0x00, 0xFD, 0xFF, 0xFF, 0x00, 0x03, 0x00, 0x01, 0x00,
+    0xFF, 0x00, 0xFD, 0x00, 0x05, 0x00, 0xFC, 0x00, 0x05, 0x00, 0xFB, 0x00, 0xFF, 0x00, 0x03, 0x00,
+    0x01, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0xFB, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFB, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x05, 0x00, 0xFA, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0xFD, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x00, 0xFF, 0x00, 0xFB, 0x00,
+    0x04, 0x00, 0x01, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x01, 0x00, 0x02, 0x00,
+    0xFD, 0x00, 0x03, 0x00, 0x03, 0xFF, 0xFA, 0x00, 0x06, 0x00, 0xFF, 0x00, 0xFB, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x05, 0x00, 0xFE, 0x00, 0xFD, 0x00, 0x03, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFE, 0x00,
+    0x04, 0x00, 0x02, 0x00, 0xFD, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x06, 0x00, 0xFA, 0x00, 0x04, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0xFA, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFC, 0x00, 0x05, 0x00, 0xFB, 0x00, 0x05, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0xFE, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFB, 0x00, 0x04, 0x00, 0x01, 0x00,
+    0xFC, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x05, 0x00, 0xFE, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFD, 0x00,
+    0xFE, 0x00, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x04, 0x00, 0xFE, 0x00,
+    0xFD, 0x00, 0x04, 0x00, 0xFC, 0x00, 0x04, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x03, 0x00, 0xFB, 0x00,
+    0x00, 0x00, 0x05, 0x00, 0xFC, 0x00, 0x05, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xFC, 0xFF, 0xFF, 0x00, 0x02, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0xFE, 0x00, 0x04, 0x00, 0xFB, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0xFE, 0x00, 0xFD, 0xFF, 0x03, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x05, 0x00, 0xFF, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x06, 0x00, 0xFA, 0x00, 0x05, 0xFF, 0x00, 0x00,
+    0xFB, 0x00, 0x05, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x05, 0x00, 0xFD, 0x00, 0x03, 0x00, 0xFA, 0x00,
+    0x01, 0x00, 0x03, 0x00, 0xFE, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xFC, 0x00, 0x01, 0x00,
+    0x04, 0xFF, 0xFC, 0x00, 0x04, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x02, 0x00, 0x01, 0x00, 0xFD, 0x00,
+    0x01, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x58, 0x53, 0x31, 0x1E, 0x00, 0x00, 0x00, 0x1B, 0x1B, 0x00, 0x00, 0x1B, 0x1B, 0x00, 0x00,
+    0x0A, 0x07, 0x40, 0x07, 0x04, 0x01, 0x00, 0x00, 0x02, 0x03, 0xDC, 0x01, 0x61, 0xEB, 0xFE, 0x00,
+    0x03, 0x00, 0xFE, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0xFB, 0x00, 0xFF, 0x00, 0x03, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x02, 0x00, 0xFF, 0x00,
+    0x03, 0x00, 0xFE, 0x00, 0x04, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFB, 0x00, 0x01, 0x00, 0x04, 0x00, 0xFA, 0x00, 0x04, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFE, 0x00,
+    0x04, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0x00, 0xFC, 0x00, 0x05, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0xFF, 0x00,
+    0xFB, 0x00, 0x05, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xFF, 0xFA, 0x00, 0x05, 0x00,
+    0xFD, 0x00, 0x01, 0x00, 0x02, 0x00, 0xFB, 0x00, 0x01, 0x00, 0x03, 0x00, 0xFF, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0xFC, 0x00, 0x04, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x04, 0x00, 0xFD, 0x00, 0xFE, 0x00,
+    0x01, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0xFB, 0x00, 0x04, 0x00,
+    0xFD, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x04, 0x00,
+    0xFB, 0x00, 0x04, 0x00, 0xFC, 0x00, 0x05, 0x00, 0xFE, 0xFF, 0xFF, 0x00, 0xFE, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0xFB, 0x00, 0x04, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x01, 0x00,
+    0x03, 0x00, 0xFC, 0x00, 0x05, 0x00, 0xFE, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFD, 0x00,
+    0x04, 0xFF, 0xFD, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x02, 0x00, 0x02, 0x00, 0xFB, 0x00, 0x06, 0x00, 0xFD, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x04, 0x00, 0xFB, 0x00, 0xFF, 0x00, 0x03, 0xFF, 0x03, 0x00, 0x00, 0x00,
+    0xFB, 0x00, 0xFF, 0x00, 0x06, 0x00, 0xFB, 0x00, 0x05, 0x00, 0xFC, 0x00, 0x03, 0x00, 0xFD, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0xFC, 0x00, 0x06, 0x00, 0xFB, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x05, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFE, 0x00, 0x03, 0x00, 0xFD, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x01, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x06, 0x00, 0xFA, 0x00, 0x03, 0x00, 0xFF, 0x00,
+    0x03, 0x00, 0xFB, 0x00, 0x04, 0x00, 0x00, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF,
+    0xFE, 0x00, 0x02, 0x00, 0x04, 0x00, 0xFB, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00,
+    0xFC, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x03, 0x00, 0x01, 0x00, 0xFB, 0x00, 0x06, 0x00, 0xFB, 0xFF, 0x05, 0x00, 0xFB, 0x00,
+    0x01, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x03, 0x00, 0xFA, 0x00, 0x01, 0x00, 0x04, 0x00, 0xFC, 0x00,
+    0x00, 0x00, 0x05, 0x00, 0xFD, 0x00, 0x03, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x04, 0x00, 0xFE, 0x00,
+    0xFF, 0x00, 0x04, 0x00, 0xFA, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x05, 0x00, 0xFE, 0x00, 0x03, 0x00,
+    0xFC, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x58, 0x53, 0x31, 0x1F, 0x00, 0x00, 0x00, 0x09, 0x1C, 0x00, 0x00, 0x09, 0x1C, 0x00, 0x00,
+    0x08, 0x07, 0x34, 0x07, 0x04, 0x01, 0x00, 0x00, 0x02, 0x03, 0xDC, 0x01, 0x6F, 0xAC, 0x00, 0x00,
+    0x00, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0xFE, 0x00, 0xFD, 0x00,
+    0x03, 0x00, 0xFD, 0x00, 0x03, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0xFD, 0x00, 0x00, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0xFE, 0x00, 0x01, 0x00, 0x02, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x02, 0x00,
+    0x02, 0x00, 0xFC, 0x00, 0x03, 0x00, 0x00, 0xFF, 0x02, 0x00, 0x00, 0x00, 0xFD, 0x00, 0xFD, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x01, 0x00, 0x03, 0x00, 0xFD, 0x00, 0x03, 0x00,
+    0x02, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0x00, 0xFF, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0xFF, 0x00, 0xFC, 0xFF, 0xFF, 0x00, 0x06, 0x00, 0xFD, 0x00, 0x02, 0x00,
+    0xFD, 0x00, 0xFE, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x00, 0x01, 0x00, 0xFC, 0x00, 0xFE, 0x00,
+    0x00, 0x00, 0x05, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xFC, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0xFE, 0x00, 0xFC, 0xFF, 0x05, 0x00, 0xFE, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0xFB, 0x00, 0x04, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x05, 0x00, 0xFD, 0x00, 0x02, 0x00,
+    0xFF, 0x00, 0xFD, 0x00, 0x04, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x02, 0x00, 0x03, 0x00, 0xFC, 0x00,
+    0x03, 0x00, 0xFB, 0x00, 0x06, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFC, 0x00,
+    0x04, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x04, 0x00, 0xFF, 0x00, 0x02, 0x00, 0xFB, 0x00, 0x03, 0x00,
+    0xFE, 0x00, 0x05, 0x00, 0xFA, 0x00, 0x02, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x05, 0x00, 0xFB, 0x00,
+    0x01, 0x00, 0x03, 0x00, 0xFD, 0x00, 0x02, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xFD, 0xFF,
+    0x05, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x02, 0x00, 0x01, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x03, 0x00,
+    0xFF, 0x00, 0x02, 0x00, 0x02, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x02, 0x00, 0xFC, 0x00, 0x03, 0x00,
+    0xFD, 0x00, 0x00, 0x00, 0x05, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0x01, 0x00, 0x04, 0x00, 0xFD, 0x00,
+    0xFF, 0x00, 0xFF, 0xFF, 0x05, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0x03, 0x00, 0xFE, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x04, 0x00, 0xFE, 0x00, 0x04, 0x00, 0xFB, 0x00,
+    0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x01, 0x00, 0x03, 0x00, 0x02, 0x00, 0xFC, 0x00,
+    0x02, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0xFE, 0x00,
+    0x01, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xFC, 0x00, 0x02, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0xFD, 0x00, 0x03, 0x00, 0xFE, 0x00, 0x04, 0x00, 0xFA, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x04, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x03, 0x00, 0xFD, 0x00,
+    0xFF, 0xFF, 0x02, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x05, 0x00, 0xFB, 0x00, 0x04, 0x00, 0xFD, 0x00,
+    0x03, 0x00, 0xFE, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0xFA, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0xFE, 0x00, 0x02, 0x00, 0x04, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x58, 0x53, 0x31, 0x20, 0x00, 0x00, 0x00, 0xF7, 0x1C, 0x00, 0x00, 0xF7, 0x1C, 0x00, 0x00,
+    0x06, 0x07, 0x2B, 0x07, 0x04, 0x01, 0x00, 0x00, 0x02, 0x03, 0xDC, 0x01, 0x9C, 0x88, 0x05, 0x00,
+    0xFB, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x04, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xFC, 0x00, 0x04, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x03, 0x00, 0xFE, 0x00,
+    0x02, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0xFD, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x04, 0x00, 0xFE, 0x00, 0x02, 0x00, 0xFF, 0x00,
+    0xFE, 0x00, 0x05, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x03, 0x00, 0xFC, 0xFF, 0x02, 0x00, 0xFF, 0x00,
+    0x02, 0x00, 0xFE, 0x00, 0x03, 0x00, 0x01, 0x00, 0xFA, 0x00, 0x05, 0x00, 0x00, 0x00, 0xFB, 0x00,
+    0x04, 0x00, 0x01, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x04, 0x00, 0xFA, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x00,
+    0x02, 0x00, 0xFF, 0x00, 0x04, 0x00, 0xFB, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x01, 0x00, 0x03, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x04, 0x00, 0xFC, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0xFD, 0x00, 0x01, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x03, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0xFC, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x02, 0x00,
+    0x01, 0x00, 0xFF, 0x00, 0x02, 0x00, 0xFB, 0xFF, 0x03, 0x00, 0x01, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0xFD, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x05, 0x00, 0xFD, 0x00, 0x02, 0x00, 0xFB, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0xFB, 0x00, 0x02, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x05, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x04, 0x00,
+    0xFE, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x04, 0x00, 0xFC, 0xFF, 0x04, 0x00, 0xFF, 0x00, 0x02, 0x00,
+    0xFB, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x03, 0x00, 0xFD, 0x00, 0xFF, 0x00,
+    0x05, 0x00, 0xFA, 0x00, 0x04, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFE, 0x00,
+    0xFC, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x04, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x02, 0x00, 0xFF, 0x00,
+    0xFE, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x06, 0x00, 0xFA, 0x00, 0x06, 0x00, 0xFB, 0xFF, 0xFF, 0x00,
+    0x05, 0x00, 0xFC, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00,
+    0x01, 0x00, 0xFB, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x04, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x03, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF,
+    0x02, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x04, 0x00, 0xFC, 0x00, 0x05, 0x00,
+    0xFD, 0x00, 0xFF, 0x00, 0x05, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0xFF, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFA, 0x00, 0x06, 0x00,
+    0xFB, 0x00, 0x05, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xFB, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x04, 0x00, 0xFA, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x58, 0x53, 0x31, 0x21, 0x00, 0x00, 0x00, 0xE5, 0x1D, 0x00, 0x00, 0xE5, 0x1D, 0x00, 0x00,
+    0x0B, 0x07, 0x23, 0x07, 0x04, 0x01, 0x00, 0x00, 0x02, 0x03, 0xDC, 0x01, 0x1D, 0xB7, 0xFD, 0x00,
+    0xFD, 0x00, 0x00, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x05, 0x00, 0xFF, 0x00, 0xFE, 0x00,
+    0x03, 0x00, 0xFD, 0x00, 0x03, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x03, 0x00, 0xFC, 0x00, 0x06, 0x00,
+    0xFF, 0x00, 0xFE, 0x00, 0x01, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x03, 0x00,
+    0xFD, 0x00, 0xFF, 0x00, 0x06, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x05, 0x00, 0xFC, 0x00,
+    0x02, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x03, 0x00, 0xFB, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x04, 0x00, 0xFB, 0x00, 0x01, 0x00, 0x03, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x03, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00,
+    0xFC, 0x00, 0x04, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0xFC, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x02, 0x00, 0x01, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0x06, 0x00,
+    0xFE, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x02, 0x00, 0x02, 0x00, 0xFD, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0xFC, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0xFE, 0x00, 0x06, 0x00, 0xFE, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x02, 0x00, 0xFC, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0xFE, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x04, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x05, 0x00,
+    0xFB, 0xFF, 0x04, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x02, 0x00, 0x04, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x02, 0x00,
+    0xFE, 0x00, 0x03, 0x00, 0xFF, 0x00, 0xFD, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xFF, 0x00,
+    0xFD, 0x00, 0x02, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x06, 0x00, 0xFD, 0x00, 0xFD, 0x00, 0x05, 0x00,
+    0xFD, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x06, 0x00, 0xFE, 0x00, 0xFD, 0x00, 0xFF, 0x00, 0x03, 0x00,
+    0x02, 0x00, 0xFF, 0x00, 0xFC, 0xFF, 0x02, 0x00, 0x03, 0x00, 0xFB, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x01, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x01, 0x00, 0x02, 0x00,
+    0x02, 0x00, 0xFB, 0x00, 0x05, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00,
+    0xFF, 0x00, 0xFC, 0x00, 0x03, 0x00, 0xFC, 0x00, 0x05, 0x00, 0xFB, 0x00, 0x02, 0x00, 0xFF, 0x00,
+    0x05, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFD, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x00, 0xFF, 0xFE, 0x00,
+    0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0xFE, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0xFC, 0x00, 0x04, 0x00,
+    0xFD, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFC, 0x00, 0x04, 0x00, 0x01, 0x00, 0xFB, 0x00, 0x04, 0x00,
+    0xFC, 0x00, 0x02, 0x00, 0xFD, 0x00, 0x06, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x04, 0x00,
+    0xFB, 0x00, 0xFF, 0x00, 0x02, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x4E, 0x58, 0x53, 0x31, 0x22, 0x00, 0x00, 0x00, 0xD3, 0x1E, 0x00, 0x00, 0xD3, 0x1E, 0x00, 0x00,
+    0x08, 0x07, 0x1E, 0x07, 0x04, 0x01, 0x00, 0x00, 0x02, 0x03, 0x0C, 0x01, 0xB0, 0xC1, 0x03, 0x00,
+    0xFF, 0x00, 0xFC, 0x00, 0x05, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x04, 0x00,
+    0x00, 0x00, 0x01, 0x00, 0xFC, 0x00, 0x03, 0x00, 0xFC, 0x00, 0x04, 0x00, 0xFE, 0x00, 0xFD, 0x00,
+    0x06, 0x00, 0xFA, 0x00, 0x06, 0x00, 0xFB, 0x00, 0x03, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x06, 0x00,
+    0x00, 0x00, 0xFC, 0x00, 0x02, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x05, 0x00,
+    0xFC, 0x00, 0x04, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFE, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x01, 0x00, 0xFF, 0x00, 0x05, 0x00, 0xFE, 0x00,
+    0x03, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFE, 0x00, 0x02, 0x00, 0xFB, 0x00, 0x05, 0xFF, 0xFF, 0x00,
+    0x01, 0x00, 0xFA, 0x00, 0x05, 0x00, 0xFC, 0x00, 0x05, 0x00, 0xFB, 0x00, 0x05, 0x00, 0xFC, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0xFC, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0xFD, 0x00, 0x03, 0x00, 0x01, 0x00, 0xFA, 0x00,
+    0x02, 0x00, 0x04, 0x00, 0xFB, 0x00, 0x05, 0x00, 0xFC, 0x00, 0x04, 0x00, 0xFB, 0x00, 0x05, 0x00,
+    0xFF, 0x00, 0x01, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x01, 0x00, 0xFB, 0x00, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x01, 0x00, 0x03, 0x00, 0xFD, 0x00, 0x03, 0x00,
+    0xFF, 0x00, 0x01, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x04, 0x00, 0xFD, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xFE, 0x00, 0x06, 0x00, 0xFA, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0xFE, 0x00, 0x04, 0x00, 0xFC, 0x00, 0x03, 0x00, 0x02, 0x00, 0xFB, 0x00, 0x01, 0x00,
+    0x05, 0x00, 0xFD, 0x00, 0x02, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
@@ -0,0 +1,177 @@
+// test_bench.cpp — Per-call cost of the hot kernels on the host
+//
+// Each case times one kernel over enough calls to fill BENCH_MIN_US, 
+// prints the cost per call and fails only if it's past the case's 
+// ceiling. The ceilings are roughly 20× what a current desktop does, 
+// so they catch an accidental O(n²) or a kernel falling off its fast 
+// path, not ordinary noise between machines. Compare the printed 
+// numbers between runs on the same machine for anything finer.
+//
+// Host numbers aren't Teensy numbers — the M7 at 600MHz is several 
+// times slower per call and has no data cache misses on DTCM — but a 
+// change that makes a kernel slower here almost always makes it 
+// slower there too. On the device, 'p' over USB serial prints the 
+// profiler's real per-task timings.
+
+#include <unity.h>
+#include "native_tests.h"
+#include "baseline_filter.h"
+#include "noise_floor.h"
+#include "sim_session.h"
+#include "fire_effect.h"
+#include "matrix_graph.h"
+#include "colour_lcd.h"
+#include "HT1632C_Display.h"
+#include "session_format.h"
+#include "session_fixture.h"
+
+constexpr uint32_t BENCH_MIN_US = 20000;    // Time each kernel for at least 20ms
+
+// Results go here so the compiler can't drop the work
+static volatile uint32_t benchSink;
+
+// Call fn() in doubling batches until BENCH_MIN_US has passed, and 
+// return the average microseconds per call. In Python terms:
+//
+//   n = 1
+//   while (t := timeit(fn, number=n)) < 0.02: n *= 2
+//   return t / n
+template <typename Fn>
+static float time_per_call_us(Fn fn)
+{
+    for (uint32_t calls = 1;; calls *= 2) {
+        uint32_t start = hal_micros();
+        for (uint32_t i = 0; i < calls; i++) fn();
+        uint32_t elapsed = hal_micros() - start;
+
+        if (elapsed >= BENCH_MIN_US) return (float)elapsed / calls;
+    }
+}
+
+static void report(const char* name, float usPerCall, float ceilingUs)
+{
+    char line[96];
+    snprintf(line, sizeof(line), "%-28s %10.3f us/call  (ceiling %.1f)", name, usPerCall, ceilingUs);
+    TEST_MESSAGE(line);
+    TEST_ASSERT_TRUE_MESSAGE(usPerCall < ceilingUs, line);
+}
+
+
+// ════════════════════════════════════════════════════════════════════════
+// Filters — run in the sampler ISR at 1kHz
+// ════════════════════════════════════════════════════════════════════════
+
+void bench_baseline_update()
+{
+    // A ramp with a little wobble: enough movement that the median 
+    // and the EMA both do real work
+    uint16_t sample = 1500;
+    uint32_t tick = 0;
+    auto next_sample = [&]() -> uint16_t {
+        tick++;
+        return sample + (tick & 0x3F) + ((tick >> 6) & 0xFF);
+    };
+
+    BaselineFilter ema(BASELINE_EMA, 2000);
+    BaselineFilter window(BASELINE_WINDOW, 2000);
+    BaselineFilter median(BASELINE_EMA, 2000, 5);
+
+    report("baseline update (EMA)",
+           time_per_call_us([&] { benchSink = ema.update(next_sample()); }), 0.1f);
+    report("baseline update (window)",
+           time_per_call_us([&] { benchSink = window.update(next_sample()); }), 0.1f);
+    report("baseline update (EMA+median5)",
+           time_per_call_us([&] { benchSink = median.update(next_sample()); }), 0.5f);
+}
+
+void bench_noise_floor_update()
+{
+    NoiseFloor noise(8000);
+    int32_t tick = 0;
+
+    report("noise floor update",
+           time_per_call_us([&] {
+               tick++;
+               noise.update((tick & 0x1F) - 16);
+               benchSink = (uint32_t)tick;
+           }), 0.2f);
+}
+
+
+// Per sample, the cost of replaying a recorded session: CRC check, 
+// copy and decode of each sector, spread over its ~240 samples
+void bench_session_decode()
+{
+    static SessionDecoder decoder;
+    constexpr uint32_t SECTORS = sizeof(SESSION_FIXTURE) / RECORDER_SECTOR_BYTES;
+
+    float usPerFile = time_per_call_us([] {
+        decoder.reset();
+        SessionSample s;
+        for (uint32_t i = 0; i < SECTORS; i++) {
+            decoder.load(SESSION_FIXTURE + i * RECORDER_SECTOR_BYTES);
+            while (decoder.next(s)) {}
+        }
+        benchSink = s.raw;
+    });
+    report("session decode (per sample)", usPerFile / decoder.samples(), 0.2f);
+}
+
+
+// ════════════════════════════════════════════════════════════════════════
+// Simulation, fire and graph — once per 60Hz tick
+// ════════════════════════════════════════════════════════════════════════
+
+void bench_sim_tick()
+{
+    sim_reset(1);
+
+    report("sim_tick", time_per_call_us([] {
+        sim_tick();
+        benchSink = (uint32_t)sim_pressure;
+    }), 2.0f);
+}
+
+void bench_fire_step()
+{
+    fire_set_intensity(36);
+    fire_init();
+    fire_seed(1);
+
+    report("fire_step", time_per_call_us([] {
+        fire_step();
+        benchSink = fire_heat()[0];
+    }), 400.0f);
+}
+
+// All the strips of one frame, as the DMA interrupt would ask for them
+void bench_fire_render_frame()
+{
+    fire_set_intensity(36);
+    fire_init();
+    fire_seed(1);
+    for (int i = 0; i < 100; i++) fire_step();
+
+    static uint16_t strip[LCD_STRIP_PIXELS];
+    report("fire_render_strip (frame)", time_per_call_us([] {
+        for (uint16_t y = 0; y < LCD_HEIGHT; y += LCD_STRIP_LINES) {
+            fire_render_strip(strip, y, LCD_STRIP_LINES);
+        }
+        benchSink = strip[0];
+    }), 150.0f);
+}
+
+// The worst case: a shift or invalidate, so every column is redrawn
+void bench_matrix_graph_redraw()
+{
+    HT1632C_Display display;
+    matrix_graph_init();
+    int delta = 0;
+
+    report("matrix_graph_tick (redraw)", time_per_call_us([&] {
+        delta = (delta + 7) % 250;
+        matrix_graph_invalidate();
+        matrix_graph_tick(delta, 250, display);
+        benchSink = display.getBuffer()[HT1632C_WIDTH - 1];
+    }), 3.0f);
+}
@@ -0,0 +1,182 @@
+// test_golden.cpp — Golden-output tests for the control core kernels
+//
+// ═══════════════════════════════════════════════════════════════════════
+// THE SIMULATED SESSION
+// ═══════════════════════════════════════════════════════════════════════
+//
+// The filter tests replay one minute of the demo-mode simulation 
+// (sim_session.cpp) with a fixed seed: 3,600 ticks at 60Hz of 
+// tension ramps, edges, cooldowns and noise. It's recorded once per 
+// run into sessionPressure[], and test_sim_session_golden() checks 
+// the recording itself. If that one fails, the simulation changed 
+// (or config.h's SIM_* / BASELINE_* settings did), and the filter 
+// goldens below will fail with it. (A session file in the recorder's
+// own format is decoded in test_session.cpp.)
+//
+// The random source is std::minstd_rand on the host (hal.h), which 
+// the C++ standard fixes exactly, so the same seed gives the same 
+// session on any compiler.
+//
+// ── Fire and matrix ───────────────────────────────────────────────────
+// The fire runs from a fixed seed too (fire_seed()). The matrix 
+// column table has no randomness at all, so it's listed in full.
+
+#include <unity.h>
+#include "native_tests.h"
+#include "baseline_filter.h"
+#include "sim_session.h"
+#include "fire_effect.h"
+#include "matrix_graph.h"
+#include "colour_lcd.h"
+
+constexpr uint32_t SESSION_SEED = 20260214;
+constexpr uint32_t SESSION_TICKS = 60 * 60;          // One minute at 60Hz
+constexpr uint32_t FILTER_WINDOW = 120;              // 2s at 60Hz, as the sim's own
+
+constexpr uint32_t FIRE_SEED = 0xF1AE5EED;
+constexpr uint32_t FIRE_STEPS = 100;
+
+static uint16_t sessionPressure[SESSION_TICKS];
+static bool sessionRecorded = false;
+
+// Replay the simulation into sessionPressure[] (once per run) and 
+// fingerprint its other outputs alongside. In Python:
+//
+//   random.seed(SESSION_SEED)
+//   session = [sim.tick().pressure for _ in range(3600)]
+static uint32_t record_session()
+{
+    uint32_t h = fnv1a(nullptr, 0);
+    sim_reset(SESSION_SEED);
+
+    for (uint32_t i = 0; i < SESSION_TICKS; i++) {
+        sim_tick();
+        sessionPressure[i] = (uint16_t)sim_pressure;
+
+        int32_t outputs[4] = { sim_avg_pressure, sim_arousal, sim_bpm, sim_beat };
+        h = fnv1a(outputs, sizeof(outputs), h);
+    }
+
+    sessionRecorded = true;
+    return h;
+}
+
+// Fingerprint of a filter's output over the recorded session
+static uint32_t filter_session(BaselineFilter& filter)
+{
+    if (!sessionRecorded) record_session();
+
+    uint32_t h = fnv1a(nullptr, 0);
+    filter.reset();
+    for (uint32_t i = 0; i < SESSION_TICKS; i++) {
+        uint16_t out = filter.update(sessionPressure[i]);
+        h = fnv1a(&out, sizeof(out), h);
+    }
+    return h;
+}
+
+
+// ════════════════════════════════════════════════════════════════════════
+// Simulation and baseline filter
+// ════════════════════════════════════════════════════════════════════════
+
+void test_sim_session_golden()
+{
+    uint32_t outputs = record_session();
+
+    TEST_ASSERT_EQUAL_HEX32(0x46703E36, fnv1a(sessionPressure, sizeof(sessionPressure)));
+    TEST_ASSERT_EQUAL_HEX32(0xC7C9F259, outputs);
+}
+
+void test_baseline_ema_golden()
+{
+    BaselineFilter filter(BASELINE_EMA, FILTER_WINDOW);
+
+    TEST_ASSERT_EQUAL_HEX32(0x966E4C07, filter_session(filter));
+    TEST_ASSERT_EQUAL_UINT16(1816, filter.value());
+}
+
+void test_baseline_window_golden()
+{
+    BaselineFilter filter(BASELINE_WINDOW, FILTER_WINDOW);
+
+    TEST_ASSERT_EQUAL_HEX32(0x11894FDD, filter_session(filter));
+    TEST_ASSERT_EQUAL_UINT16(1812, filter.value());
+}
+
+void test_baseline_median_golden()
+{
+    BaselineFilter filter(BASELINE_EMA, FILTER_WINDOW, 5);
+
+    TEST_ASSERT_EQUAL_HEX32(0x7E44BBD4, filter_session(filter));
+    TEST_ASSERT_EQUAL_UINT16(1810, filter.value());
+}
+
+
+// ════════════════════════════════════════════════════════════════════════
+// Fire
+// ════════════════════════════════════════════════════════════════════════
+
+// The heat grid after FIRE_STEPS steps from a cold start, at full 
+// intensity and the default cooling
+void test_fire_step_golden()
+{
+    fire_set_intensity(36);
+    fire_set_cooling(3);
+    fire_init();
+    fire_seed(FIRE_SEED);
+
+    for (uint32_t i = 0; i < FIRE_STEPS; i++) fire_step();
+
+    TEST_ASSERT_EQUAL_HEX32(0xA3043FC9, fnv1a(fire_heat(), FIRE_WIDTH * FIRE_HEIGHT));
+}
+
+// The whole fire_tick() path: bottom-row refresh, step and the strips 
+// the LCD would be sent, at a lower intensity so the palette's darker 
+// half is covered too
+void test_fire_frame_golden()
+{
+    fire_set_intensity(20);
+    fire_set_cooling(2);
+    fire_init();
+    fire_seed(FIRE_SEED);
+
+    uint32_t frames = fake_lcd_frames;
+    for (uint32_t i = 0; i < FIRE_STEPS; i++) fire_tick();
+
+    TEST_ASSERT_TRUE_MESSAGE(fake_lcd_frames - frames == FIRE_STEPS, "every tick streams a frame");
+    TEST_ASSERT_EQUAL_HEX32(0xEDFCBFC5, fnv1a(fake_lcd_frame, LCD_PIXEL_COUNT * sizeof(uint16_t)));
+}
+
+
+// ════════════════════════════════════════════════════════════════════════
+// Matrix graph
+// ════════════════════════════════════════════════════════════════════════
+
+// Every (height, age) screen byte. Rows are heights 0-8, columns are 
+// ages 0 (newest, right edge) to 23 (oldest).
+static const uint8_t MATRIX_COLUMN_GOLDEN[9][24] = {
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x40, 0xC0, 0x40, 0xC0, 0x40, 0xC0, 0x40, 0xC0, 0x40, 0xC0 },
+    { 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x60, 0xA0, 0x60, 0xA0, 0x20, 0xA0, 0x20, 0xA0, 0x20, 0xA0 },
+    { 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xD0, 0xF0, 0xD0, 0xF0, 0x50, 0xB0, 0x50, 0xB0, 0x30, 0x90, 0x30, 0x90, 0x30, 0x90 },
+    { 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xD8, 0xE8, 0xD8, 0xE8, 0x58, 0xA8, 0x58, 0xA8, 0x28, 0x88, 0x28, 0x88, 0x28, 0x88 },
+    { 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xDC, 0xEC, 0xDC, 0xEC, 0x54, 0xAC, 0x54, 0xAC, 0x24, 0x8C, 0x24, 0x8C, 0x24, 0x8C },
+    { 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xDE, 0xEE, 0xDE, 0xEE, 0x56, 0xAA, 0x56, 0xAA, 0x22, 0x8A, 0x22, 0x8A, 0x22, 0x8A },
+    { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xEF, 0xDD, 0xEF, 0x55, 0xAB, 0x55, 0xAB, 0x23, 0x89, 0x23, 0x89, 0x23, 0x89 },
+};
+
+void test_matrix_column_golden()
+{
+    matrix_graph_init();
+
+    uint8_t table[9][24];
+    for (uint8_t height = 0; height <= 8; height++) {
+        for (uint8_t age = 0; age < 24; age++) {
+            table[height][age] = matrix_graph_column(height, age);
+        }
+    }
+
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(&MATRIX_COLUMN_GOLDEN[0][0], &table[0][0], sizeof(table));
+}
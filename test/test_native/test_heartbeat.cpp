@@ -0,0 +1,66 @@
+// test_heartbeat.cpp — The R-peak detector on synthetic ECG
+//
+// The trace is a flat baseline with a narrow triangular R wave every 
+// beat, plus a little pseudo-random noise: nothing like a real ECG in 
+// shape, but the band-pass and squaring stages only care about a 
+// steep, ~40ms wide spike, which is what an R wave looks like to them.
+
+#include <unity.h>
+#include "native_tests.h"
+#include "heartbeat.h"
+
+#include <stdio.h>
+
+// Feed `seconds` of ECG at `bpm` (0 = no beats at all)
+static void feed_ecg(uint32_t seconds, uint32_t bpm)
+{
+    constexpr int32_t BASE = 2048;
+    constexpr int32_t R_AMPLITUDE = 800;
+    constexpr uint32_t R_HALF_WIDTH = ECG_SAMPLE_HZ / 50;    // 20ms each side
+
+    uint32_t period = bpm ? ECG_SAMPLE_HZ * 60 / bpm : 0;
+    uint32_t x = 1;
+
+    for (uint32_t i = 0; i < seconds * ECG_SAMPLE_HZ; i++) {
+        int32_t v = BASE;
+        if (period) {
+            // Triangle peaking R_HALF_WIDTH samples into each beat
+            int32_t d = (int32_t)(i % period) - (int32_t)R_HALF_WIDTH;
+            if (d < 0) d = -d;
+            if (d < (int32_t)R_HALF_WIDTH)
+                v += R_AMPLITUDE * ((int32_t)R_HALF_WIDTH - d) / (int32_t)R_HALF_WIDTH;
+        }
+        x = x * 1103515245u + 12345u;
+        v += (int32_t)((x >> 16) % 17) - 8;
+
+        heartbeat_feed((uint16_t)constrain(v, 0, (int32_t)ADC_MAX));
+    }
+}
+
+void test_heartbeat_steady()
+{
+    heartbeat_reset();
+    uint32_t before = heartbeat_count();
+    feed_ecg(30, 72);
+
+    uint32_t beats = heartbeat_count() - before;
+    uint16_t bpm = heartbeat_bpm();
+
+    char line[64];
+    snprintf(line, sizeof(line), "72bpm in: %lu beats, %u bpm", (unsigned long)beats, bpm);
+    TEST_MESSAGE(line);
+
+    TEST_ASSERT_TRUE_MESSAGE(bpm >= 70 && bpm <= 74, line);
+    TEST_ASSERT_TRUE_MESSAGE(heartbeat_locked(), "a steady rhythm locks");
+    TEST_ASSERT_EQUAL_UINT32(33, beats);    // Golden: the 2s learning phase eats the first few
+}
+
+void test_heartbeat_flat()
+{
+    heartbeat_reset();
+    uint32_t before = heartbeat_count();
+    feed_ecg(20, 0);
+
+    TEST_ASSERT_TRUE_MESSAGE(heartbeat_count() - before <= 2, "noise alone isn't a heartbeat");
+    TEST_ASSERT_TRUE_MESSAGE(!heartbeat_locked(), "noise alone doesn't lock");
+}
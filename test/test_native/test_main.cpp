@@ -0,0 +1,47 @@
+// test_main.cpp — Unity runner for the host build of the control core
+//
+//   pio test -e native
+//
+// The golden tests run first: a benchmark of a kernel that no longer 
+// gives the right answer isn't worth reading.
+
+#include <unity.h>
+#include "native_tests.h"
+
+void setUp() {}
+void tearDown() {}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+
+    UNITY_BEGIN();
+
+    RUN_TEST(test_sim_session_golden);
+    RUN_TEST(test_baseline_ema_golden);
+    RUN_TEST(test_baseline_window_golden);
+    RUN_TEST(test_baseline_median_golden);
+    RUN_TEST(test_fire_step_golden);
+    RUN_TEST(test_fire_frame_golden);
+    RUN_TEST(test_matrix_column_golden);
+    RUN_TEST(test_session_sectors);
+    RUN_TEST(test_session_decode_golden);
+    RUN_TEST(test_auto_limit_knob);
+    RUN_TEST(test_auto_limit_adaptive_golden);
+    RUN_TEST(test_auto_cooldown_modes);
+    RUN_TEST(test_auto_cooldown_creep);
+    RUN_TEST(test_auto_cooldown_sensitise);
+    RUN_TEST(test_heartbeat_steady);
+    RUN_TEST(test_heartbeat_flat);
+
+    RUN_TEST(bench_baseline_update);
+    RUN_TEST(bench_noise_floor_update);
+    RUN_TEST(bench_session_decode);
+    RUN_TEST(bench_sim_tick);
+    RUN_TEST(bench_fire_step);
+    RUN_TEST(bench_fire_render_frame);
+    RUN_TEST(bench_matrix_graph_redraw);
+
+    return UNITY_END();
+}
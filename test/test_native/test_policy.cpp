@@ -0,0 +1,134 @@
+// test_policy.cpp — run_auto()'s thresholds and cooldowns, per userMode
+//
+// The cooldown numbers are worked out by hand from the mode 
+// descriptions in auto_policy.cpp, for one set of settings. Mode 7's 
+// threshold comes from a NoiseFloor fed a fixed pseudo-random noise 
+// trace, so it's a golden value like the filter ones.
+
+#include <unity.h>
+#include "native_tests.h"
+#include "auto_policy.h"
+
+static const AutoSettings SETTINGS = {
+    4,      // rampUp, seconds
+    6,      // cooldown
+    20,     // maxCooldown
+    2,      // cooldownStep
+    15,     // pressureStep
+    200,    // maxMotorSpeed
+};
+
+// A NoiseFloor primed on ±6 counts of flat noise, at the live rate
+static void prime_noise(NoiseFloor& noise)
+{
+    uint32_t x = 12345;
+    uint32_t window = (uint32_t)NOISE_WINDOW_SECONDS * PRESSURE_SAMPLE_HZ;
+    noise.reset(window);
+    for (uint32_t i = 0; i < 2 * window; i++) {
+        x = x * 1103515245u + 12345u;
+        noise.update((int32_t)((x >> 16) % 13) - 6);
+    }
+}
+
+void test_auto_limit_knob()
+{
+    NoiseFloor noise(8000);     // Never fed, so mode 7 uses the knob too
+
+    for (int mode = 1; mode <= 7; mode++) {
+        TEST_ASSERT_TRUE_MESSAGE(auto_pressure_limit(mode, 0, noise) == MAX_PRESSURE_LIMIT,
+                                 "knob at 0 is the least sensitive");
+        TEST_ASSERT_TRUE_MESSAGE(auto_pressure_limit(mode, AUTO_KNOB_MAX, noise) == 1,
+                                 "knob at the top is the most sensitive");
+    }
+
+    // Higher knob, lower limit, and the replay's reverse map lands 
+    // back on a knob that gives the same limit
+    int last = MAX_PRESSURE_LIMIT + 1;
+    for (int knob = 0; knob <= AUTO_KNOB_MAX; knob++) {
+        int limit = auto_pressure_limit(1, knob, noise);
+        TEST_ASSERT_TRUE_MESSAGE(limit < last, "limit falls as the knob rises");
+        last = limit;
+
+        int back = auto_pressure_limit(1, auto_knob_for_limit(1, limit, noise), noise);
+        TEST_ASSERT_TRUE_MESSAGE(back == limit, "auto_knob_for_limit() inverts the knob map");
+    }
+}
+
+void test_auto_limit_adaptive_golden()
+{
+    NoiseFloor noise(8000);
+    prime_noise(noise);
+    TEST_ASSERT_TRUE_MESSAGE(noise.primed(), "two windows prime the statistics");
+
+    // Centre knob (34 of 69): a bias of +2 on the noise top plus margin
+    int centre = auto_pressure_limit(7, AUTO_KNOB_MAX / 2, noise);
+    int least  = auto_pressure_limit(7, 0, noise);
+    int most   = auto_pressure_limit(7, AUTO_KNOB_MAX, noise);
+
+    TEST_ASSERT_EQUAL_UINT32(19, (uint32_t)centre);
+    TEST_ASSERT_EQUAL_UINT32(117, (uint32_t)least);    // Top of the noise + ADAPTIVE_BIAS_RANGE
+    TEST_ASSERT_EQUAL_UINT32(10, (uint32_t)most);    // Clamped at the floor
+
+    // A recorded mode 7 limit maps back to the knob that made it
+    for (int knob = 0; knob <= AUTO_KNOB_MAX; knob += 5) {
+        int limit = auto_pressure_limit(7, knob, noise);
+        if (limit == 10) break;                      // Past here every knob gives 10
+        TEST_ASSERT_EQUAL_UINT32((uint32_t)knob, (uint32_t)auto_knob_for_limit(7, limit, noise));
+    }
+
+    // The other modes don't look at the noise
+    TEST_ASSERT_TRUE_MESSAGE(auto_pressure_limit(3, AUTO_KNOB_MAX / 2, noise)
+                             == auto_pressure_limit(3, AUTO_KNOB_MAX / 2, NoiseFloor(8000)),
+                             "mode 3 ignores the noise statistics");
+}
+
+void test_auto_cooldown_modes()
+{
+    AutoEdgeState edge = { 5, 0, 300 };
+
+    TEST_ASSERT_EQUAL_UINT32(2000, auto_cooldown_ms(1, SETTINGS, edge));   // rampUp / 2
+    TEST_ASSERT_EQUAL_UINT32(8000, auto_cooldown_ms(2, SETTINGS, edge));   // rampUp × 2
+    TEST_ASSERT_EQUAL_UINT32(6000, auto_cooldown_ms(3, SETTINGS, edge));   // cooldown
+    TEST_ASSERT_EQUAL_UINT32(5000, auto_cooldown_ms(4, SETTINGS, edge));   // minimumcooldown
+    TEST_ASSERT_EQUAL_UINT32(6000, auto_cooldown_ms(5, SETTINGS, edge));   // cooldown
+    TEST_ASSERT_EQUAL_UINT32(2200, auto_cooldown_ms(6, SETTINGS, edge));   // 2000 + 4000 × 10 / 200
+    TEST_ASSERT_EQUAL_UINT32(6000, auto_cooldown_ms(7, SETTINGS, edge));   // cooldown
+    TEST_ASSERT_EQUAL_UINT32(0,    auto_cooldown_ms(0, SETTINGS, edge));
+    TEST_ASSERT_EQUAL_UINT32(0,    auto_cooldown_ms(8, SETTINGS, edge));
+
+    // Without the motor having been off (flag 0), nothing steps on
+    TEST_ASSERT_TRUE_MESSAGE(edge.minimumcooldown == 5 && edge.pressureLimit == 300,
+                             "no step without cooldownFlag");
+
+    // A zero ramp time counts as one second, not a zero cooldown
+    AutoSettings noRamp = SETTINGS;
+    noRamp.rampUp = 0;
+    TEST_ASSERT_EQUAL_UINT32(500, auto_cooldown_ms(1, noRamp, edge));
+}
+
+// Mode 4: each edge after the motor's been off adds cooldownStep, 
+// until it's past maxCooldown (19 is still within 20, so one more)
+void test_auto_cooldown_creep()
+{
+    AutoEdgeState edge = { 15, 0, 300 };
+    const uint32_t expected[] = { 15000, 17000, 19000, 21000, 21000, 21000 };
+
+    for (uint32_t ms : expected) {
+        edge.cooldownFlag = 1;
+        TEST_ASSERT_EQUAL_UINT32(ms, auto_cooldown_ms(4, SETTINGS, edge));
+        TEST_ASSERT_TRUE_MESSAGE(edge.cooldownFlag == 0, "the edge uses up the flag");
+    }
+}
+
+// Mode 5: each such edge brings the limit down by pressureStep, to 10
+void test_auto_cooldown_sensitise()
+{
+    AutoEdgeState edge = { 5, 0, 40 };
+    const int expected[] = { 25, 10, 10 };
+
+    for (int limit : expected) {
+        edge.cooldownFlag = 1;
+        TEST_ASSERT_EQUAL_UINT32(6000, auto_cooldown_ms(5, SETTINGS, edge));
+        TEST_ASSERT_EQUAL_UINT32((uint32_t)limit, (uint32_t)edge.pressureLimit);
+    }
+}
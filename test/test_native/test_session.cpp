@@ -0,0 +1,69 @@
+// test_session.cpp — The session decoder over a checked-in SESS file
+//
+// session_fixture.h is test/fixtures/SESS0001.BIN: eight seconds of 
+// pressure in the recorder's format, with every record type, a sector 
+// the card dropped and a sector damaged after sealing 
+// (make_session_fixture.py builds it and has the details). It's fed to SessionDecoder a sector at a time, exactly as 
+// the replay engine reads a file from the card.
+
+#include <unity.h>
+#include "native_tests.h"
+#include "session_format.h"
+#include "session_fixture.h"
+
+constexpr uint32_t FIXTURE_SECTORS = sizeof(SESSION_FIXTURE) / RECORDER_SECTOR_BYTES;
+static_assert(sizeof(SESSION_FIXTURE) % RECORDER_SECTOR_BYTES == 0, "Fixture must be whole sectors");
+
+// Decode the whole fixture, fingerprinting every sample and the 
+// control values in force at it
+static uint32_t decode_fixture(SessionDecoder& decoder)
+{
+    uint32_t h = fnv1a(nullptr, 0);
+    decoder.reset();
+
+    for (uint32_t i = 0; i < FIXTURE_SECTORS; i++) {
+        decoder.load(SESSION_FIXTURE + i * RECORDER_SECTOR_BYTES);
+
+        SessionSample s;
+        while (decoder.next(s)) {
+            uint16_t values[4] = { s.raw, s.baseline, decoder.limit(), (uint16_t)decoder.motorQ4() };
+            h = fnv1a(values, sizeof(values), h);
+        }
+    }
+    return h;
+}
+
+void test_session_sectors()
+{
+    // Every sector but the damaged one passes the check, and breaking 
+    // any byte of a good one fails it
+    uint32_t valid = 0;
+    for (uint32_t i = 0; i < FIXTURE_SECTORS; i++) {
+        if (session_sector_valid(SESSION_FIXTURE + i * RECORDER_SECTOR_BYTES)) valid++;
+    }
+    TEST_ASSERT_TRUE_MESSAGE(valid == FIXTURE_SECTORS - 1, "one damaged sector in the fixture");
+
+    uint8_t sector[RECORDER_SECTOR_BYTES];
+    memcpy(sector, SESSION_FIXTURE, sizeof(sector));
+    RecorderSectorHeader h;
+    TEST_ASSERT_TRUE_MESSAGE(session_sector_valid(sector, &h), "first sector is valid");
+    TEST_ASSERT_TRUE_MESSAGE(h.sector == 0 && h.firstSample == 0, "first sector starts the session");
+
+    sector[sizeof(RecorderSectorHeader) + 100] ^= 0x01;
+    TEST_ASSERT_TRUE_MESSAGE(!session_sector_valid(sector), "a flipped payload bit fails the CRC");
+}
+
+void test_session_decode_golden()
+{
+    static SessionDecoder decoder;
+    uint32_t fingerprint = decode_fixture(decoder);
+
+    TEST_ASSERT_EQUAL_HEX32(0x6AD38A2F, fingerprint);
+    TEST_ASSERT_EQUAL_UINT32(8000 + 25 - 238 - 30, decoder.samples());   // Gap held, two sectors lost
+    TEST_ASSERT_EQUAL_UINT32(FIXTURE_SECTORS - 1, decoder.sectorsLoaded());
+    TEST_ASSERT_EQUAL_UINT32(1, decoder.sectorsRejected());
+    TEST_ASSERT_EQUAL_UINT32(2, decoder.sectorsMissing());    // Dropped + damaged
+    TEST_ASSERT_EQUAL_UINT32(1, decoder.edges());
+    TEST_ASSERT_EQUAL_UINT16(260, decoder.limit());
+    TEST_ASSERT_EQUAL_UINT16(3, decoder.userMode());
+}